@@ -37,6 +37,7 @@
 #include "cdb/cdbappendonlystorageread.h"
 #include "cdb/cdbappendonlystoragewrite.h"
 #include "cdb/cdbvars.h"
+#include "executor/execBatch.h"
 #include "executor/executor.h"
 #include "commands/defrem.h"
 #include "fmgr.h"
@@ -1492,6 +1493,196 @@ ReadNext:
 	return false;
 }
 
+/*
+ * aocs_getnextbatch
+ *
+ * Batch-at-a-time counterpart of aocs_getnext: decode up to
+ * COLUMN_BATCH_SIZE rows of the projected columns straight into the column
+ * arrays of the batch, without forming a tuple per row, and select the
+ * visible ones.  A batch never crosses a block boundary of any column, so
+ * that the pass-by-reference values stay valid until the next call.
+ *
+ * Returns false at the end of the scan.
+ */
+bool
+aocs_getnextbatch(AOCSScanDesc scan, ScanDirection direction,
+				  ColumnBatch *batch)
+{
+	bool		isSnapshotAny = (scan->rs_base.rs_snapshot == SnapshotAny);
+	AttrNumber *proj_atts;
+	AttrNumber	num_proj_atts;
+	bool		needseg = (scan->cur_seg < 0);
+
+	Assert(ScanDirectionIsForward(direction));
+
+	/* should not be in ANALYZE/SampleScan - we use a different API */
+	Assert((scan->rs_base.rs_flags & SO_TYPE_ANALYZE) == 0);
+	Assert((scan->rs_base.rs_flags & SO_TYPE_SAMPLESCAN) == 0);
+
+	if (scan->columnScanInfo.relationTupleDesc == NULL)
+	{
+		scan->columnScanInfo.relationTupleDesc = batch->tupdesc;
+		/* Pin it! ... and of course release it upon destruction / rescan */
+		PinTupleDesc(scan->columnScanInfo.relationTupleDesc);
+		initscan_with_colinfo(scan);
+	}
+
+	proj_atts = scan->columnScanInfo.proj_atts;
+	num_proj_atts = scan->columnScanInfo.num_proj_atts;
+
+	/* same as aocs_getnext, there is nothing to return without columns */
+	if (num_proj_atts == 0)
+		return false;
+
+	for (;;)
+	{
+		AOCSFileSegInfo *curseginfo;
+		int64		firstRowNum = InvalidAORowNum;
+		int			nrows = COLUMN_BATCH_SIZE;
+		AttrNumber	i;
+
+		if (needseg)
+		{
+			if (open_next_scan_seg(scan) < 0)
+			{
+				/* No more seg, we are at the end */
+				scan->cur_seg = -1;
+				return false;
+			}
+			scan->segrowsprocessed = 0;
+			needseg = false;
+		}
+
+		Assert(scan->cur_seg >= 0);
+		curseginfo = scan->seginfo[scan->cur_seg];
+
+		/*
+		 * Make sure that every column has rows left in its current block, and
+		 * find out how many rows all of them have.  The anchor column comes
+		 * first, and tells the row number to check missing values against.
+		 */
+		for (i = 0; i < num_proj_atts; i++)
+		{
+			AttrNumber	attno = proj_atts[i];
+			DatumStreamRead *ds = scan->columnScanInfo.ds[attno];
+
+			if (i != ANCHOR_COL_IN_PROJ && firstRowNum != InvalidAORowNum &&
+				AO_ATTR_VAL_IS_MISSING(firstRowNum,
+									   attno,
+									   curseginfo->segno,
+									   scan->columnScanInfo.attnum_to_rownum))
+			{
+				int64	   *attnum_to_rownum;
+				int64		lastMissingRowNum;
+
+				/* don't mix missing and stored values in a batch */
+				attnum_to_rownum = scan->columnScanInfo.attnum_to_rownum;
+				lastMissingRowNum =
+					attnum_to_rownum[attno * MAX_AOREL_CONCURRENCY +
+									 curseginfo->segno];
+				nrows = Min(nrows, lastMissingRowNum - firstRowNum + 1);
+				continue;
+			}
+
+			if (aocs_block_remaining_rows(ds) <= 0)
+			{
+				if (datumstreamread_block(ds, scan->blockDirectory, attno) < 0)
+					break;
+
+				AOCSScanDesc_UpdateTotalBytesRead(scan, attno);
+				pgstat_count_buffer_read_ao(scan->rs_base.rs_rd,
+											RelationGuessNumberOfBlocksFromSize(
+												scan->totalBytesRead));
+
+				/* new block, reset blockRowsProcessed */
+				ds->blockRowsProcessed = 0;
+			}
+
+			if (i == ANCHOR_COL_IN_PROJ &&
+				ds->blockFirstRowNum != InvalidAORowNum)
+				firstRowNum = ds->blockFirstRowNum + ds->blockRowsProcessed;
+
+			nrows = Min(nrows, aocs_block_remaining_rows(ds));
+		}
+
+		if (i < num_proj_atts)
+		{
+			/* Ha, cannot read next block, we need to go to next seg */
+			close_cur_scan_seg(scan);
+			needseg = true;
+			continue;
+		}
+
+		Assert(nrows > 0);
+
+		/* Read the rows, one column at a time */
+		for (i = 0; i < num_proj_atts; i++)
+		{
+			AttrNumber	attno = proj_atts[i];
+			DatumStreamRead *ds = scan->columnScanInfo.ds[attno];
+			Datum	   *values;
+			bool	   *isnull;
+
+			ColumnBatchAddColumn(batch, attno);
+			values = batch->values[attno];
+			isnull = batch->isnull[attno];
+
+			if (i != ANCHOR_COL_IN_PROJ && firstRowNum != InvalidAORowNum &&
+				AO_ATTR_VAL_IS_MISSING(firstRowNum,
+									   attno,
+									   curseginfo->segno,
+									   scan->columnScanInfo.attnum_to_rownum))
+			{
+				Datum		missing;
+				bool		missingnull;
+
+				missing = getmissingattr(batch->tupdesc, attno + 1,
+										 &missingnull);
+				for (int k = 0; k < nrows; k++)
+				{
+					values[k] = missing;
+					isnull[k] = missingnull;
+				}
+				continue;
+			}
+
+			for (int k = 0; k < nrows; k++)
+			{
+				int			err PG_USED_FOR_ASSERTS_ONLY;
+
+				err = datumstreamread_advance(ds);
+				Assert(err > 0);
+				datumstreamread_get(ds, &values[k], &isnull[k]);
+			}
+			ds->blockRowsProcessed += nrows;
+		}
+
+		/* Select the visible rows */
+		batch->nrows = nrows;
+		batch->nsel = 0;
+		for (int k = 0; k < nrows; k++)
+		{
+			AOTupleId	aoTupleId;
+
+			if (firstRowNum == InvalidAORowNum)
+				AOTupleIdInit(&aoTupleId, curseginfo->segno,
+							  scan->segrowsprocessed + k + 1);
+			else
+				AOTupleIdInit(&aoTupleId, curseginfo->segno, firstRowNum + k);
+
+			batch->tids[k] = *((ItemPointer) &aoTupleId);
+			batch->sel[batch->nsel] = k;
+			if (isSnapshotAny ||
+				AppendOnlyVisimap_IsVisible(&scan->visibilityMap, &aoTupleId))
+				batch->nsel++;
+		}
+		scan->segrowsprocessed += nrows;
+
+		if (batch->nsel > 0)
+			return true;
+	}
+}
+
 
 /* Open next file segment for write.  See SetCurrentFileSegForWrite */
 /* XXX Right now, we put each column to different files */
@@ -34,6 +34,7 @@
 #include "cdb/cdbvars.h"
 #include "commands/progress.h"
 #include "commands/vacuum.h"
+#include "executor/execBatch.h"
 #include "executor/executor.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
@@ -726,6 +727,25 @@ aoco_getnextslot(TableScanDesc scan, ScanDirection direction, TupleTableSlot *sl
 	return false;
 }
 
+static bool
+aoco_getnextbatch(TableScanDesc scan, ScanDirection direction,
+				  ColumnBatch *batch)
+{
+	AOCSScanDesc  aoscan = (AOCSScanDesc) scan;
+	Relation	rel = aoscan->rs_base.rs_rd;
+
+	if (aocs_getnextbatch(aoscan, direction, batch))
+	{
+		/* pgstat_count_heap_getnext() for each row returned */
+		if (rel->pgstat_info != NULL)
+			rel->pgstat_info->t_counts.t_tuples_returned += batch->nsel;
+
+		return true;
+	}
+
+	return false;
+}
+
 static Size
 aoco_parallelscan_estimate(Relation rel)
 {
@@ -2774,6 +2794,7 @@ static const TableAmRoutine ao_column_methods = {
 	.scan_end = aoco_endscan,
 	.scan_rescan = aoco_rescan,
 	.scan_getnextslot = aoco_getnextslot,
+	.scan_getnextbatch = aoco_getnextbatch,
 
 	.parallelscan_estimate = aoco_parallelscan_estimate,
 	.parallelscan_initialize = aoco_parallelscan_initialize,
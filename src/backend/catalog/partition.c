@@ -29,6 +29,7 @@
 #include "rewrite/rewriteManip.h"
 #include "utils/builtins.h"
 #include "utils/fmgroids.h"
+#include "utils/lsyscache.h"
 #include "utils/partcache.h"
 #include "utils/rel.h"
 #include "utils/syscache.h"
@@ -201,6 +202,44 @@ index_get_partition(Relation partition, Oid indexId)
 	return InvalidOid;
 }
 
+/*
+ * index_get_leaf_partition
+ *		Return the OID of index of the given partition that descends from
+ *		the given index at any level, or InvalidOid if there isn't one.
+ *
+ * Unlike index_get_partition(), this also finds the index of a leaf of a
+ * multi-level partitioned table from the index of the root; dynamic index
+ * scans of ORCA plans only know the latter.
+ */
+Oid
+index_get_leaf_partition(Relation partition, Oid indexId)
+{
+	List	   *idxlist = RelationGetIndexList(partition);
+	ListCell   *l;
+
+	foreach(l, idxlist)
+	{
+		Oid			partIdx = lfirst_oid(l);
+		List	   *ancestors;
+		bool		found;
+
+		if (!get_rel_relispartition(partIdx))
+			continue;
+
+		ancestors = get_partition_ancestors(partIdx);
+		found = list_member_oid(ancestors, indexId);
+		list_free(ancestors);
+		if (found)
+		{
+			list_free(idxlist);
+			return partIdx;
+		}
+	}
+
+	list_free(idxlist);
+	return InvalidOid;
+}
+
 /*
  * map_partition_varattnos - maps varattno of any Vars in expr from the
  * attno's of 'from_rel' to the attno's of 'to_rel' partition, each of which
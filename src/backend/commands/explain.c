@@ -915,6 +915,72 @@ ExplainPrintSettings(ExplainState *es)
 	}
 }
 
+#ifdef USE_ORCA
+/*
+ * ExplainPrintOptimizerProfile -
+ *    Print the profile of GPORCA optimization collected when
+ *    optimizer_explain_profile is on; see PlannedStmt.optimizerProfile.
+ */
+static void
+ExplainPrintOptimizerProfile(ExplainState *es, List *profile)
+{
+	ListCell   *lc;
+
+	if (es->format == EXPLAIN_FORMAT_TEXT)
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfoString(es->str, "Optimizer Profile:\n");
+	}
+
+	ExplainOpenGroup("Optimizer Profile", "Optimizer Profile", false, es);
+
+	foreach(lc, profile)
+	{
+		List	   *entry = (List *) lfirst(lc);
+		const char *kind = strVal(list_nth(entry, 0));
+		const char *name = strVal(list_nth(entry, 1));
+		long		calls = intVal(list_nth(entry, 2));
+		long		time_us = intVal(list_nth(entry, 3));
+		long		mem_bytes = intVal(list_nth(entry, 4));
+		long		groups = intVal(list_nth(entry, 5));
+		long		group_exprs = intVal(list_nth(entry, 6));
+		long		bindings = intVal(list_nth(entry, 7));
+		long		results = intVal(list_nth(entry, 8));
+
+		if (es->format == EXPLAIN_FORMAT_TEXT)
+		{
+			appendStringInfoSpaces(es->str, (es->indent + 1) * 2);
+			appendStringInfo(es->str, "%s %s: calls=%ld", kind, name, calls);
+			if (strcmp(kind, "Xform") == 0)
+				appendStringInfo(es->str, " bindings=%ld results=%ld",
+								 bindings, results);
+			appendStringInfo(es->str, " time=%.3fms memory=%ldkB",
+							 time_us / 1000.0, mem_bytes / 1024);
+			if (strcmp(kind, "Job") != 0)
+				appendStringInfo(es->str, " groups=%ld group expressions=%ld",
+								 groups, group_exprs);
+			appendStringInfoString(es->str, "\n");
+		}
+		else
+		{
+			ExplainOpenGroup("Entry", NULL, true, es);
+			ExplainPropertyText("Kind", kind, es);
+			ExplainPropertyText("Name", name, es);
+			ExplainPropertyInteger("Calls", NULL, calls, es);
+			ExplainPropertyFloat("Time", "ms", time_us / 1000.0, 3, es);
+			ExplainPropertyInteger("Memory", "kB", mem_bytes / 1024, es);
+			ExplainPropertyInteger("Groups", NULL, groups, es);
+			ExplainPropertyInteger("Group Expressions", NULL, group_exprs, es);
+			ExplainPropertyInteger("Bindings", NULL, bindings, es);
+			ExplainPropertyInteger("Results", NULL, results, es);
+			ExplainCloseGroup("Entry", NULL, true, es);
+		}
+	}
+
+	ExplainCloseGroup("Optimizer Profile", "Optimizer Profile", false, es);
+}
+#endif
+
 /*
  * ExplainPrintPlan -
  *	  convert a QueryDesc's plan tree to text and append it to es->str
@@ -986,6 +1052,9 @@ ExplainPrintPlan(ExplainState *es, QueryDesc *queryDesc)
 #ifdef USE_ORCA
 	else
 		ExplainPropertyStringInfo("Optimizer", es, "GPORCA");
+
+	if (queryDesc->plannedstmt->optimizerProfile != NIL)
+		ExplainPrintOptimizerProfile(es, queryDesc->plannedstmt->optimizerProfile);
 #endif
 
 	ExplainPrintSettings(es);
@@ -2377,6 +2446,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			if (IsA(planstate, SeqScanState) &&
+				((ScanState *) planstate)->ss_runtime_filter)
+				show_instrumentation_count("Rows Removed by Runtime Filter", 2,
+										   planstate, es);
 			break;
 		case T_Gather:
 			{
@@ -0,0 +1,599 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.c
+ *	  Batch-at-a-time evaluation of scan quals.
+ *
+ * ExecInterpExpr evaluates an expression for one row per call, dispatching
+ * on every step of the expression for every row.  For the simple quals
+ * that dominate scans of large tables, this module instead compiles the
+ * quals into a short program of steps, each of which runs over a whole
+ * ColumnBatch at once.  Only comparisons and arithmetic on int4, int8,
+ * float8 and date are supported: a qual whose leading conjuncts use
+ * anything else is only partially compiled, and the caller evaluates the
+ * rest row by row.  int8 and float8 are only supported where they are
+ * passed by value, see USE_FLOAT8_BYVAL.
+ *
+ * The kernels below loop densely over all rows of a batch, including the
+ * ones not selected any more, so that the compiler can vectorize them;
+ * the selection vector is only consulted afterwards, to drop the rows
+ * that fail a comparison and to report errors, such as an overflow, that
+ * occurred on a selected row.
+ *
+ * Portions Copyright (c) 2024-Present VMware, Inc. or its affiliates.
+ * Portions Copyright (c) 1996-2019, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	    src/backend/executor/execBatch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "catalog/pg_type.h"
+#include "common/int.h"
+#include "executor/execBatch.h"
+#include "executor/tuptable.h"
+#include "nodes/nodeFuncs.h"
+#include "utils/float.h"
+#include "utils/fmgroids.h"
+
+/* kinds of values the kernels handle */
+typedef enum BatchType
+{
+	BATCH_INT4,					/* int4 and date */
+	BATCH_INT8,
+	BATCH_FLOAT8
+} BatchType;
+
+typedef enum BatchOp
+{
+	BATCH_EQ,
+	BATCH_NE,
+	BATCH_LT,
+	BATCH_LE,
+	BATCH_GT,
+	BATCH_GE,
+	BATCH_PL,
+	BATCH_MI,
+	BATCH_MUL
+} BatchOp;
+
+#define BATCH_OP_IS_COMPARISON(op) ((op) <= BATCH_GE)
+
+/* functions that have a kernel */
+typedef struct BatchFunction
+{
+	Oid			funcid;
+	Oid			argtype;		/* type of both arguments */
+	BatchType	type;
+	BatchOp		op;
+} BatchFunction;
+
+static const BatchFunction batch_functions[] =
+{
+	{F_INT4EQ, INT4OID, BATCH_INT4, BATCH_EQ},
+	{F_INT4NE, INT4OID, BATCH_INT4, BATCH_NE},
+	{F_INT4LT, INT4OID, BATCH_INT4, BATCH_LT},
+	{F_INT4LE, INT4OID, BATCH_INT4, BATCH_LE},
+	{F_INT4GT, INT4OID, BATCH_INT4, BATCH_GT},
+	{F_INT4GE, INT4OID, BATCH_INT4, BATCH_GE},
+	{F_INT4PL, INT4OID, BATCH_INT4, BATCH_PL},
+	{F_INT4MI, INT4OID, BATCH_INT4, BATCH_MI},
+	{F_INT4MUL, INT4OID, BATCH_INT4, BATCH_MUL},
+#ifdef USE_FLOAT8_BYVAL
+	{F_INT8EQ, INT8OID, BATCH_INT8, BATCH_EQ},
+	{F_INT8NE, INT8OID, BATCH_INT8, BATCH_NE},
+	{F_INT8LT, INT8OID, BATCH_INT8, BATCH_LT},
+	{F_INT8LE, INT8OID, BATCH_INT8, BATCH_LE},
+	{F_INT8GT, INT8OID, BATCH_INT8, BATCH_GT},
+	{F_INT8GE, INT8OID, BATCH_INT8, BATCH_GE},
+	{F_INT8PL, INT8OID, BATCH_INT8, BATCH_PL},
+	{F_INT8MI, INT8OID, BATCH_INT8, BATCH_MI},
+	{F_INT8MUL, INT8OID, BATCH_INT8, BATCH_MUL},
+	{F_FLOAT8EQ, FLOAT8OID, BATCH_FLOAT8, BATCH_EQ},
+	{F_FLOAT8NE, FLOAT8OID, BATCH_FLOAT8, BATCH_NE},
+	{F_FLOAT8LT, FLOAT8OID, BATCH_FLOAT8, BATCH_LT},
+	{F_FLOAT8LE, FLOAT8OID, BATCH_FLOAT8, BATCH_LE},
+	{F_FLOAT8GT, FLOAT8OID, BATCH_FLOAT8, BATCH_GT},
+	{F_FLOAT8GE, FLOAT8OID, BATCH_FLOAT8, BATCH_GE},
+	{F_FLOAT8PL, FLOAT8OID, BATCH_FLOAT8, BATCH_PL},
+	{F_FLOAT8MI, FLOAT8OID, BATCH_FLOAT8, BATCH_MI},
+	{F_FLOAT8MUL, FLOAT8OID, BATCH_FLOAT8, BATCH_MUL},
+#endif
+	{F_DATE_EQ, DATEOID, BATCH_INT4, BATCH_EQ},
+	{F_DATE_NE, DATEOID, BATCH_INT4, BATCH_NE},
+	{F_DATE_LT, DATEOID, BATCH_INT4, BATCH_LT},
+	{F_DATE_LE, DATEOID, BATCH_INT4, BATCH_LE},
+	{F_DATE_GT, DATEOID, BATCH_INT4, BATCH_GT},
+	{F_DATE_GE, DATEOID, BATCH_INT4, BATCH_GE}
+};
+
+/*
+ * An argument of a step: either a column of the batch, or a register
+ * holding a constant or the result of an earlier step.
+ */
+typedef struct BatchOperand
+{
+	AttrNumber	attno;			/* column, or InvalidAttrNumber */
+	Datum	   *values;			/* register, if not a column */
+	bool	   *isnull;
+} BatchOperand;
+
+typedef struct BatchStep
+{
+	BatchOp		op;
+	BatchType	type;
+	BatchOperand left;
+	BatchOperand right;
+	BatchOperand result;		/* register, for arithmetic */
+} BatchStep;
+
+struct ExprBatchState
+{
+	List	   *steps;			/* BatchSteps, in evaluation order */
+
+	/* one flag per row: comparison result, or error of an arithmetic step */
+	uint8		flags[COLUMN_BATCH_SIZE];
+};
+
+/* errors flagged by arithmetic steps */
+#define BATCH_OVERFLOW	1
+#define BATCH_UNDERFLOW	2
+
+static bool batch_compile_expr(ExprBatchState *state, Expr *expr, Oid type,
+							   TupleDesc tupdesc, BatchOperand *operand);
+static const BatchFunction *batch_lookup_function(OpExpr *opexpr);
+static void batch_alloc_register(BatchOperand *operand);
+static void batch_compare(BatchStep *step, ColumnBatch *batch,
+						  Datum *lvalues, Datum *rvalues, uint8 *flags);
+static void batch_arithmetic(BatchStep *step, ColumnBatch *batch,
+							 Datum *lvalues, Datum *rvalues, uint8 *flags);
+
+
+/*
+ * MakeColumnBatch
+ *		Create an empty batch for rows of the given descriptor, in the
+ *		current memory context.
+ */
+ColumnBatch *
+MakeColumnBatch(TupleDesc tupdesc)
+{
+	ColumnBatch *batch = palloc0(sizeof(ColumnBatch));
+
+	batch->tupdesc = tupdesc;
+	batch->mcxt = CurrentMemoryContext;
+	batch->cols = palloc(tupdesc->natts * sizeof(AttrNumber));
+	batch->values = palloc0(tupdesc->natts * sizeof(Datum *));
+	batch->isnull = palloc0(tupdesc->natts * sizeof(bool *));
+	batch->tids = palloc(COLUMN_BATCH_SIZE * sizeof(ItemPointerData));
+	batch->sel = palloc(COLUMN_BATCH_SIZE * sizeof(uint16));
+
+	return batch;
+}
+
+/*
+ * ColumnBatchAddColumn
+ *		Make room for the given 0-based attribute in the batch, if there is
+ *		none yet.
+ */
+void
+ColumnBatchAddColumn(ColumnBatch *batch, AttrNumber attno)
+{
+	Assert(attno >= 0 && attno < batch->tupdesc->natts);
+
+	if (batch->values[attno] != NULL)
+		return;
+
+	batch->values[attno] =
+		MemoryContextAlloc(batch->mcxt, COLUMN_BATCH_SIZE * sizeof(Datum));
+	batch->isnull[attno] =
+		MemoryContextAlloc(batch->mcxt, COLUMN_BATCH_SIZE * sizeof(bool));
+	batch->cols[batch->ncols++] = attno;
+}
+
+/*
+ * ExecStoreBatchRow
+ *		Store a row of the batch in a virtual tuple slot.
+ *
+ * Like the AM's own scan_getnextslot, this leaves the columns that the scan
+ * does not read alone.
+ */
+void
+ExecStoreBatchRow(ColumnBatch *batch, int row, TupleTableSlot *slot)
+{
+	Assert(row < batch->nrows);
+
+	ExecClearTuple(slot);
+
+	for (int i = 0; i < batch->ncols; i++)
+	{
+		AttrNumber	attno = batch->cols[i];
+
+		slot->tts_values[attno] = batch->values[attno][row];
+		slot->tts_isnull[attno] = batch->isnull[attno][row];
+	}
+	slot->tts_tid = batch->tids[row];
+
+	ExecStoreVirtualTuple(slot);
+}
+
+/*
+ * ExecInitBatchQual
+ *		Compile an implicitly-ANDed qual list for batches of rows of the
+ *		given descriptor.
+ *
+ * The longest prefix of conjuncts that the kernels support is compiled,
+ * the remaining ones are returned in *residual, to be evaluated on each
+ * selected row afterwards; keeping their order means that a conjunct that
+ * protects a later one from an error still does.  Returns NULL if the
+ * first conjunct is not supported already.
+ */
+ExprBatchState *
+ExecInitBatchQual(List *qual, TupleDesc tupdesc, List **residual)
+{
+	ExprBatchState *state;
+	ListCell   *lc;
+
+	state = palloc0(sizeof(ExprBatchState));
+	*residual = NIL;
+
+	foreach(lc, qual)
+	{
+		OpExpr	   *opexpr = (OpExpr *) lfirst(lc);
+		const BatchFunction *func;
+		BatchStep  *step;
+		int			nsteps = list_length(state->steps);
+
+		if (!IsA(opexpr, OpExpr) || list_length(opexpr->args) != 2)
+			break;
+
+		func = batch_lookup_function(opexpr);
+		if (func == NULL || !BATCH_OP_IS_COMPARISON(func->op))
+			break;
+
+		step = palloc0(sizeof(BatchStep));
+		step->op = func->op;
+		step->type = func->type;
+
+		if (!batch_compile_expr(state, linitial(opexpr->args), func->argtype,
+								tupdesc, &step->left) ||
+			!batch_compile_expr(state, lsecond(opexpr->args), func->argtype,
+								tupdesc, &step->right))
+		{
+			/* drop the steps of the arguments, if any */
+			state->steps = list_truncate(state->steps, nsteps);
+			break;
+		}
+
+		state->steps = lappend(state->steps, step);
+	}
+
+	for (; lc != NULL; lc = lnext(lc))
+		*residual = lappend(*residual, lfirst(lc));
+
+	if (state->steps == NIL)
+	{
+		pfree(state);
+		return NULL;
+	}
+
+	return state;
+}
+
+/*
+ * batch_compile_expr
+ *		Compile an argument of a step; arithmetic adds steps of its own.
+ *		Returns false if the expression is not supported.
+ */
+static bool
+batch_compile_expr(ExprBatchState *state, Expr *expr, Oid type,
+				   TupleDesc tupdesc, BatchOperand *operand)
+{
+	if (exprType((Node *) expr) != type)
+		return false;
+
+	if (IsA(expr, Var))
+	{
+		Var		   *var = (Var *) expr;
+
+		if (IS_SPECIAL_VARNO(var->varno) || var->varlevelsup != 0 ||
+			var->varattno <= 0 || var->varattno > tupdesc->natts)
+			return false;
+
+		operand->attno = var->varattno - 1;
+		return true;
+	}
+
+	if (IsA(expr, Const))
+	{
+		Const	   *con = (Const *) expr;
+
+		if (con->constisnull)
+			return false;
+
+		operand->attno = InvalidAttrNumber;
+		batch_alloc_register(operand);
+		for (int i = 0; i < COLUMN_BATCH_SIZE; i++)
+		{
+			operand->values[i] = con->constvalue;
+			operand->isnull[i] = false;
+		}
+		return true;
+	}
+
+	if (IsA(expr, OpExpr))
+	{
+		OpExpr	   *opexpr = (OpExpr *) expr;
+		const BatchFunction *func;
+		BatchStep  *step;
+
+		func = batch_lookup_function(opexpr);
+		if (func == NULL || BATCH_OP_IS_COMPARISON(func->op) ||
+			list_length(opexpr->args) != 2)
+			return false;
+
+		step = palloc0(sizeof(BatchStep));
+		step->op = func->op;
+		step->type = func->type;
+
+		if (!batch_compile_expr(state, linitial(opexpr->args), func->argtype,
+								tupdesc, &step->left) ||
+			!batch_compile_expr(state, lsecond(opexpr->args), func->argtype,
+								tupdesc, &step->right))
+			return false;
+
+		step->result.attno = InvalidAttrNumber;
+		batch_alloc_register(&step->result);
+		state->steps = lappend(state->steps, step);
+
+		*operand = step->result;
+		return true;
+	}
+
+	return false;
+}
+
+static const BatchFunction *
+batch_lookup_function(OpExpr *opexpr)
+{
+	set_opfuncid(opexpr);
+
+	for (int i = 0; i < lengthof(batch_functions); i++)
+	{
+		if (batch_functions[i].funcid == opexpr->opfuncid)
+			return &batch_functions[i];
+	}
+
+	return NULL;
+}
+
+static void
+batch_alloc_register(BatchOperand *operand)
+{
+	operand->values = palloc(COLUMN_BATCH_SIZE * sizeof(Datum));
+	operand->isnull = palloc(COLUMN_BATCH_SIZE * sizeof(bool));
+}
+
+/*
+ * ExecBatchQual
+ *		Remove the rows that fail the compiled quals from the selection
+ *		vector of the batch.
+ */
+void
+ExecBatchQual(ExprBatchState *state, ColumnBatch *batch)
+{
+	ListCell   *lc;
+
+	foreach(lc, state->steps)
+	{
+		BatchStep  *step = (BatchStep *) lfirst(lc);
+		BatchOperand *left = &step->left;
+		BatchOperand *right = &step->right;
+		bool	   *lnull;
+		bool	   *rnull;
+		int			nsel = 0;
+
+		if (batch->nsel == 0)
+			break;
+
+		if (left->attno != InvalidAttrNumber)
+		{
+			Assert(batch->values[left->attno] != NULL);
+			left->values = batch->values[left->attno];
+			left->isnull = batch->isnull[left->attno];
+		}
+		if (right->attno != InvalidAttrNumber)
+		{
+			Assert(batch->values[right->attno] != NULL);
+			right->values = batch->values[right->attno];
+			right->isnull = batch->isnull[right->attno];
+		}
+		lnull = left->isnull;
+		rnull = right->isnull;
+
+		if (BATCH_OP_IS_COMPARISON(step->op))
+		{
+			uint8	   *pass = state->flags;
+
+			batch_compare(step, batch, left->values, right->values, pass);
+
+			/* a NULL argument fails the qual */
+			for (int k = 0; k < batch->nsel; k++)
+			{
+				int			i = batch->sel[k];
+
+				batch->sel[nsel] = i;
+				nsel += pass[i] & !(lnull[i] | rnull[i]);
+			}
+			batch->nsel = nsel;
+		}
+		else
+		{
+			uint8	   *error = state->flags;
+			bool	   *resnull = step->result.isnull;
+
+			batch_arithmetic(step, batch, left->values, right->values,
+							 error);
+
+			for (int i = 0; i < batch->nrows; i++)
+				resnull[i] = lnull[i] | rnull[i];
+
+			for (int k = 0; k < batch->nsel; k++)
+			{
+				int			i = batch->sel[k];
+
+				if (likely(error[i] == 0) || resnull[i])
+					continue;
+
+				if (step->type == BATCH_INT4)
+					ereport(ERROR,
+							(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+							 errmsg("integer out of range")));
+				else if (step->type == BATCH_INT8)
+					ereport(ERROR,
+							(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+							 errmsg("bigint out of range")));
+				else if (error[i] == BATCH_OVERFLOW)
+					float_overflow_error();
+				else
+					float_underflow_error();
+			}
+		}
+	}
+}
+
+/*
+ * Comparison kernels: set pass[i] for each row i of the batch.
+ */
+#define BATCH_COMPARE_LOOP(GET, CMP) \
+	for (int i = 0; i < nrows; i++) \
+		pass[i] = CMP(GET(lvalues[i]), GET(rvalues[i]))
+
+#define BATCH_EQ_OP(a, b) ((a) == (b))
+#define BATCH_NE_OP(a, b) ((a) != (b))
+#define BATCH_LT_OP(a, b) ((a) < (b))
+#define BATCH_LE_OP(a, b) ((a) <= (b))
+#define BATCH_GT_OP(a, b) ((a) > (b))
+#define BATCH_GE_OP(a, b) ((a) >= (b))
+
+#define BATCH_COMPARE_SWITCH(GET, EQ, NE, LT, LE, GT, GE) \
+	switch (step->op) \
+	{ \
+		case BATCH_EQ: BATCH_COMPARE_LOOP(GET, EQ); break; \
+		case BATCH_NE: BATCH_COMPARE_LOOP(GET, NE); break; \
+		case BATCH_LT: BATCH_COMPARE_LOOP(GET, LT); break; \
+		case BATCH_LE: BATCH_COMPARE_LOOP(GET, LE); break; \
+		case BATCH_GT: BATCH_COMPARE_LOOP(GET, GT); break; \
+		case BATCH_GE: BATCH_COMPARE_LOOP(GET, GE); break; \
+		default: elog(ERROR, "unrecognized batch comparison: %d", \
+					  (int) step->op); \
+	}
+
+static void
+batch_compare(BatchStep *step, ColumnBatch *batch,
+			  Datum *lvalues, Datum *rvalues, uint8 *pass)
+{
+	int			nrows = batch->nrows;
+
+	switch (step->type)
+	{
+		case BATCH_INT4:
+			BATCH_COMPARE_SWITCH(DatumGetInt32,
+								 BATCH_EQ_OP, BATCH_NE_OP,
+								 BATCH_LT_OP, BATCH_LE_OP,
+								 BATCH_GT_OP, BATCH_GE_OP);
+			break;
+#ifdef USE_FLOAT8_BYVAL
+		case BATCH_INT8:
+			BATCH_COMPARE_SWITCH(DatumGetInt64,
+								 BATCH_EQ_OP, BATCH_NE_OP,
+								 BATCH_LT_OP, BATCH_LE_OP,
+								 BATCH_GT_OP, BATCH_GE_OP);
+			break;
+		case BATCH_FLOAT8:
+			/* NaN-aware, see utils/float.h */
+			BATCH_COMPARE_SWITCH(DatumGetFloat8,
+								 float8_eq, float8_ne,
+								 float8_lt, float8_le,
+								 float8_gt, float8_ge);
+			break;
+#endif
+		default:
+			elog(ERROR, "unrecognized batch type: %d", (int) step->type);
+	}
+}
+
+/*
+ * Arithmetic kernels: compute the result of each row i of the batch, and
+ * flag an error in error[i] instead of raising it, since the row may not be
+ * selected, or its arguments may be NULL.
+ */
+#define BATCH_INT_LOOP(GET, PUT, OVERFLOW_OP, ctype) \
+	for (int i = 0; i < nrows; i++) \
+	{ \
+		ctype		r; \
+		error[i] = OVERFLOW_OP(GET(lvalues[i]), GET(rvalues[i]), &r) ? \
+			BATCH_OVERFLOW : 0; \
+		result[i] = PUT(r); \
+	}
+
+#define BATCH_FLOAT8_LOOP(OP, UNDERFLOW) \
+	for (int i = 0; i < nrows; i++) \
+	{ \
+		float8		a = DatumGetFloat8(lvalues[i]); \
+		float8		b = DatumGetFloat8(rvalues[i]); \
+		float8		r = a OP b; \
+		error[i] = (isinf(r) && !isinf(a) && !isinf(b)) ? BATCH_OVERFLOW : \
+			(UNDERFLOW && r == 0.0 && a != 0.0 && b != 0.0) ? \
+			BATCH_UNDERFLOW : 0; \
+		result[i] = Float8GetDatum(r); \
+	}
+
+static void
+batch_arithmetic(BatchStep *step, ColumnBatch *batch,
+				 Datum *lvalues, Datum *rvalues, uint8 *error)
+{
+	int			nrows = batch->nrows;
+	Datum	   *result = step->result.values;
+
+	switch (step->type)
+	{
+		case BATCH_INT4:
+			if (step->op == BATCH_PL)
+				BATCH_INT_LOOP(DatumGetInt32, Int32GetDatum,
+							   pg_add_s32_overflow, int32)
+			else if (step->op == BATCH_MI)
+				BATCH_INT_LOOP(DatumGetInt32, Int32GetDatum,
+							   pg_sub_s32_overflow, int32)
+			else
+				BATCH_INT_LOOP(DatumGetInt32, Int32GetDatum,
+							   pg_mul_s32_overflow, int32)
+			break;
+#ifdef USE_FLOAT8_BYVAL
+		case BATCH_INT8:
+			if (step->op == BATCH_PL)
+				BATCH_INT_LOOP(DatumGetInt64, Int64GetDatum,
+							   pg_add_s64_overflow, int64)
+			else if (step->op == BATCH_MI)
+				BATCH_INT_LOOP(DatumGetInt64, Int64GetDatum,
+							   pg_sub_s64_overflow, int64)
+			else
+				BATCH_INT_LOOP(DatumGetInt64, Int64GetDatum,
+							   pg_mul_s64_overflow, int64)
+			break;
+		case BATCH_FLOAT8:
+			if (step->op == BATCH_PL)
+				BATCH_FLOAT8_LOOP(+, false)
+			else if (step->op == BATCH_MI)
+				BATCH_FLOAT8_LOOP(-, false)
+			else
+				BATCH_FLOAT8_LOOP(*, true)
+			break;
+#endif
+		default:
+			elog(ERROR, "unrecognized batch type: %d", (int) step->type);
+	}
+}
@@ -160,7 +160,7 @@ beginCurrentIndexScan(DynamicIndexScanState *node, EState *estate,
 										  tableOid, node->columnLayoutOid);
 		node->columnLayoutOid = tableOid;
 
-		indexOid = index_get_partition(currentRelation, dynamicIndexOnlyScan->indexscan.indexid);
+		indexOid = index_get_leaf_partition(currentRelation, dynamicIndexOnlyScan->indexscan.indexid);
 		if (!OidIsValid(indexOid))
 			elog(ERROR, "failed to find index for partition \"%s\" in dynamic index scan",
 				 RelationGetRelationName(currentRelation));
@@ -178,7 +178,7 @@ beginCurrentIndexScan(DynamicIndexScanState *node, EState *estate,
 									  tableOid, node->columnLayoutOid);
 		node->columnLayoutOid = tableOid;
 
-		indexOid = index_get_partition(currentRelation, dynamicIndexScan->indexscan.indexid);
+		indexOid = index_get_leaf_partition(currentRelation, dynamicIndexScan->indexscan.indexid);
 		if (!OidIsValid(indexOid))
 			elog(ERROR, "failed to find index for partition \"%s\" in dynamic index scan",
 				 RelationGetRelationName(currentRelation));
@@ -251,9 +251,12 @@
 #include "catalog/pg_proc.h"
 #include "catalog/pg_type.h"
 #include "common/hashfn.h"
+#include "common/int.h"
+#include "executor/execBatch.h"
 #include "executor/execExpr.h"
 #include "executor/executor.h"
 #include "executor/nodeAgg.h"
+#include "executor/nodeSeqscan.h"
 #include "lib/hyperloglog.h"
 #include "miscadmin.h"
 #include "nodes/makefuncs.h"
@@ -264,9 +267,13 @@
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
+#include "utils/date.h"
 #include "utils/dynahash.h"
 #include "utils/expandeddatum.h"
 #include "utils/faultinjector.h"
+#include "utils/float.h"
+#include "utils/fmgroids.h"
+#include "utils/guc.h"
 #include "utils/logtape.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
@@ -445,6 +452,10 @@ static void initialize_hash_entry(AggState *aggstate,
 static void lookup_hash_entries(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
+static void agg_fill_hash_table_batch(AggState *aggstate);
+static void agg_advance_batch(AggState *aggstate, int transno,
+							  ColumnBatch *batch, int start, int nrows);
+static void agg_batch_init(AggState *aggstate);
 static bool agg_refill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table_in_memory(AggState *aggstate);
@@ -2705,6 +2716,13 @@ agg_fill_hash_table(AggState *aggstate)
 	TupleTableSlot *outerslot;
 	ExprContext *tmpcontext = aggstate->tmpcontext;
 
+	/* GPDB: aggregate whole batches of rows if the input returns them */
+	if (aggstate->batch_input != NULL)
+	{
+		agg_fill_hash_table_batch(aggstate);
+		return;
+	}
+
 	/*
 	 * Process each outer-plan tuple, and then fetch the next one, until we
 	 * exhaust the outer plan.
@@ -2760,6 +2778,439 @@ agg_fill_hash_table(AggState *aggstate)
 						   &aggstate->perhash[0].hashiter);
 }
 
+/*
+ * GPDB: agg_fill_hash_table for batch mode
+ *
+ * Rather than fetching and aggregating the input one row at a time, take
+ * whole batches of rows from the scan below (see ExecSeqScanNextBatch),
+ * find the group of each row selected, and then advance one transition
+ * state at a time over all the rows (see agg_advance_batch).  The rows of
+ * groups that do not fit in memory are spilled as usual, and read back one
+ * at a time by agg_refill_hash_table().
+ *
+ * In streaming mode, we stop right after the row that fills the hash table,
+ * and resume from the next row of the same batch on the next call.
+ */
+static void
+agg_fill_hash_table_batch(AggState *aggstate)
+{
+	AggStatePerHash perhash = &aggstate->perhash[0];
+	TupleTableSlot *hashslot = perhash->hashslot;
+	AttrNumber *inputcols = aggstate->batch_inputcols;
+	AggStatePerGroup *pergroups = aggstate->batch_pergroups;
+
+	Assert(aggstate->num_hashes == 1);
+
+	select_current_set(aggstate, 0, true);
+
+	for (;;)
+	{
+		ColumnBatch *batch = aggstate->batch;
+		int			start;
+		int			nrows;
+		int			transno;
+
+		/* hash table in memory is filled, done with this round */
+		if (aggstate->streaming && aggstate->table_filled)
+			break;
+
+		if (batch == NULL || aggstate->batch_pos >= batch->nsel)
+		{
+			batch = ExecSeqScanNextBatch(aggstate->batch_input);
+			aggstate->batch = batch;
+			aggstate->batch_pos = 0;
+
+			if (batch == NULL)
+			{
+				/* outer plan is done */
+				aggstate->input_done = true;
+
+				if (aggstate->hash_ngroups_current == 0)
+				{
+					/* this round got nothing but NULL */
+					aggstate->agg_done = true;
+					return;
+				}
+				break;
+			}
+		}
+
+		/* Find or build the hash table entries of the rows */
+		start = aggstate->batch_pos;
+		nrows = 0;
+		while (start + nrows < batch->nsel)
+		{
+			int			row = batch->sel[start + nrows];
+			TupleHashEntry entry;
+			uint32		hash;
+			bool		isnew = false;
+			int			i;
+
+			ExecClearTuple(hashslot);
+			for (i = 0; i < perhash->numhashGrpCols; i++)
+			{
+				AttrNumber	attno;
+
+				attno = inputcols[perhash->hashGrpColIdxInput[i] - 1];
+				hashslot->tts_values[i] = batch->values[attno][row];
+				hashslot->tts_isnull[i] = batch->isnull[attno][row];
+			}
+			ExecStoreVirtualTuple(hashslot);
+
+			/* if hash table already spilled, don't create new entries */
+			entry = LookupTupleHashEntry(perhash->hashtable, hashslot,
+										 aggstate->hash_spill_mode ?
+										 NULL : &isnew,
+										 &hash);
+
+			if (entry != NULL)
+			{
+				if (isnew)
+					initialize_hash_entry(aggstate, perhash->hashtable,
+										  entry);
+
+#ifdef FAULT_INJECTOR
+				/* Fault inject to force the hash table streaming for testing purpose */
+				if (SIMPLE_FAULT_INJECTOR("force_hashagg_stream_hashtable") == FaultInjectorTypeSkip)
+					if (aggstate->streaming)
+						hash_agg_enter_spill_mode(aggstate);
+#endif
+
+				pergroups[nrows] = entry->additional;
+			}
+			else
+			{
+				HashAggSpill *spill = &aggstate->hash_spills[0];
+				TupleTableSlot *slot = aggstate->batch_slot;
+
+				/* streaming mode stops before it would need to spill */
+				Assert(!aggstate->streaming);
+
+				ExecClearTuple(slot);
+				for (i = 0; i < slot->tts_tupleDescriptor->natts; i++)
+				{
+					slot->tts_values[i] = batch->values[inputcols[i]][row];
+					slot->tts_isnull[i] = batch->isnull[inputcols[i]][row];
+				}
+				ExecStoreVirtualTuple(slot);
+
+				if (spill->partitions == NULL)
+					hashagg_spill_init(aggstate, spill,
+									   aggstate->hash_tapeinfo, 0,
+									   perhash->aggnode->numGroups,
+									   aggstate->hashentrysize);
+				perhash->num_spill_parts += spill->npartitions;
+
+				hashagg_spill_tuple(aggstate, spill, slot, hash);
+				pergroups[nrows] = NULL;
+			}
+			nrows++;
+
+			if (aggstate->streaming && aggstate->table_filled)
+				break;
+		}
+		aggstate->batch_pos = start + nrows;
+
+		/* Advance the aggregates, one transition state at a time */
+		for (transno = 0; transno < aggstate->numtrans; transno++)
+			agg_advance_batch(aggstate, transno, batch, start, nrows);
+
+		ResetExprContext(aggstate->tmpcontext);
+	}
+
+	/* finalize spills, if any */
+	hashagg_finish_initial_spills(aggstate);
+
+	aggstate->table_filled = true;
+	/* Initialize to walk the first hash table */
+	select_current_set(aggstate, 0, true);
+	ResetTupleHashIterator(perhash->hashtable, &perhash->hashiter);
+}
+
+/* keep the transition value of min() and max() unless the input wins */
+#define AGG_BATCH_MINMAX(getter, keep) \
+	for (k = 0; k < nrows; k++) \
+	{ \
+		AggStatePerGroup pergroup = pergroups[k]; \
+		int			row = sel[k]; \
+\
+		if (pergroup == NULL || isnull[row]) \
+			continue; \
+		pergroup += transno; \
+		if (pergroup->noTransValue) \
+		{ \
+			pergroup->transValue = values[row]; \
+			pergroup->transValueIsNull = false; \
+			pergroup->noTransValue = false; \
+		} \
+		else if (!pergroup->transValueIsNull && \
+				 !keep(getter(pergroup->transValue), getter(values[row]))) \
+			pergroup->transValue = values[row]; \
+	}
+
+#define AGG_BATCH_GT(a, b) ((a) > (b))
+#define AGG_BATCH_LT(a, b) ((a) < (b))
+
+/*
+ * GPDB: advance one transition state over rows start .. start + nrows - 1
+ * of the selection vector of a batch, whose groups agg_fill_hash_table_batch
+ * has stored in batch_pergroups (NULL for the rows spilled).
+ *
+ * The transition functions of count(), sum(), min() and max() on the
+ * common fixed-width types are inlined into loops over the batch, which
+ * give the same results as the functions, errors included.  Any other
+ * transition function is called row by row.
+ */
+static void
+agg_advance_batch(AggState *aggstate, int transno, ColumnBatch *batch,
+				  int start, int nrows)
+{
+	AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+	AggStatePerGroup *pergroups = aggstate->batch_pergroups;
+	uint16	   *sel = batch->sel + start;
+	Datum	   *values = NULL;
+	bool	   *isnull = NULL;
+	int			k;
+
+	if (pertrans->batchInputCol >= 0)
+	{
+		values = batch->values[pertrans->batchInputCol];
+		isnull = batch->isnull[pertrans->batchInputCol];
+	}
+
+	switch (pertrans->batchTransfn)
+	{
+#ifdef USE_FLOAT8_BYVAL
+		case F_INT8INC:
+		case F_INT8INC_ANY:
+			/* count(*) and count(any) */
+			for (k = 0; k < nrows; k++)
+			{
+				AggStatePerGroup pergroup = pergroups[k];
+				int64		count;
+
+				if (pergroup == NULL || (isnull != NULL && isnull[sel[k]]))
+					continue;
+				pergroup += transno;
+				if (pergroup->transValueIsNull)
+					continue;
+				count = DatumGetInt64(pergroup->transValue);
+				if (unlikely(pg_add_s64_overflow(count, 1, &count)))
+					ereport(ERROR,
+							(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+							 errmsg("bigint out of range")));
+				pergroup->transValue = Int64GetDatum(count);
+			}
+			break;
+
+		case F_INT4_SUM:
+			/* not strict, starts from the first non-null input */
+			for (k = 0; k < nrows; k++)
+			{
+				AggStatePerGroup pergroup = pergroups[k];
+				int			row = sel[k];
+				int64		sum;
+
+				if (pergroup == NULL || isnull[row])
+					continue;
+				pergroup += transno;
+				sum = (int64) DatumGetInt32(values[row]);
+				if (!pergroup->transValueIsNull)
+					sum += DatumGetInt64(pergroup->transValue);
+				pergroup->transValue = Int64GetDatum(sum);
+				pergroup->transValueIsNull = false;
+			}
+			break;
+
+		case F_FLOAT8PL:
+			/* sum(float8) */
+			for (k = 0; k < nrows; k++)
+			{
+				AggStatePerGroup pergroup = pergroups[k];
+				int			row = sel[k];
+
+				if (pergroup == NULL || isnull[row])
+					continue;
+				pergroup += transno;
+				if (pergroup->noTransValue)
+				{
+					pergroup->transValue = values[row];
+					pergroup->transValueIsNull = false;
+					pergroup->noTransValue = false;
+				}
+				else if (!pergroup->transValueIsNull)
+				{
+					float8		sum = DatumGetFloat8(pergroup->transValue);
+
+					sum = float8_pl(sum, DatumGetFloat8(values[row]));
+					pergroup->transValue = Float8GetDatum(sum);
+				}
+			}
+			break;
+
+		case F_INT4LARGER:
+			AGG_BATCH_MINMAX(DatumGetInt32, AGG_BATCH_GT);
+			break;
+		case F_INT4SMALLER:
+			AGG_BATCH_MINMAX(DatumGetInt32, AGG_BATCH_LT);
+			break;
+		case F_INT8LARGER:
+			AGG_BATCH_MINMAX(DatumGetInt64, AGG_BATCH_GT);
+			break;
+		case F_INT8SMALLER:
+			AGG_BATCH_MINMAX(DatumGetInt64, AGG_BATCH_LT);
+			break;
+		case F_FLOAT8LARGER:
+			AGG_BATCH_MINMAX(DatumGetFloat8, float8_gt);
+			break;
+		case F_FLOAT8SMALLER:
+			AGG_BATCH_MINMAX(DatumGetFloat8, float8_lt);
+			break;
+		case F_DATE_LARGER:
+			AGG_BATCH_MINMAX(DatumGetDateADT, AGG_BATCH_GT);
+			break;
+		case F_DATE_SMALLER:
+			AGG_BATCH_MINMAX(DatumGetDateADT, AGG_BATCH_LT);
+			break;
+#endif							/* USE_FLOAT8_BYVAL */
+
+		default:
+			{
+				FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
+
+				for (k = 0; k < nrows; k++)
+				{
+					AggStatePerGroup pergroup = pergroups[k];
+
+					if (pergroup == NULL)
+						continue;
+					if (values != NULL)
+					{
+						fcinfo->args[1].value = values[sel[k]];
+						fcinfo->args[1].isnull = isnull[sel[k]];
+					}
+					advance_transition_function(aggstate, pertrans,
+												pergroup + transno);
+				}
+			}
+			break;
+	}
+}
+
+/*
+ * GPDB: set up batch mode, see agg_fill_hash_table_batch()
+ *
+ * It applies to hashed aggregation of a single grouping set, over a
+ * sequential scan returning batches with all of its quals evaluated, and
+ * whose targetlist consists of plain columns of the table.  Each aggregate
+ * must be a simple one taking at most one column as its input.
+ */
+static void
+agg_batch_init(AggState *aggstate)
+{
+	PlanState  *outerstate = outerPlanState(aggstate);
+	SeqScanState *scanstate;
+	AttrNumber *inputcols;
+	ListCell   *lc;
+	int			i;
+	int			transno;
+
+	if (!gp_enable_vectorized_agg ||
+		aggstate->aggstrategy != AGG_HASHED ||
+		aggstate->num_hashes != 1 ||
+		DO_AGGSPLIT_COMBINE(aggstate->aggsplit) ||
+		!IsA(outerstate, SeqScanState))
+		return;
+
+	scanstate = (SeqScanState *) outerstate;
+	if (scanstate->batch == NULL || scanstate->ss.ps.qual != NULL)
+		return;
+
+	/* map the input columns to the columns of the batch */
+	inputcols = palloc(sizeof(AttrNumber) *
+					   Max(list_length(outerstate->plan->targetlist), 1));
+	i = 0;
+	foreach(lc, outerstate->plan->targetlist)
+	{
+		Var		   *var = (Var *) ((TargetEntry *) lfirst(lc))->expr;
+
+		if (!IsA(var, Var) || var->varattno <= 0)
+		{
+			pfree(inputcols);
+			return;
+		}
+		inputcols[i++] = var->varattno - 1;
+	}
+
+	for (transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+		Aggref	   *aggref = pertrans->aggref;
+
+		if (aggref->aggkind != AGGKIND_NORMAL ||
+			aggref->aggfilter != NULL ||
+			pertrans->numSortCols > 0 ||
+			pertrans->numTransInputs > 1)
+		{
+			pfree(inputcols);
+			return;
+		}
+
+		pertrans->batchInputCol = -1;
+		if (pertrans->numTransInputs == 1)
+		{
+			TargetEntry *tle = (TargetEntry *) linitial(aggref->args);
+			Var		   *var = (Var *) tle->expr;
+
+			if (!IsA(var, Var) || var->varno != OUTER_VAR)
+			{
+				pfree(inputcols);
+				return;
+			}
+			pertrans->batchInputCol = inputcols[var->varattno - 1];
+		}
+
+		/* the inlined transition functions, see agg_advance_batch() */
+		switch (pertrans->transfn_oid)
+		{
+			case F_INT8INC:
+			case F_INT8INC_ANY:
+				pertrans->batchTransfn = pertrans->initValueIsNull ?
+					InvalidOid : pertrans->transfn_oid;
+				break;
+			case F_INT4_SUM:
+				pertrans->batchTransfn = pertrans->transfn_oid;
+				break;
+			case F_FLOAT8PL:
+			case F_INT4LARGER:
+			case F_INT4SMALLER:
+			case F_INT8LARGER:
+			case F_INT8SMALLER:
+			case F_FLOAT8LARGER:
+			case F_FLOAT8SMALLER:
+			case F_DATE_LARGER:
+			case F_DATE_SMALLER:
+				pertrans->batchTransfn = pertrans->initValueIsNull ?
+					pertrans->transfn_oid : InvalidOid;
+				break;
+			default:
+				pertrans->batchTransfn = InvalidOid;
+				break;
+		}
+	}
+
+	aggstate->batch_input = scanstate;
+	aggstate->batch_inputcols = inputcols;
+	aggstate->batch = NULL;
+	aggstate->batch_pos = 0;
+	aggstate->batch_pergroups =
+		palloc(sizeof(AggStatePerGroup) * COLUMN_BATCH_SIZE);
+	aggstate->batch_slot =
+		ExecInitExtraTupleSlot(aggstate->ss.ps.state,
+							   ExecGetResultType(outerstate),
+							   &TTSOpsVirtual);
+}
+
 /*
  * If any data was spilled during hash aggregation, reset the hash table and
  * reprocess one batch of spilled data. After reprocessing a batch, the hash
@@ -4358,6 +4809,9 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		phase->evaltrans_cache[0][0] = phase->evaltrans;
 	}
 
+	/* GPDB: see if we can aggregate batches of rows */
+	agg_batch_init(aggstate);
+
 	return aggstate;
 }
 
@@ -4949,6 +5403,8 @@ ExecReScanAgg(AggState *node)
 	if (node->aggstrategy == AGG_HASHED || node->aggstrategy == AGG_MIXED)
 	{
 		node->input_done = false;
+		/* GPDB: forget the rest of the current batch */
+		node->batch = NULL;
 
 		hashagg_reset_spill_state(node);
 
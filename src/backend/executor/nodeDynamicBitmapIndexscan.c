@@ -170,7 +170,7 @@ beginCurrentBitmapIndexScan(DynamicBitmapIndexScanState *node, EState *estate,
 	 * partition.
 	 */
 	Oid indexOidOld = dbiScan->biscan.indexid;
-	indexOid = index_get_partition(currentRelation, dbiScan->biscan.indexid);
+	indexOid = index_get_leaf_partition(currentRelation, dbiScan->biscan.indexid);
 	if (!OidIsValid(indexOid))
 		elog(ERROR, "failed to find index for partition \"%s\" for \"%d\"in dynamic index scan",
 			 RelationGetRelationName(currentRelation), dbiScan->biscan.indexid);
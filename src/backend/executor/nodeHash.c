@@ -37,6 +37,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "port/atomics.h"
@@ -76,6 +77,8 @@ static HashJoinTuple ExecParallelHashTupleAlloc(HashJoinTable hashtable,
 												size_t size,
 												dsa_pointer *shared);
 static void MultiExecPrivateHash(HashState *node);
+static void ExecHashRuntimeFilterAdd(HashJoinRuntimeFilter *filter,
+									 uint32 hashvalue);
 static void MultiExecParallelHash(HashState *node);
 static inline HashJoinTuple ExecParallelHashFirstTuple(HashJoinTable table,
 													   int bucketno);
@@ -158,6 +161,7 @@ MultiExecPrivateHash(HashState *node)
 	List	   *hashkeys;
 	HashJoinTable hashtable;
 	TupleTableSlot *slot;
+	TupleTableSlot *resume_slot = NULL;
 	ExprContext *econtext;
 	uint32		hashvalue;
 
@@ -173,7 +177,25 @@ MultiExecPrivateHash(HashState *node)
 	hashkeys = node->hashkeys;
 	econtext = node->ps.ps_ExprContext;
 
-	SIMPLE_FAULT_INJECTOR("multi_exec_hash_large_vmem");
+	if (node->hs_paused)
+	{
+		/*
+		 * GPDB: resume a build that stopped early, see hs_pause_tuples.  The
+		 * buckets are accounted for again at the end.
+		 */
+		resume_slot = node->hs_paused_slot;
+		node->hs_paused = false;
+		node->hs_paused_slot = NULL;
+		hashtable->spaceUsed -= hashtable->nbuckets * sizeof(HashJoinTuple);
+	}
+	else
+	{
+		if (node->hs_runtime_filter)
+			ExecHashRuntimeFilterReset(node->hs_runtime_filter,
+									   node->ps.plan->plan_rows);
+
+		SIMPLE_FAULT_INJECTOR("multi_exec_hash_large_vmem");
+	}
 
 	/*
 	 * Get all tuples from the node below the Hash node and insert into the
@@ -183,10 +205,36 @@ MultiExecPrivateHash(HashState *node)
 	{
 		bool hashkeys_null = false;
 
-		slot = ExecProcNode(outerNode);
+		if (resume_slot != NULL)
+		{
+			slot = resume_slot;
+			resume_slot = NULL;
+		}
+		else
+			slot = ExecProcNode(outerNode);
 		if (TupIsNull(slot))
 			break;
 
+		/*
+		 * GPDB: if the hash table already holds many more tuples than
+		 * estimated and fills three quarters of its memory, stop here and
+		 * let the join decide whether to swap its sides.  The rest of the
+		 * memory is left for the outer tuples the join reads ahead; the
+		 * check allows for the buckets doubling.
+		 */
+		if (node->hs_pause_tuples > 0 &&
+			hashtable->totalTuples >= node->hs_pause_tuples &&
+			hashtable->nbatch == 1 &&
+			hashtable->spaceUsed +
+			2 * hashtable->nbuckets_optimal * sizeof(HashJoinTuple) >
+			hashtable->spaceAllowed / 4 * 3)
+		{
+			node->hs_pause_tuples = 0;
+			node->hs_paused = true;
+			node->hs_paused_slot = slot;
+			break;
+		}
+
 		/* We have to compute the hash value */
 		econtext->ecxt_outertuple = slot;
 		if (ExecHashGetHashValue(node, hashtable, econtext, hashkeys,
@@ -209,6 +257,9 @@ MultiExecPrivateHash(HashState *node)
 				ExecHashTableInsert(node, hashtable, slot, hashvalue);
 			}
 			hashtable->totalTuples += 1;
+
+			if (node->hs_runtime_filter)
+				ExecHashRuntimeFilterAdd(node->hs_runtime_filter, hashvalue);
 		}
 
 		if (hashkeys_null)
@@ -235,6 +286,108 @@ MultiExecPrivateHash(HashState *node)
 		hashtable->spacePeak = hashtable->spaceUsed;
 
 	hashtable->partialTuples = hashtable->totalTuples;
+
+	/* a build that stopped early has not seen all the inner tuples yet */
+	if (node->hs_runtime_filter && !node->hs_paused)
+		node->hs_runtime_filter->built = true;
+}
+
+/*
+ * Number of outer rows probed before a runtime filter checks whether it is
+ * selective enough to be worth probing, and the fraction of the probed rows
+ * it has to reject for that.
+ */
+#define RUNTIME_FILTER_SAMPLE_ROWS		10000
+#define RUNTIME_FILTER_MIN_REJECT_RATIO	0.1
+
+/* ----------------------------------------------------------------
+ *		ExecHashRuntimeFilterReset
+ *
+ *		start a new build of the hash table
+ *
+ * The Bloom filter is sized for the estimated number of inner tuples and
+ * never takes more than work_mem.  If the estimate is too low, the filter
+ * just lets more unmatched outer rows through.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashRuntimeFilterReset(HashJoinRuntimeFilter *filter, double ntuples)
+{
+	MemoryContext oldcxt;
+
+	if (filter->bloom)
+		bloom_free(filter->bloom);
+
+	oldcxt = MemoryContextSwitchTo(filter->mcxt);
+	filter->bloom = bloom_create((int64) Max(ntuples, 1.0), work_mem, 0);
+	MemoryContextSwitchTo(oldcxt);
+
+	filter->built = false;
+	filter->disabled = false;
+	filter->nprobed = 0;
+	filter->nrejected = 0;
+}
+
+/*
+ * ExecHashRuntimeFilterAdd
+ *		add the hash value of an inner tuple to the filter
+ */
+static void
+ExecHashRuntimeFilterAdd(HashJoinRuntimeFilter *filter, uint32 hashvalue)
+{
+	bloom_add_element(filter->bloom, (unsigned char *) &hashvalue,
+					  sizeof(uint32));
+}
+
+/* ----------------------------------------------------------------
+ *		ExecHashRuntimeFilterPasses
+ *
+ *		can the given outer tuple find a match in the hash table
+ *
+ * The tuple is hashed the way the hash join hashes its outer tuples, so a
+ * tuple is only rejected if the join would not find a match for it either.
+ * Until the hash table is built every tuple passes.
+ * ----------------------------------------------------------------
+ */
+bool
+ExecHashRuntimeFilterPasses(HashJoinRuntimeFilter *filter,
+							TupleTableSlot *slot)
+{
+	HashJoinState *hjstate = filter->hjstate;
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	uint32		hashvalue;
+	bool		hashkeys_null = false;
+	bool		passes;
+
+	if (!filter->built || filter->disabled ||
+		hashtable == NULL || hashtable->eagerlyReleased)
+		return true;
+
+	filter->econtext->ecxt_outertuple = slot;
+	if (!ExecHashGetHashValue((HashState *) innerPlanState(hjstate),
+							  hashtable, filter->econtext,
+							  hjstate->hj_OuterHashKeys,
+							  true,	/* outer tuple */
+							  hjstate->hj_nonequijoin,
+							  &hashvalue,
+							  &hashkeys_null))
+		passes = false;
+	else
+		passes = !bloom_lacks_element(filter->bloom,
+									  (unsigned char *) &hashvalue,
+									  sizeof(uint32));
+
+	filter->nprobed++;
+	if (!passes)
+		filter->nrejected++;
+
+	/* stop probing if the filter turns out not to be selective */
+	if (filter->nprobed == RUNTIME_FILTER_SAMPLE_ROWS &&
+		filter->nrejected <
+		filter->nprobed * RUNTIME_FILTER_MIN_REJECT_RATIO)
+		filter->disabled = true;
+
+	return passes;
 }
 
 /* ----------------------------------------------------------------
@@ -2366,6 +2519,32 @@ ExecHashTableReset(HashState *hashState, HashJoinTable hashtable)
 	hashtable->chunks = NULL;
 }
 
+/*
+ * ExecHashTableReleaseTuples
+ *
+ *		GPDB: release the tuples of a hash table that is not going to be
+ *		probed anymore, after a hash join swapped its sides.  The hash
+ *		table can still compute hash values.
+ */
+void
+ExecHashTableReleaseTuples(HashJoinTable hashtable)
+{
+	Assert(!hashtable->eagerlyReleased);
+	Assert(hashtable->nbatch == 1);
+
+	/* the buckets, the skew hash table and the tuples all live here */
+	MemoryContextReset(hashtable->batchCxt);
+
+	hashtable->buckets.unshared = NULL;
+	hashtable->chunks = NULL;
+	hashtable->skewEnabled = false;
+	hashtable->skewBucket = NULL;
+	hashtable->skewBucketNums = NULL;
+	hashtable->nSkewBuckets = 0;
+	hashtable->spaceUsed = 0;
+	hashtable->spaceUsedSkew = 0;
+}
+
 /*
  * ExecHashTableResetMatchFlags
  *		Clear all the HeapTupleHeaderHasMatch flags in the table
@@ -2399,6 +2578,11 @@ ExecHashTableResetMatchFlags(HashJoinTable hashtable)
 void
 ExecReScanHash(HashState *node)
 {
+	/* GPDB: forget about a build that stopped early */
+	node->hs_pause_tuples = 0;
+	node->hs_paused = false;
+	node->hs_paused_slot = NULL;
+
 	/*
 	 * if chgParam of subnode is not null then plan will be re-scanned by
 	 * first ExecProcNode.
@@ -2801,8 +2985,9 @@ ExecHashTableExplainBatchEnd(HashState *hashState, HashJoinTable hashtable)
 static void
 ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 {
-	HeapTupleData *statsTuple;
+	HeapTupleData *statsTuple = NULL;
 	AttStatsSlot sslot;
+	bool		found;
 
 	/* Do nothing if planner didn't identify the outer relation's join key */
 	if (!OidIsValid(node->skewTable))
@@ -2811,19 +2996,51 @@ ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 	if (mcvsToUse <= 0)
 		return;
 
-	/*
-	 * Try to find the MCV statistics for the outer relation's join key.
-	 */
-	statsTuple = SearchSysCache3(STATRELATTINH,
-								 ObjectIdGetDatum(node->skewTable),
-								 Int16GetDatum(node->skewColumn),
-								 BoolGetDatum(node->skewInherit));
-	if (!HeapTupleIsValid(statsTuple))
-		return;
+	if (node->skewValues != NIL)
+	{
+		/*
+		 * GPDB: the planner copied the MCVs into the plan, see
+		 * set_hash_skew_values.  Present them like get_attstatsslot does,
+		 * so that free_attstatsslot releases them.
+		 */
+		ListCell   *lcv;
+		ListCell   *lcf;
+		int			i = 0;
+
+		memset(&sslot, 0, sizeof(AttStatsSlot));
+		sslot.nvalues = list_length(node->skewValues);
+		sslot.nnumbers = list_length(node->skewFreqs);
+		Assert(sslot.nvalues == sslot.nnumbers);
+		sslot.values = (Datum *) palloc(sslot.nvalues * sizeof(Datum));
+		sslot.numbers = (float4 *) palloc(sslot.nnumbers * sizeof(float4));
+		sslot.numbers_arr = sslot.numbers;
+		forboth(lcv, node->skewValues, lcf, node->skewFreqs)
+		{
+			sslot.values[i] = lfirst_node(Const, lcv)->constvalue;
+			sslot.numbers[i] =
+				DatumGetFloat4(lfirst_node(Const, lcf)->constvalue);
+			i++;
+		}
+		found = true;
+	}
+	else
+	{
+		/*
+		 * Try to find the MCV statistics for the outer relation's join key.
+		 */
+		statsTuple = SearchSysCache3(STATRELATTINH,
+									 ObjectIdGetDatum(node->skewTable),
+									 Int16GetDatum(node->skewColumn),
+									 BoolGetDatum(node->skewInherit));
+		if (!HeapTupleIsValid(statsTuple))
+			return;
+
+		found = get_attstatsslot(&sslot, statsTuple,
+								 STATISTIC_KIND_MCV, InvalidOid,
+								 ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS);
+	}
 
-	if (get_attstatsslot(&sslot, statsTuple,
-						 STATISTIC_KIND_MCV, InvalidOid,
-						 ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS))
+	if (found)
 	{
 		double		frac;
 		int			nbuckets;
@@ -2844,7 +3061,8 @@ ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 		if (frac < SKEW_MIN_OUTER_FRACTION)
 		{
 			free_attstatsslot(&sslot);
-			ReleaseSysCache(statsTuple);
+			if (statsTuple)
+				ReleaseSysCache(statsTuple);
 			return;
 		}
 
@@ -2943,7 +3161,8 @@ ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 		free_attstatsslot(&sslot);
 	}
 
-	ReleaseSysCache(statsTuple);
+	if (statsTuple)
+		ReleaseSysCache(statsTuple);
 }
 
 /*
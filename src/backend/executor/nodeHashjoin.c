@@ -117,12 +117,14 @@
 #include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
 #include "pgstat.h"
+#include "utils/dynahash.h"
 #include "utils/memutils.h"
 #include "utils/sharedtuplestore.h"
 
 #include "cdb/cdbvars.h"
 #include "miscadmin.h"			/* work_mem */
 #include "utils/faultinjector.h"
+#include "utils/guc.h"
 
 /*
  * States of the ExecHashJoin state machine
@@ -133,6 +135,48 @@
 #define HJ_FILL_OUTER_TUPLE		4
 #define HJ_FILL_INNER_TUPLES	5
 #define HJ_NEED_NEW_BATCH		6
+#define HJ_REVERSED_PROBE		7
+
+/*
+ * GPDB: the inner side must exceed its estimate this many times before the
+ * hash join considers swapping its sides.
+ */
+#define HJ_REVERSE_MIN_UNDERESTIMATE	10
+
+/*
+ * GPDB: state of a hash join that read ahead on its outer side, to find out
+ * whether the sides should be swapped (see ExecHashJoinReverseRoles).  All of
+ * it lives in its own memory context.
+ */
+typedef struct HashJoinReversalEntry
+{
+	struct HashJoinReversalEntry *next;		/* next outer tuple read */
+	struct HashJoinReversalEntry *chain;	/* next entry in the bucket */
+	uint32		hashvalue;
+	MinimalTuple tuple;
+} HashJoinReversalEntry;
+
+typedef struct HashJoinReversal
+{
+	MemoryContext cxt;
+	HashJoinReversalEntry *outer;		/* outer tuples, in the order read */
+	HashJoinReversalEntry *nextouter;	/* next one to replay */
+	int			nouter;
+	Size		space;			/* memory taken from the inner hash table */
+	bool		reversed;		/* were the sides swapped? */
+
+	/* hash table of the outer tuples, once the sides have been swapped */
+	HashJoinReversalEntry **buckets;
+	int			nbuckets;
+
+	/* probe state */
+	int			curbucket;		/* next bucket of the inner hash table */
+	HashJoinTuple curinner;		/* next tuple in that bucket */
+	bool		innerdone;		/* inner side exhausted? */
+	TupleTableSlot *innerslot;	/* current inner tuple */
+	uint32		innerhash;		/* and its hash value */
+	HashJoinReversalEntry *curouter;	/* next outer tuple to match */
+} HashJoinReversal;
 
 /* Returns true if doing null-fill on outer relation */
 #define HJ_FILL_OUTER(hjstate)	((hjstate)->hj_NullInnerTupleSlot != NULL)
@@ -146,6 +190,12 @@ static TupleTableSlot *ExecHashJoinOuterGetTuple(PlanState *outerNode,
 static TupleTableSlot *ExecParallelHashJoinOuterGetTuple(PlanState *outerNode,
 														 HashJoinState *hjstate,
 														 uint32 *hashvalue);
+static TupleTableSlot *ExecHashJoinFetchOuter(PlanState *outerNode,
+											  HashJoinState *hjstate);
+static bool ExecHashJoinReverseRoles(HashJoinState *hjstate);
+static TupleTableSlot *ExecHashJoinReversedProbe(HashJoinState *hjstate);
+static bool ExecHashJoinNextInner(HashJoinState *hjstate);
+static void ExecHashJoinFreeReversal(HashJoinState *hjstate);
 static TupleTableSlot *ExecHashJoinGetSavedTuple(HashJoinState *hjstate,
 												 BufFile *file,
 												 uint32 *hashvalue,
@@ -348,8 +398,31 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				 * arrived too late.
 				 */
 				hashNode->hashtable = hashtable;
+
+				/*
+				 * GPDB: if the inner side turns out much larger than
+				 * estimated, let the build stop before it spills, so that
+				 * the sides can be swapped if the outer side is small.  That
+				 * means reading the outer side before the inner one is
+				 * done, which is only safe without motion hazards (see
+				 * above).
+				 */
+				if (gp_enable_hashjoin_role_reversal && !parallel &&
+					!node->prefetch_inner &&
+					node->js.jointype == JOIN_INNER &&
+					!node->hj_nonequijoin && !node->reuse_hashtable)
+					hashNode->hs_pause_tuples =
+						Max(HJ_REVERSE_MIN_UNDERESTIMATE *
+							hashNode->ps.plan->plan_rows, 1);
+
 				(void) MultiExecProcNode((PlanState *) hashNode);
 
+				if (hashNode->hs_paused && ExecHashJoinReverseRoles(node))
+				{
+					node->hj_JoinState = HJ_REVERSED_PROBE;
+					continue;
+				}
+
 #ifdef HJDEBUG
 				elog(gp_workfile_caching_loglevel, "HashJoin built table with %.1f tuples by executing subplan for batch 0", hashtable->totalTuples);
 #endif
@@ -682,6 +755,14 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				node->hj_JoinState = HJ_NEED_NEW_OUTER;
 				break;
 
+			case HJ_REVERSED_PROBE:
+
+				/*
+				 * GPDB: the sides have been swapped, the inner tuples now
+				 * probe the outer ones.
+				 */
+				return ExecHashJoinReversedProbe(node);
+
 			default:
 				elog(ERROR, "unrecognized hashjoin state: %d",
 					 (int) node->hj_JoinState);
@@ -929,6 +1010,29 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	hjstate->hj_HashOperators = node->hashoperators;
 	hjstate->hj_Collations = node->hashcollations;
 
+	/*
+	 * GPDB: set up the runtime filter, if the planner asked for one.  Outer
+	 * rows can only be dropped early if the join drops the unmatched ones,
+	 * and only a scan right below the join is handed the filter, as it has
+	 * to run in the same slice.
+	 */
+	if (node->use_runtime_filter &&
+		(node->join.jointype == JOIN_INNER ||
+		 node->join.jointype == JOIN_SEMI ||
+		 node->join.jointype == JOIN_RIGHT) &&
+		IsA(outerPlanState(hjstate), SeqScanState))
+	{
+		HashJoinRuntimeFilter *filter;
+
+		filter = palloc0(sizeof(HashJoinRuntimeFilter));
+		filter->hjstate = hjstate;
+		filter->econtext = CreateExprContext(estate);
+		filter->mcxt = CurrentMemoryContext;
+
+		((ScanState *) outerPlanState(hjstate))->ss_runtime_filter = filter;
+		((HashState *) innerPlanState(hjstate))->hs_runtime_filter = filter;
+	}
+
 	hjstate->hj_JoinState = HJ_BUILD_HASHTABLE;
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
@@ -960,6 +1064,8 @@ ExecEndHashJoin(HashJoinState *node)
 		node->hj_HashTable = NULL;
 	}
 
+	ExecHashJoinFreeReversal(node);
+
 	/*
 	 * Free the exprcontext
 	 */
@@ -1013,7 +1119,7 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 		if (!TupIsNull(slot))
 			hjstate->hj_FirstOuterTupleSlot = NULL;
 		else
-			slot = ExecProcNode(outerNode);
+			slot = ExecHashJoinFetchOuter(outerNode, hjstate);
 
 		while (!TupIsNull(slot))
 		{
@@ -1043,7 +1149,7 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 			 * That tuple couldn't match because of a NULL, so discard it and
 			 * continue with the next one.
 			 */
-			slot = ExecProcNode(outerNode);
+			slot = ExecHashJoinFetchOuter(outerNode, hjstate);
 		}
 
 #ifdef HJDEBUG
@@ -1158,6 +1264,331 @@ ExecParallelHashJoinOuterGetTuple(PlanState *outerNode,
 	return NULL;
 }
 
+/*
+ * ExecHashJoinFetchOuter
+ *
+ *		get the next tuple of the outer plan node in the first pass: the
+ *		tuples read ahead by ExecHashJoinReverseRoles, if any, come first.
+ */
+static TupleTableSlot *
+ExecHashJoinFetchOuter(PlanState *outerNode, HashJoinState *hjstate)
+{
+	HashJoinReversal *rev = hjstate->hj_Reversal;
+
+	if (rev != NULL)
+	{
+		HashJoinReversalEntry *entry = rev->nextouter;
+
+		Assert(!rev->reversed);
+
+		if (entry != NULL)
+		{
+			rev->nextouter = entry->next;
+			ExecForceStoreMinimalTuple(entry->tuple,
+									   hjstate->hj_OuterTupleSlot,
+									   false);
+			return hjstate->hj_OuterTupleSlot;
+		}
+
+		/* all of them replayed */
+		ExecHashJoinFreeReversal(hjstate);
+	}
+
+	return ExecProcNode(outerNode);
+}
+
+/*
+ * ExecHashJoinReverseRoles
+ *
+ *		GPDB: decide whether to swap the sides of the join, after building
+ *		the hash table stopped early because the inner side is much larger
+ *		than estimated (see hs_pause_tuples).
+ *
+ * The outer side is read ahead as long as the tuples fit in the memory of
+ * the join that the inner hash table leaves.  If the outer side ends first,
+ * its tuples are put in a hash table of their own, and the inner tuples probe
+ * it in HJ_REVERSED_PROBE state: first the ones already in the inner hash
+ * table, which is released then, and then the rest of the inner side, which
+ * never needs to spill.  Otherwise the build is finished as usual, with less
+ * memory until the tuples read ahead have been replayed to the probe.
+ *
+ * Returns true if the sides were swapped.
+ */
+static bool
+ExecHashJoinReverseRoles(HashJoinState *hjstate)
+{
+	HashState  *hashNode = (HashState *) innerPlanState(hjstate);
+	PlanState  *outerNode = outerPlanState(hjstate);
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	ExprContext *econtext = hjstate->js.ps.ps_ExprContext;
+	HashJoinReversal *rev;
+	HashJoinReversalEntry *entry;
+	HashJoinReversalEntry **tail;
+	MemoryContext cxt;
+	MemoryContext oldcxt;
+	TupleTableSlot *slot;
+	Size		budget;
+
+	/* the paused build has accounted for its buckets in spaceUsed */
+	budget = hashtable->spaceAllowed - Min(hashtable->spaceUsed,
+										   hashtable->spaceAllowed);
+
+	cxt = AllocSetContextCreate(CurrentMemoryContext,
+								"HashJoinReversal",
+								ALLOCSET_DEFAULT_SIZES);
+	rev = (HashJoinReversal *) MemoryContextAllocZero(cxt,
+													  sizeof(HashJoinReversal));
+	rev->cxt = cxt;
+	hjstate->hj_Reversal = rev;
+
+	slot = hjstate->hj_FirstOuterTupleSlot;
+	hjstate->hj_FirstOuterTupleSlot = NULL;
+	if (TupIsNull(slot))
+		slot = ExecProcNode(outerNode);
+
+	tail = &rev->outer;
+	while (!TupIsNull(slot))
+	{
+		oldcxt = MemoryContextSwitchTo(cxt);
+		entry = (HashJoinReversalEntry *) palloc0(sizeof(HashJoinReversalEntry));
+		entry->tuple = ExecCopySlotMinimalTuple(slot);
+		MemoryContextSwitchTo(oldcxt);
+
+		*tail = entry;
+		tail = &entry->next;
+		rev->nouter++;
+
+		if (MemoryContextMemAllocated(cxt, false) > budget)
+			break;
+
+		slot = ExecProcNode(outerNode);
+	}
+
+	if (!TupIsNull(slot))
+	{
+		/*
+		 * The outer side is large too, finish the build and replay.  The
+		 * tuples read ahead count against the memory of the hash table until
+		 * then (see ExecHashJoinFreeReversal).
+		 */
+		rev->nextouter = rev->outer;
+		rev->space = Min(MemoryContextMemAllocated(cxt, false),
+						 hashtable->spaceAllowed);
+		hashtable->spaceAllowed -= rev->space;
+		(void) MultiExecProcNode((PlanState *) hashNode);
+
+		return false;
+	}
+
+	/* hash the outer tuples */
+	rev->nbuckets = 1 << my_log2(Max(rev->nouter, 1));
+	rev->buckets = (HashJoinReversalEntry **)
+		MemoryContextAllocZero(cxt,
+							   rev->nbuckets * sizeof(HashJoinReversalEntry *));
+
+	for (entry = rev->outer; entry != NULL; entry = entry->next)
+	{
+		bool		hashkeys_null = false;
+		int			bucketno;
+
+		ExecForceStoreMinimalTuple(entry->tuple, hjstate->hj_OuterTupleSlot,
+								   false);
+		econtext->ecxt_outertuple = hjstate->hj_OuterTupleSlot;
+
+		/* a tuple with a NULL key can't match */
+		if (!ExecHashGetHashValue(hashNode, hashtable, econtext,
+								  hjstate->hj_OuterHashKeys,
+								  true,	/* outer tuple */
+								  false,
+								  &entry->hashvalue,
+								  &hashkeys_null))
+			continue;
+
+		bucketno = entry->hashvalue & (rev->nbuckets - 1);
+		entry->chain = rev->buckets[bucketno];
+		rev->buckets[bucketno] = entry;
+	}
+	ExecClearTuple(hjstate->hj_OuterTupleSlot);
+
+	rev->reversed = true;
+	rev->innerdone = (rev->nouter == 0);
+
+	/* the build is never finished, so the runtime filter can't be used */
+	if (hashNode->hs_runtime_filter)
+		hashNode->hs_runtime_filter->disabled = true;
+
+	SIMPLE_FAULT_INJECTOR("hashjoin_reverse_roles");
+
+#ifdef HJDEBUG
+	elog(gp_workfile_caching_loglevel, "HashJoin swapped its sides after %.1f inner tuples and %d outer tuples", hashtable->totalTuples, rev->nouter);
+#endif
+
+	return true;
+}
+
+/*
+ * ExecHashJoinReversedProbe
+ *
+ *		GPDB: return the next joined tuple of a hash join whose sides were
+ *		swapped, or NULL at the end of the join.
+ */
+static TupleTableSlot *
+ExecHashJoinReversedProbe(HashJoinState *hjstate)
+{
+	HashJoinReversal *rev = hjstate->hj_Reversal;
+	ExprContext *econtext = hjstate->js.ps.ps_ExprContext;
+	ExprState  *joinqual = hjstate->js.joinqual;
+	ExprState  *otherqual = hjstate->js.ps.qual;
+
+	for (;;)
+	{
+		CHECK_FOR_INTERRUPTS();
+
+		/* match the current inner tuple against the outer tuples */
+		while (rev->curouter != NULL)
+		{
+			HashJoinReversalEntry *entry = rev->curouter;
+
+			rev->curouter = entry->chain;
+			if (entry->hashvalue != rev->innerhash)
+				continue;
+
+			ExecForceStoreMinimalTuple(entry->tuple,
+									   hjstate->hj_OuterTupleSlot,
+									   false);
+			econtext->ecxt_outertuple = hjstate->hj_OuterTupleSlot;
+			econtext->ecxt_innertuple = rev->innerslot;
+
+			if (!ExecQualAndReset(hjstate->hashqualclauses, econtext))
+				continue;
+
+			if (joinqual == NULL || ExecQual(joinqual, econtext))
+			{
+				if (otherqual == NULL || ExecQual(otherqual, econtext))
+					return ExecProject(hjstate->js.ps.ps_ProjInfo);
+				else
+					InstrCountFiltered2(hjstate, 1);
+			}
+			else
+				InstrCountFiltered1(hjstate, 1);
+		}
+
+		if (!ExecHashJoinNextInner(hjstate))
+			return NULL;
+
+		rev->curouter = rev->buckets[rev->innerhash & (rev->nbuckets - 1)];
+	}
+}
+
+/*
+ * ExecHashJoinNextInner
+ *
+ *		GPDB: advance to the next inner tuple of a hash join whose sides were
+ *		swapped, and store it and its hash value in the reversal state.  The
+ *		tuples already in the hash table come first, then the tuple the build
+ *		stopped at, then the rest of the inner side.  Returns false at the
+ *		end of the inner side.
+ */
+static bool
+ExecHashJoinNextInner(HashJoinState *hjstate)
+{
+	HashJoinReversal *rev = hjstate->hj_Reversal;
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	HashState  *hashNode = (HashState *) innerPlanState(hjstate);
+	ExprContext *econtext = hashNode->ps.ps_ExprContext;
+	TupleTableSlot *slot;
+
+	if (rev->innerdone)
+		return false;
+
+	while (rev->curinner == NULL &&
+		   rev->curbucket < hashtable->nSkewBuckets + hashtable->nbuckets)
+	{
+		if (rev->curbucket < hashtable->nSkewBuckets)
+		{
+			int			skewbucket = hashtable->skewBucketNums[rev->curbucket];
+
+			rev->curinner = hashtable->skewBucket[skewbucket]->tuples;
+		}
+		else
+			rev->curinner = hashtable->buckets.unshared[rev->curbucket -
+														hashtable->nSkewBuckets];
+		rev->curbucket++;
+	}
+
+	if (rev->curinner != NULL)
+	{
+		HashJoinTuple hashTuple = rev->curinner;
+
+		rev->curinner = hashTuple->next.unshared;
+		rev->innerhash = hashTuple->hashvalue;
+		rev->innerslot = ExecStoreMinimalTuple(HJTUPLE_MINTUPLE(hashTuple),
+											   hjstate->hj_HashTupleSlot,
+											   false);
+		return true;
+	}
+
+	/* all the tuples in the hash table have been probed, release them */
+	if (hashtable->buckets.unshared != NULL)
+	{
+		ExecClearTuple(hjstate->hj_HashTupleSlot);
+		ExecHashTableReleaseTuples(hashtable);
+	}
+
+	for (;;)
+	{
+		bool		hashkeys_null = false;
+
+		if (hashNode->hs_paused)
+		{
+			slot = hashNode->hs_paused_slot;
+			hashNode->hs_paused = false;
+			hashNode->hs_paused_slot = NULL;
+		}
+		else
+			slot = ExecProcNode(outerPlanState(hashNode));
+
+		if (TupIsNull(slot))
+		{
+			rev->innerdone = true;
+			return false;
+		}
+
+		econtext->ecxt_outertuple = slot;
+		if (ExecHashGetHashValue(hashNode, hashtable, econtext,
+								 hashNode->hashkeys,
+								 false,	/* inner tuple */
+								 false,
+								 &rev->innerhash,
+								 &hashkeys_null))
+		{
+			rev->innerslot = slot;
+			return true;
+		}
+	}
+}
+
+/*
+ * ExecHashJoinFreeReversal
+ *
+ *		GPDB: release the outer tuples read ahead, if any, and give the
+ *		memory they took back to the hash table.
+ */
+static void
+ExecHashJoinFreeReversal(HashJoinState *hjstate)
+{
+	if (hjstate->hj_Reversal == NULL)
+		return;
+
+	if (hjstate->hj_HashTable != NULL)
+		hjstate->hj_HashTable->spaceAllowed += hjstate->hj_Reversal->space;
+
+	/* the outer tuple slot may still point to one of them */
+	ExecClearTuple(hjstate->hj_OuterTupleSlot);
+	MemoryContextDelete(hjstate->hj_Reversal->cxt);
+	hjstate->hj_Reversal = NULL;
+}
+
 /*
  * ExecHashJoinNewBatch
  *		switch to a new hashjoin batch
@@ -1598,7 +2029,8 @@ ExecReScanHashJoin(HashJoinState *node)
 		node->hj_HashTable->first_pass = false;
 
 		if (node->js.ps.righttree->chgParam == NULL &&
-			!node->hj_HashTable->eagerlyReleased)
+			!node->hj_HashTable->eagerlyReleased &&
+			(node->hj_Reversal == NULL || !node->hj_Reversal->reversed))
 		{
 			/*
 			 * Okay to reuse the hash table; needn't rescan inner, either.
@@ -1673,6 +2105,9 @@ ExecReScanHashJoin(HashJoinState *node)
 				ExecReScan(node->js.ps.righttree);
 	}
 
+	/* GPDB: the outer tuples read ahead are stale now */
+	ExecHashJoinFreeReversal(node);
+
 	/* Always reset intra-tuple state */
 	node->hj_CurHashValue = 0;
 	node->hj_CurBucketNo = 0;
@@ -1714,6 +2149,8 @@ ReleaseHashTable(HashJoinState *node)
 		node->hj_HashTable->eagerlyReleased = true;
 	}
 
+	ExecHashJoinFreeReversal(node);
+
 	/* Always reset intra-tuple state */
 	node->hj_CurHashValue = 0;
 	node->hj_CurBucketNo = 0;
@@ -29,12 +29,17 @@
 
 #include "access/relscan.h"
 #include "access/tableam.h"
+#include "executor/execBatch.h"
 #include "executor/execdebug.h"
+#include "executor/nodeHash.h"
 #include "executor/nodeSeqscan.h"
 #include "utils/rel.h"
 #include "nodes/nodeFuncs.h"
+#include "utils/guc.h"
 
 static TupleTableSlot *SeqNext(SeqScanState *node);
+static TupleTableSlot *SeqNextBatch(SeqScanState *node);
+static ColumnBatch *SeqFetchBatch(SeqScanState *node);
 
 /* ----------------------------------------------------------------
  *						Scan Support
@@ -91,6 +96,116 @@ SeqNext(SeqScanState *node)
 	return NULL;
 }
 
+/* ----------------------------------------------------------------
+ *		SeqFetchBatch
+ *
+ *		GPDB: fetch the next batch of rows from the table AM, and
+ *		evaluate on it the quals that can be evaluated on whole batches.
+ *		Returns NULL at the end of the scan.
+ * ----------------------------------------------------------------
+ */
+static ColumnBatch *
+SeqFetchBatch(SeqScanState *node)
+{
+	ColumnBatch *batch = node->batch;
+	EState	   *estate = node->ss.ps.state;
+	int			nvisible;
+
+	/* see SeqNext */
+	if (node->ss.ss_currentScanDesc == NULL)
+		node->ss.ss_currentScanDesc =
+			table_beginscan_es(node->ss.ss_currentRelation,
+							   estate->es_snapshot,
+							   node->ss.ps.plan->targetlist,
+							   node->ss.ps.plan->qual,
+							   NULL,
+							   NULL);
+
+	do
+	{
+		if (!table_scan_getnextbatch(node->ss.ss_currentScanDesc,
+									 estate->es_direction,
+									 batch))
+		{
+			batch->nsel = 0;
+			node->batch_pos = 0;
+			return NULL;
+		}
+
+		nvisible = batch->nsel;
+		if (node->batch_qual != NULL)
+			ExecBatchQual(node->batch_qual, batch);
+		InstrCountFiltered1(node, nvisible - batch->nsel);
+	} while (batch->nsel == 0);
+
+	node->batch_pos = 0;
+
+	return batch;
+}
+
+/* ----------------------------------------------------------------
+ *		SeqNextBatch
+ *
+ *		GPDB: SeqNext for batch mode.  The rows selected in each batch
+ *		are stored in the scan slot one by one.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+SeqNextBatch(SeqScanState *node)
+{
+	ColumnBatch *batch = node->batch;
+	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+
+	if (node->batch_pos >= batch->nsel && SeqFetchBatch(node) == NULL)
+		return NULL;
+
+	ExecStoreBatchRow(batch, batch->sel[node->batch_pos++], slot);
+	slot->tts_tableOid = RelationGetRelid(node->ss.ss_currentRelation);
+
+	return slot;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecSeqScanNextBatch
+ *
+ *		GPDB: ExecProcNode for parents that consume whole batches, such
+ *		as hashed aggregation.  Returns the next batch of rows, or NULL at
+ *		the end of the scan; the caller consumes all of the rows selected.
+ *
+ *		Only valid in batch mode with no quals left to evaluate on single
+ *		rows.  The rows are not projected; the caller finds its input
+ *		columns in the batch through the plan's targetlist.
+ * ----------------------------------------------------------------
+ */
+ColumnBatch *
+ExecSeqScanNextBatch(SeqScanState *node)
+{
+	ColumnBatch *batch;
+
+	Assert(node->batch != NULL);
+	Assert(node->ss.ps.qual == NULL);
+	Assert(node->ss.ss_runtime_filter == NULL);
+
+	CHECK_FOR_INTERRUPTS();
+
+	/* same as ExecProcNode */
+	if (node->ss.ps.chgParam != NULL)
+		ExecReScan((PlanState *) node);
+
+	if (node->ss.ps.instrument)
+		InstrStartNode(node->ss.ps.instrument);
+
+	batch = SeqFetchBatch(node);
+	if (batch != NULL)
+		node->batch_pos = batch->nsel;
+
+	if (node->ss.ps.instrument)
+		InstrStopNode(node->ss.ps.instrument,
+					  batch != NULL ? batch->nsel : 0);
+
+	return batch;
+}
+
 /*
  * SeqRecheck -- access method routine to recheck a tuple in EvalPlanQual
  */
@@ -117,10 +232,32 @@ static TupleTableSlot *
 ExecSeqScan(PlanState *pstate)
 {
 	SeqScanState *node = castNode(SeqScanState, pstate);
+	TupleTableSlot *slot;
+	ExecScanAccessMtd accessMtd;
 
-	return ExecScan(&node->ss,
-					(ExecScanAccessMtd) SeqNext,
-					(ExecScanRecheckMtd) SeqRecheck);
+	if (node->batch != NULL)
+		accessMtd = (ExecScanAccessMtd) SeqNextBatch;
+	else
+		accessMtd = (ExecScanAccessMtd) SeqNext;
+
+	if (node->ss.ss_runtime_filter == NULL)
+		return ExecScan(&node->ss,
+						accessMtd,
+						(ExecScanRecheckMtd) SeqRecheck);
+
+	/* GPDB: skip the rows the hash join above us would not find a match for */
+	for (;;)
+	{
+		slot = ExecScan(&node->ss,
+						accessMtd,
+						(ExecScanRecheckMtd) SeqRecheck);
+
+		if (TupIsNull(slot) ||
+			ExecHashRuntimeFilterPasses(node->ss.ss_runtime_filter, slot))
+			return slot;
+
+		InstrCountFiltered2(node, 1);
+	}
 }
 
 /* ----------------------------------------------------------------
@@ -146,6 +283,7 @@ ExecInitSeqScanForPartition(SeqScan *node, EState *estate,
 							Relation currentRelation)
 {
 	SeqScanState *scanstate;
+	List	   *qual = node->plan.qual;
 
 	/*
 	 * Once upon a time it was possible to have an outerPlan of a SeqScan, but
@@ -185,11 +323,27 @@ ExecInitSeqScanForPartition(SeqScan *node, EState *estate,
 	ExecInitResultTypeTL(&scanstate->ss.ps);
 	ExecAssignScanProjectionInfo(&scanstate->ss);
 
+	/*
+	 * GPDB: if the table AM can return batches of rows, read the table a
+	 * batch at a time.  Evaluate as much of the qual as possible on whole
+	 * batches, and only the rest on each row selected.  EvalPlanQual
+	 * rechecks need the whole qual on a single row.
+	 */
+	if (gp_enable_vectorized_scan &&
+		currentRelation->rd_tableam->scan_getnextbatch != NULL &&
+		!node->plan.parallel_aware && estate->es_epq_active == NULL)
+	{
+		TupleDesc	tupdesc = RelationGetDescr(currentRelation);
+
+		scanstate->batch = MakeColumnBatch(tupdesc);
+		scanstate->batch_qual = ExecInitBatchQual(qual, tupdesc, &qual);
+	}
+
 	/*
 	 * initialize child expressions
 	 */
 	scanstate->ss.ps.qual =
-		ExecInitQual(node->plan.qual, (PlanState *) scanstate);
+		ExecInitQual(qual, (PlanState *) scanstate);
 
 	return scanstate;
 }
@@ -251,6 +405,13 @@ ExecReScanSeqScan(SeqScanState *node)
 		table_rescan(scan,		/* scan desc */
 					 NULL);		/* new scan keys */
 
+	/* GPDB: forget the rows of the current batch */
+	if (node->batch != NULL)
+	{
+		node->batch->nsel = 0;
+		node->batch_pos = 0;
+	}
+
 	ExecScanReScan((ScanState *) node);
 }
 
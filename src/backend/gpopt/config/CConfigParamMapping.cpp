@@ -81,6 +81,10 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT("Prints optimization stats.")},
 
+	{EopttraceProfileOptimization, &optimizer_explain_profile,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Collects a profile of the optimization.")},
+
 	{EopttraceMinidump,
 	 // GPDB_91_MERGE_FIXME: I turned optimizer_minidump from bool into
 	 // an enum-type GUC. It's a bit dirty to cast it like this..
@@ -275,6 +279,16 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT("Disable ordered aggregate plans.")},
 
+	{EopttraceEnableRuntimeJoinFilter, &optimizer_enable_runtime_join_filter,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Push runtime filters of inner hash joins into outer table scans.")},
+
+	{EopttraceEnableInnerLeftMergeJoin, &optimizer_enable_inner_left_mergejoin,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Enable merge join alternatives of inner and left outer joins.")},
+
 	{EopttraceExpandFullJoin, &optimizer_expand_fulljoin,
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT(
@@ -481,6 +495,10 @@ CConfigParamMapping::PackConfigParamInBitset(
 	{
 		traceflag_bitset->ExchangeSet(
 			GPOPT_DISABLE_XFORM_TF(CXform::ExfImplementFullOuterMergeJoin));
+		traceflag_bitset->ExchangeSet(
+			GPOPT_DISABLE_XFORM_TF(CXform::ExfInnerJoin2MergeJoin));
+		traceflag_bitset->ExchangeSet(
+			GPOPT_DISABLE_XFORM_TF(CXform::ExfLeftOuterJoin2MergeJoin));
 	}
 
 	CBitSet *join_heuristic_bitset = nullptr;
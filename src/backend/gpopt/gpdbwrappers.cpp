@@ -36,6 +36,8 @@ extern "C" {
 #include "access/amapi.h"
 #include "access/external.h"
 #include "access/genam.h"
+#include "access/tupconvert.h"
+#include "catalog/partition.h"
 #include "catalog/pg_inherits.h"
 #include "foreign/fdwapi.h"
 #include "nodes/nodeFuncs.h"
@@ -2236,6 +2238,32 @@ gpdb::EvaluateExpr(Expr *expr, Oid result_type, int32 typmod)
 	return nullptr;
 }
 
+// Evaluates the constant expressions in 'exprs' and returns the results as a
+// list of Consts. Caller keeps ownership of 'exprs' and takes ownership of
+// the result
+List *
+gpdb::EvaluateExprs(List *exprs)
+{
+	GP_WRAP_START;
+	{
+		return evaluate_expr_list(exprs);
+	}
+	GP_WRAP_END;
+	return NIL;
+}
+
+void
+gpdb::SetHashSkewValues(Hash *hash)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic */
+		set_hash_skew_values(hash);
+		return;
+	}
+	GP_WRAP_END;
+}
+
 char *
 gpdb::DefGetString(DefElem *defelem)
 {
@@ -2284,16 +2312,18 @@ gpdb::InjectFaultInOptTasks(const char *fault_name)
 #endif
 
 /*
- * To detect changes to catalog tables that require resetting the Metadata
+ * To detect changes to catalog tables that require invalidating the Metadata
  * Cache, we use the normal PostgreSQL catalog cache invalidation mechanism.
  * We register a callback to a cache on all the catalog tables that contain
  * information that's contained in the ORCA metadata cache.
-
- * There is no fine-grained mechanism in the metadata cache for invalidating
- * individual entries ATM, so we just blow the whole cache whenever anything
- * changes. The callback simply increments a counter. Whenever we start
- * planning a query, we check the counter to see if it has changed since the
- * last planned query, and reset the whole cache if it has.
+ *
+ * The callbacks remember which relations, and which pg_type, pg_constraint
+ * and pg_statistic entries were changed, so that only the dependent metadata
+ * cache entries need to be evicted. Changes to the other catalog tables are
+ * rare, and we just blow the whole cache whenever one of them changes, as we
+ * do when too many changes pile up between two planned queries. Whenever we
+ * start planning a query, MDCacheNeedsReset() collects the changes since the
+ * last planned query.
  *
  * To make sure we've covered all catalog tables that contain information
  * that's stored in the metadata cache, there are "catalog tables: xxx"
@@ -2302,21 +2332,102 @@ gpdb::InjectFaultInOptTasks(const char *fault_name)
  * anything fetched via the wrapper functions in this file can end up in the
  * metadata cache and hence need to have an invalidation callback registered.
  */
-static bool mdcache_invalidation_counter_registered = false;
-static int64 mdcache_invalidation_counter = 0;
-static int64 last_mdcache_invalidation_counter = 0;
+#define MDCACHE_MAX_PENDING_INVALIDATIONS 256
+
+/*
+ * A change to a catalog entry: the syscache id and hash value of the entry,
+ * or InvalidSysCacheID and the OID of a relation for a relcache invalidation.
+ */
+#define InvalidSysCacheID (-1)
+
+typedef struct MDCacheInvalidation
+{
+	int cacheid;
+	uint32 key;
+} MDCacheInvalidation;
+
+static bool mdcache_invalidation_callbacks_registered = false;
+
+/* changes received since the last call of MDCacheNeedsReset() */
+static bool mdcache_reset_pending = false;
+static int mdcache_num_pending_invalidations = 0;
+static MDCacheInvalidation
+	mdcache_pending_invalidations[MDCACHE_MAX_PENDING_INVALIDATIONS];
+
+/* changes collected by the last call of MDCacheNeedsReset() */
+static int mdcache_num_invalidations = 0;
+static MDCacheInvalidation
+	mdcache_invalidations[MDCACHE_MAX_PENDING_INVALIDATIONS];
+
+static void
+mdcache_add_pending_invalidation(int cacheid, uint32 key)
+{
+	int i;
+
+	for (i = 0; i < mdcache_num_pending_invalidations; i++)
+	{
+		if (mdcache_pending_invalidations[i].cacheid == cacheid &&
+			mdcache_pending_invalidations[i].key == key)
+		{
+			return;
+		}
+	}
+
+	if (mdcache_num_pending_invalidations == MDCACHE_MAX_PENDING_INVALIDATIONS)
+	{
+		mdcache_reset_pending = true;
+		return;
+	}
+
+	mdcache_pending_invalidations[i].cacheid = cacheid;
+	mdcache_pending_invalidations[i].key = key;
+	mdcache_num_pending_invalidations++;
+}
+
+static bool
+mdcache_has_invalidation(int cacheid, uint32 key)
+{
+	for (int i = 0; i < mdcache_num_invalidations; i++)
+	{
+		if (mdcache_invalidations[i].cacheid == cacheid &&
+			mdcache_invalidations[i].key == key)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
 
 static void
-mdsyscache_invalidation_counter_callback(Datum arg, int cacheid,
-										 uint32 hashvalue)
+mdsyscache_invalidation_callback(Datum arg, int cacheid, uint32 hashvalue)
 {
-	mdcache_invalidation_counter++;
+	/*
+	 * A zero hash value means that the whole syscache was flushed. Changes
+	 * to catalog tables other than these can't be traced back to individual
+	 * metadata cache entries.
+	 */
+	if (hashvalue == 0 || (cacheid != TYPEOID && cacheid != CONSTROID &&
+						   cacheid != STATRELATTINH))
+	{
+		mdcache_reset_pending = true;
+		return;
+	}
+
+	mdcache_add_pending_invalidation(cacheid, hashvalue);
 }
 
 static void
-mdrelcache_invalidation_counter_callback(Datum arg, Oid relid)
+mdrelcache_invalidation_callback(Datum arg, Oid relid)
 {
-	mdcache_invalidation_counter++;
+	/* InvalidOid means that the whole relcache was flushed */
+	if (!OidIsValid(relid))
+	{
+		mdcache_reset_pending = true;
+		return;
+	}
+
+	mdcache_add_pending_invalidation(InvalidSysCacheID, relid);
 }
 
 static void
@@ -2375,38 +2486,156 @@ register_mdcache_invalidation_callbacks(void)
 	for (i = 0; i < lengthof(metadata_caches); i++)
 	{
 		CacheRegisterSyscacheCallback(metadata_caches[i],
-									  &mdsyscache_invalidation_counter_callback,
+									  &mdsyscache_invalidation_callback,
 									  (Datum) 0);
 	}
 
 	/* also register the relcache callback */
-	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_counter_callback,
+	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_callback,
 								  (Datum) 0);
 }
 
-// Has there been any catalog changes since last call?
+// Collect the catalog changes since last call. Returns true if the whole
+// metadata cache needs to be reset.
 bool
-gpdb::MDCacheNeedsReset(void)
+gpdb::MDCacheNeedsReset(bool *has_invalidations)
 {
 	GP_WRAP_START;
 	{
-		if (!mdcache_invalidation_counter_registered)
+		*has_invalidations = false;
+		mdcache_num_invalidations = 0;
+
+		if (!mdcache_invalidation_callbacks_registered)
 		{
 			register_mdcache_invalidation_callbacks();
-			mdcache_invalidation_counter_registered = true;
+			mdcache_invalidation_callbacks_registered = true;
 		}
-		if (last_mdcache_invalidation_counter == mdcache_invalidation_counter)
+
+		if (mdcache_reset_pending)
 		{
-			return false;
+			mdcache_reset_pending = false;
+			mdcache_num_pending_invalidations = 0;
+			return true;
 		}
-		else
+
+		/*
+		 * The statistics of a partitioned table cover its partitions, so a
+		 * change to a partition also invalidates all of its ancestors.
+		 * Dropped and detached partitions invalidate their parent anyway.
+		 */
+		int num_pending = mdcache_num_pending_invalidations;
+		for (int i = 0; i < num_pending; i++)
+		{
+			MDCacheInvalidation *inval = &mdcache_pending_invalidations[i];
+			if (inval->cacheid != InvalidSysCacheID ||
+				!get_rel_relispartition(inval->key))
+			{
+				continue;
+			}
+
+			/* catalog tables: pg_inherits */
+			List *ancestors = get_partition_ancestors(inval->key);
+			ListCell *lc;
+			foreach (lc, ancestors)
+			{
+				mdcache_add_pending_invalidation(InvalidSysCacheID,
+												 lfirst_oid(lc));
+			}
+			list_free(ancestors);
+		}
+
+		if (mdcache_reset_pending)
 		{
-			last_mdcache_invalidation_counter = mdcache_invalidation_counter;
+			mdcache_reset_pending = false;
+			mdcache_num_pending_invalidations = 0;
 			return true;
 		}
+
+		memcpy(mdcache_invalidations, mdcache_pending_invalidations,
+			   mdcache_num_pending_invalidations *
+				   sizeof(MDCacheInvalidation));
+		mdcache_num_invalidations = mdcache_num_pending_invalidations;
+		mdcache_num_pending_invalidations = 0;
+
+		*has_invalidations = (0 < mdcache_num_invalidations);
+		return false;
+	}
+	GP_WRAP_END;
+
+	return true;
+}
+
+// Was the given relation changed?
+bool
+gpdb::MDCacheRelationInvalidated(Oid relid)
+{
+	return mdcache_has_invalidation(InvalidSysCacheID, relid);
+}
+
+// Was the pg_type entry of the given type changed?
+bool
+gpdb::MDCacheTypeInvalidated(Oid type_oid)
+{
+	GP_WRAP_START;
+	{
+		return mdcache_has_invalidation(
+			TYPEOID,
+			GetSysCacheHashValue1(TYPEOID, ObjectIdGetDatum(type_oid)));
+	}
+	GP_WRAP_END;
+	return true;
+}
+
+// Was the pg_constraint entry of the given constraint changed?
+bool
+gpdb::MDCacheConstraintInvalidated(Oid constraint_oid)
+{
+	GP_WRAP_START;
+	{
+		return mdcache_has_invalidation(
+			CONSTROID,
+			GetSysCacheHashValue1(CONSTROID, ObjectIdGetDatum(constraint_oid)));
 	}
 	GP_WRAP_END;
+	return true;
+}
+
+// Were the statistics of any column of the given relation changed?
+bool
+gpdb::MDCacheColStatsInvalidated(Oid relid)
+{
+	GP_WRAP_START;
+	{
+		if (mdcache_has_invalidation(InvalidSysCacheID, relid))
+		{
+			return true;
+		}
+
+		/* catalog tables: pg_class */
+		AttrNumber natts = 0;
+		HeapTuple tuple = SearchSysCache1(RELOID, ObjectIdGetDatum(relid));
+		if (HeapTupleIsValid(tuple))
+		{
+			natts = ((Form_pg_class) GETSTRUCT(tuple))->relnatts;
+			ReleaseSysCache(tuple);
+		}
 
+		for (AttrNumber attno = 1; attno <= natts; attno++)
+		{
+			for (int inh = 0; inh <= 1; inh++)
+			{
+				uint32 hashvalue = GetSysCacheHashValue3(
+					STATRELATTINH, ObjectIdGetDatum(relid),
+					Int16GetDatum(attno), BoolGetDatum(inh));
+				if (mdcache_has_invalidation(STATRELATTINH, hashvalue))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+	GP_WRAP_END;
 	return true;
 }
 
@@ -2517,15 +2746,15 @@ gpdb::GPDBMemoryContextDelete(MemoryContext context)
 }
 
 MemoryContext
-gpdb::GPDBAllocSetContextCreate()
+gpdb::GPDBAllocSetContextCreate(Size init_block_size, Size max_block_size)
 {
 	GP_WRAP_START;
 	{
 		MemoryContext cxt;
 
-		cxt =
-			AllocSetContextCreate(OptimizerMemoryContext, "GPORCA memory pool",
-								  ALLOCSET_DEFAULT_SIZES);
+		cxt = AllocSetContextCreate(OptimizerMemoryContext, "GPORCA memory pool",
+									ALLOCSET_DEFAULT_MINSIZE, init_block_size,
+									max_block_size);
 		/*
 		 * Declare it as accounting root so that we can call
 		 * MemoryContextGetCurrentSpace() on it.
@@ -2548,23 +2777,6 @@ gpdb::ExpressionReturnsSet(Node *clause)
 	GP_WRAP_END;
 }
 
-List *
-gpdb::GetRelChildIndexes(Oid reloid)
-{
-	List *partoids = NIL;
-	GP_WRAP_START;
-	{
-		if (InvalidOid == reloid)
-		{
-			return NIL;
-		}
-		partoids = find_inheritance_children(reloid, NoLock);
-	}
-	GP_WRAP_END;
-
-	return partoids;
-}
-
 Oid
 gpdb::GetForeignServerId(Oid reloid)
 {
@@ -2743,6 +2955,25 @@ gpdb::GPDBRelationRetrievePartitionKey(Relation rel)
 	GP_WRAP_END;
 }
 
+AttrNumber
+gpdb::GetPartitionRootAttno(Relation root_rel, Relation part_rel,
+							AttrNumber attno)
+{
+	GP_WRAP_START;
+	{
+		/* the same attribute map as map_partition_varattnos() uses */
+		AttrNumber *attr_map = convert_tuples_by_name_map(
+			RelationGetDescr(root_rel), RelationGetDescr(part_rel),
+			gettext_noop("could not convert row type"));
+		AttrNumber root_attno = attr_map[attno - 1];
+
+		pfree(attr_map);
+		return root_attno;
+	}
+	GP_WRAP_END;
+	return InvalidAttrNumber;
+}
+
 bool
 gpdb::TestexprIsHashable(Node *testexpr, List *param_ids)
 {
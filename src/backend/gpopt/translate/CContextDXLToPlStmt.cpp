@@ -57,10 +57,12 @@ CContextDXLToPlStmt::CContextDXLToPlStmt(
 	  m_result_relation_index(0),
 	  m_into_clause(nullptr),
 	  m_distribution_policy(nullptr),
-	  m_part_selector_to_param_map(nullptr)
+	  m_part_selector_to_param_map(nullptr),
+	  m_colid_to_attno_map(nullptr)
 {
 	m_cte_consumer_info = GPOS_NEW(m_mp) HMUlCTEConsumerInfo(m_mp);
 	m_part_selector_to_param_map = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
+	m_colid_to_attno_map = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
 	m_used_rte_indexes = GPOS_NEW(m_mp) HMUlIndex(m_mp);
 }
 
@@ -76,6 +78,7 @@ CContextDXLToPlStmt::~CContextDXLToPlStmt()
 {
 	m_cte_consumer_info->Release();
 	m_part_selector_to_param_map->Release();
+	m_colid_to_attno_map->Release();
 	m_used_rte_indexes->Release();
 }
 
@@ -485,6 +488,48 @@ CContextDXLToPlStmt::GetParamIdForSelector(OID oid_type, ULONG selectorId)
 	return *param_id;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::AddColIdAttno
+//
+//	@doc:
+//		Record the table attno of a column of a scanned table. Partition
+//		selectors use it to find out which level of a partitioned table a
+//		filter on a column of the dynamic scan prunes
+//
+//---------------------------------------------------------------------------
+void
+CContextDXLToPlStmt::AddColIdAttno(ULONG colid, INT attno)
+{
+	if (0 >= attno || nullptr != m_colid_to_attno_map->Find(&colid))
+	{
+		return;
+	}
+
+	m_colid_to_attno_map->Insert(GPOS_NEW(m_mp) ULONG(colid),
+								 GPOS_NEW(m_mp) ULONG(attno));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CContextDXLToPlStmt::GetAttnoForColId
+//
+//	@doc:
+//		Table attno of a column of a scanned table
+//
+//---------------------------------------------------------------------------
+AttrNumber
+CContextDXLToPlStmt::GetAttnoForColId(ULONG colid) const
+{
+	const ULONG *attno = m_colid_to_attno_map->Find(&colid);
+	if (nullptr == attno)
+	{
+		return InvalidAttrNumber;
+	}
+
+	return (AttrNumber) *attno;
+}
+
 Index
 CContextDXLToPlStmt::FindRTE(Oid reloid)
 {
@@ -24,40 +24,59 @@ extern "C" {
 #include "naucrates/dxl/operators/CDXLScalarBoolExpr.h"
 #include "naucrates/dxl/operators/CDXLScalarCast.h"
 #include "naucrates/dxl/operators/CDXLScalarComp.h"
+#include "naucrates/dxl/operators/CDXLScalarIdent.h"
 #include "naucrates/exception.h"
 
 using namespace gpdxl;
 
 // ctor
 CPartPruneStepsBuilder::CPartPruneStepsBuilder(
-	Relation relation, Index rtindex, ULongPtrArray *part_indexes,
-	CMappingColIdVarPlStmt *colid_var_mapping,
-	CTranslatorDXLToScalar *translator_dxl_to_scalar)
-	: m_relation(relation),
-	  m_rtindex(rtindex),
-	  m_part_indexes(part_indexes),
+	ULongPtrArray *part_indexes, CMappingColIdVarPlStmt *colid_var_mapping,
+	CTranslatorDXLToScalar *translator_dxl_to_scalar,
+	CContextDXLToPlStmt *dxl_to_plstmt_context, Relation root_relation,
+	INT lockmode)
+	: m_part_indexes(part_indexes),
 	  m_colid_var_mapping(colid_var_mapping),
-	  m_translator_dxl_to_scalar(translator_dxl_to_scalar)
+	  m_translator_dxl_to_scalar(translator_dxl_to_scalar),
+	  m_dxl_to_plstmt_context(dxl_to_plstmt_context),
+	  m_root_relation(root_relation),
+	  m_lockmode(lockmode),
+	  m_is_multi_level(false),
+	  m_leaf_index(0),
+	  m_part_ptr(0)
 {
+	PartitionDesc part_desc =
+		gpdb::GPDBRelationRetrievePartitionDesc(root_relation);
+	for (ULONG i = 0; (int) i < part_desc->nparts; ++i)
+	{
+		if (!part_desc->is_leaf[i])
+		{
+			m_is_multi_level = true;
+			break;
+		}
+	}
 }
 
 List *
 CPartPruneStepsBuilder::CreatePartPruneInfos(
 	CDXLNode *filterNode, Relation relation, Index rtindex,
 	ULongPtrArray *part_indexes, CMappingColIdVarPlStmt *colid_var_mapping,
-	CTranslatorDXLToScalar *translator_dxl_to_scalar)
+	CTranslatorDXLToScalar *translator_dxl_to_scalar,
+	CContextDXLToPlStmt *dxl_to_plstmt_context)
 {
-	CPartPruneStepsBuilder builder(relation, rtindex, part_indexes,
-								   colid_var_mapping, translator_dxl_to_scalar);
+	INT lockmode = dxl_to_plstmt_context->GetRTEByIndex(rtindex)->rellockmode;
+	CPartPruneStepsBuilder builder(part_indexes, colid_var_mapping,
+								   translator_dxl_to_scalar,
+								   dxl_to_plstmt_context, relation, lockmode);
 
 	// See comments over PartitionPruneInfo::prune_infos for more details.
 
-	// ORCA only supports single-level partitioned tables for which only one
-	// list of pruning steps is needed.
-	// So, size of 2nd dimension of (prune_infos) = 1
-	PartitionedRelPruneInfo *pinfo =
-		builder.CreatePartPruneInfoForOneLevel(filterNode);
-	List *prune_info_per_hierarchy = ListMake1(pinfo);
+	// The 2nd dimension of (prune_infos) holds one PartitionedRelPruneInfo
+	// per partitioned table of the hierarchy, the root first and each
+	// partitioned table before its sub-partitioned partitions
+	List *prune_info_per_hierarchy = builder.CreatePartPruneInfoForOneLevel(
+		filterNode, relation, rtindex, 0 /* prune_info_index */);
+	GPOS_ASSERT(builder.m_part_ptr == part_indexes->Size());
 
 	// Since ORCA translates each DynamicTableScan to a different Append node,
 	// there is always only one partition hierarchy per Append/ PartitionSelector
@@ -65,57 +84,246 @@ CPartPruneStepsBuilder::CreatePartPruneInfos(
 	return ListMake1(prune_info_per_hierarchy);
 }
 
-PartitionedRelPruneInfo *
-CPartPruneStepsBuilder::CreatePartPruneInfoForOneLevel(CDXLNode *filterNode)
+// Create the PartitionedRelPruneInfos of the given partitioned table and of
+// its sub-partitioned partitions; prune_info_index is the position of the
+// first one in the list of the hierarchy. Returns NIL for a sub-partitioned
+// table none of whose leaf partitions survived static partition pruning.
+List *
+CPartPruneStepsBuilder::CreatePartPruneInfoForOneLevel(CDXLNode *filterNode,
+														Relation relation,
+														Index rtindex,
+														INT prune_info_index)
 {
+	PartitionDesc part_desc = gpdb::GPDBRelationRetrievePartitionDesc(relation);
+
 	PartitionedRelPruneInfo *pinfo = MakeNode(PartitionedRelPruneInfo);
-	pinfo->rtindex = m_rtindex;
-	pinfo->nparts = gpdb::GPDBRelationRetrievePartitionDesc(m_relation)->nparts;
+	pinfo->rtindex = rtindex;
+	pinfo->nparts = part_desc->nparts;
 
 	pinfo->subpart_map = (int *) palloc(sizeof(int) * pinfo->nparts);
 	pinfo->subplan_map = (int *) palloc(sizeof(int) * pinfo->nparts);
 	pinfo->relid_map = (Oid *) palloc(sizeof(int) * pinfo->nparts);
 
-	// m_part_indexes contains the indexes (into m_relation->rd_partdesc) of the
-	// partitions that survived static partition pruning; iterate over this list
-	// to populate pinfo->subplan_map, pinfo->relid_map & pinfo->present_parts
-	ULONG part_ptr = 0;
+	List *prune_infos = ListMake1(pinfo);
+
+	// m_part_indexes contains the indexes (into the leaf partitions of the
+	// hierarchy, depth first in partition bound order) of the leaves that
+	// survived static partition pruning; walk the partitions in that order
+	// to populate pinfo->subplan_map, pinfo->subpart_map, pinfo->relid_map &
+	// pinfo->present_parts
 	for (ULONG i = 0; (int) i < pinfo->nparts; ++i)
 	{
+		Oid part_oid = part_desc->oids[i];
 		pinfo->subpart_map[i] = -1;
-		if (part_ptr < m_part_indexes->Size() &&
-			i == *(*m_part_indexes)[part_ptr])
+		pinfo->subplan_map[i] = -1;
+		pinfo->relid_map[i] = 0;
+
+		gpdb::RelationWrapper part_rel = gpdb::GetRelation(part_oid);
+		if (part_rel->rd_rel->relkind == RELKIND_PARTITIONED_TABLE)
 		{
-			// partition did survive pruning
-			pinfo->subplan_map[i] = part_ptr;
-			pinfo->relid_map[i] =
-				gpdb::GPDBRelationRetrievePartitionDesc(m_relation)->oids[i];
-			pinfo->present_parts = bms_add_member(pinfo->present_parts, i);
-			++part_ptr;
+			// sub-partitioned partition, which survives pruning if any of
+			// its leaf partitions does
+			INT sub_prune_info_index =
+				prune_info_index + gpdb::ListLength(prune_infos);
+			List *sub_prune_infos = CreatePartPruneInfoForOneLevel(
+				filterNode, part_rel.get(), GetPartitionRTIndex(part_rel.get()),
+				sub_prune_info_index);
+			if (NIL == sub_prune_infos)
+			{
+				continue;
+			}
+			pinfo->subpart_map[i] = sub_prune_info_index;
+			prune_infos = gpdb::ListConcat(prune_infos, sub_prune_infos);
 		}
 		else
 		{
-			// partition did not survive pruning
-			pinfo->subplan_map[i] = part_ptr;
-			pinfo->subplan_map[i] = -1;
-			pinfo->relid_map[i] = 0;
+			BOOL survived = m_part_ptr < m_part_indexes->Size() &&
+							m_leaf_index == *(*m_part_indexes)[m_part_ptr];
+			++m_leaf_index;
+			if (!survived)
+			{
+				// partition did not survive pruning
+				continue;
+			}
+			pinfo->subplan_map[i] = m_part_ptr++;
 		}
+
+		// partition did survive pruning
+		pinfo->relid_map[i] = part_oid;
+		pinfo->present_parts = bms_add_member(pinfo->present_parts, i);
+	}
+
+	if (0 < prune_info_index && nullptr == pinfo->present_parts)
+	{
+		return NIL;
+	}
+
+	pinfo->exec_pruning_steps = PartPruneStepsForLevel(filterNode, relation);
+	return prune_infos;
+}
+
+// Find or add the range table entry of a sub-partitioned partition, which
+// the executor opens to prune its partitions
+Index
+CPartPruneStepsBuilder::GetPartitionRTIndex(Relation relation)
+{
+	Oid oid = RelationGetRelid(relation);
+	Index rtindex = m_dxl_to_plstmt_context->FindRTE(oid);
+	if ((Index) -1 != rtindex)
+	{
+		return rtindex;
+	}
+
+	// Since parser locks only root partition, locking the sub-partitioned
+	// partitions we have to prune
+	gpdb::GPDBLockRelationOid(oid, m_lockmode);
+
+	RangeTblEntry *rte = MakeNode(RangeTblEntry);
+	rte->rtekind = RTE_RELATION;
+	rte->relid = oid;
+	rte->relkind = RELKIND_PARTITIONED_TABLE;
+	rte->rellockmode = m_lockmode;
+
+	Alias *alias = MakeNode(Alias);
+	alias->aliasname = PStrDup(RelationGetRelationName(relation));
+	alias->colnames = NIL;
+	for (int att = 0; att < relation->rd_att->natts; ++att)
+	{
+		Form_pg_attribute attr = TupleDescAttr(relation->rd_att, att);
+		// dropped attributes are required by GPDB as empty names
+		CHAR *colname = attr->attisdropped ? PStrDup("")
+										   : PStrDup(NameStr(attr->attname));
+		alias->colnames =
+			gpdb::LAppend(alias->colnames, gpdb::MakeStringValue(colname));
+	}
+	rte->eref = alias;
+	rte->alias = alias;
+
+	m_dxl_to_plstmt_context->AddRTE(rte);
+	return gpdb::ListLength(m_dxl_to_plstmt_context->GetRTableEntriesList());
+}
+
+// Is the given partition pruning predicate on the column with the given
+// attno of the root partitioned table.
+// CPredicateUtils::ValidatePartPruningExpr() ensures that the LHS of each
+// comparison is the partition column, possibly under a binary coercible
+// cast, and the arms of a boolean expression are predicates on the same
+// partition key.
+static BOOL
+FPredicateOnPartKey(CDXLNode *node, AttrNumber root_attno,
+					const CContextDXLToPlStmt *dxl_to_plstmt_context)
+{
+	Edxlopid eopid = node->GetOperator()->GetDXLOperator();
+	if (EdxlopScalarBoolExpr == eopid)
+	{
+		return FPredicateOnPartKey((*node)[0], root_attno,
+								   dxl_to_plstmt_context);
+	}
+
+	if (EdxlopScalarCmp != eopid)
+	{
+		return false;
+	}
+
+	CDXLNode *ident_node = (*node)[0];
+	if (EdxlopScalarCast == ident_node->GetOperator()->GetDXLOperator())
+	{
+		ident_node = (*ident_node)[0];
 	}
 
+	if (EdxlopScalarIdent != ident_node->GetOperator()->GetDXLOperator())
+	{
+		return false;
+	}
+
+	// the column is one of the dynamic scan, which has been translated
+	// before the partition selector
+	ULONG colid = CDXLScalarIdent::Cast(ident_node->GetOperator())
+					  ->GetDXLColRef()
+					  ->Id();
+	AttrNumber attno = dxl_to_plstmt_context->GetAttnoForColId(colid);
+	if (InvalidAttrNumber == attno)
+	{
+		GPOS_RAISE(
+			gpdxl::ExmaDXL, gpdxl::ExmiDXL2PlStmtConversion,
+			GPOS_WSZ_LIT("Could not find partition column of DPE filter expr"));
+	}
+
+	return attno == root_attno;
+}
+
+// Pruning steps of the given partitioned table. In a multi-level hierarchy
+// the filter is the conjunction of the predicates on the partition keys of
+// all levels, so each level prunes with those conjuncts that are on its own
+// key; a single-level table prunes with the whole filter
+List *
+CPartPruneStepsBuilder::PartPruneStepsForLevel(CDXLNode *filterNode,
+											   Relation relation)
+{
+	GPOS_ASSERT(nullptr != filterNode);
+
 	INT step_id = 0;
-	pinfo->exec_pruning_steps = PartPruneStepsFromFilter(
-		filterNode, &step_id, pinfo->exec_pruning_steps);
-	return pinfo;
+	if (!m_is_multi_level)
+	{
+		return PartPruneStepsFromFilter(filterNode, relation, &step_id, NIL);
+	}
+
+	// ORCA doesn't support multi-key (a.k.a composite) partition keys
+	AttrNumber root_attno =
+		gpdb::GPDBRelationRetrievePartitionKey(relation)->partattrs[0];
+	if (relation != m_root_relation)
+	{
+		root_attno =
+			gpdb::GetPartitionRootAttno(m_root_relation, relation, root_attno);
+	}
+
+	BOOL is_conjunction =
+		EdxlopScalarBoolExpr == filterNode->GetOperator()->GetDXLOperator() &&
+		Edxland == CDXLScalarBoolExpr::Cast(filterNode->GetOperator())
+					   ->GetDxlBoolTypeStr();
+	const ULONG arity = is_conjunction ? filterNode->Arity() : 1;
+
+	List *steps_list = NIL;
+	List *stepids = NIL;
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		CDXLNode *conjunct = is_conjunction ? (*filterNode)[ul] : filterNode;
+		if (!FPredicateOnPartKey(conjunct, root_attno,
+								 m_dxl_to_plstmt_context))
+		{
+			continue;
+		}
+
+		steps_list =
+			PartPruneStepsFromFilter(conjunct, relation, &step_id, steps_list);
+
+		PartitionPruneStep *last_step =
+			(PartitionPruneStep *) lfirst(gpdb::ListTail(steps_list));
+		stepids = gpdb::LAppendInt(stepids, last_step->step_id);
+	}
+
+	if (1 < gpdb::ListLength(stepids))
+	{
+		PartitionPruneStepCombine *step = MakeNode(PartitionPruneStepCombine);
+		step->step.step_id = step_id++;
+		step->source_stepids = stepids;
+		step->combineOp = PARTPRUNE_COMBINE_INTERSECT;
+		steps_list = gpdb::LAppend(steps_list, (PartitionPruneStep *) step);
+	}
+
+	return steps_list;
 }
 
 List *
-CPartPruneStepsBuilder::PartPruneStepFromScalarCmp(CDXLNode *node, int *step_id,
+CPartPruneStepsBuilder::PartPruneStepFromScalarCmp(CDXLNode *node,
+												   Relation relation,
+												   INT *step_id,
 												   List *steps_list)
 {
 	GPOS_ASSERT(nullptr != node);
 	CDXLScalarComp *dxlop = CDXLScalarComp::Cast(node->GetOperator());
 	Oid opno = CMDIdGPDB::CastMdid(dxlop->MDId())->Oid();
-	Oid opfamily = gpdb::GPDBRelationRetrievePartitionKey(m_relation)
+	Oid opfamily = gpdb::GPDBRelationRetrievePartitionKey(relation)
 					   ->partopfamily[0 /* col */];
 
 	StrategyNumber strategy_num;
@@ -146,7 +354,7 @@ CPartPruneStepsBuilder::PartPruneStepFromScalarCmp(CDXLNode *node, int *step_id,
 	// ORCA doesn't support multi-key (a.k.a composite) partition keys. So these
 	// lists will be of size 1.
 	step->cmpfns =
-		ListMake1Oid(gpdb::GPDBRelationRetrievePartitionKey(m_relation)
+		ListMake1Oid(gpdb::GPDBRelationRetrievePartitionKey(relation)
 						 ->partsupfunc[0]
 						 .fn_oid);
 	step->exprs = ListMake1(expr);
@@ -156,7 +364,8 @@ CPartPruneStepsBuilder::PartPruneStepFromScalarCmp(CDXLNode *node, int *step_id,
 
 List *
 CPartPruneStepsBuilder::PartPruneStepFromScalarBoolExpr(CDXLNode *node,
-														int *step_id,
+														Relation relation,
+														INT *step_id,
 														List *steps_list)
 {
 	GPOS_ASSERT(nullptr != node);
@@ -194,7 +403,8 @@ CPartPruneStepsBuilder::PartPruneStepFromScalarBoolExpr(CDXLNode *node,
 	for (ULONG ul = 0; ul < node->Arity(); ul++)
 	{
 		CDXLNode *child_node = (*node)[ul];
-		steps_list = PartPruneStepsFromFilter(child_node, step_id, steps_list);
+		steps_list = PartPruneStepsFromFilter(child_node, relation, step_id,
+											  steps_list);
 
 		PartitionPruneStep *last_step =
 			(PartitionPruneStep *) lfirst(gpdb::ListTail(steps_list));
@@ -210,7 +420,9 @@ CPartPruneStepsBuilder::PartPruneStepFromScalarBoolExpr(CDXLNode *node,
 }
 
 List *
-CPartPruneStepsBuilder::PartPruneStepsFromFilter(CDXLNode *node, INT *step_id,
+CPartPruneStepsBuilder::PartPruneStepsFromFilter(CDXLNode *node,
+												 Relation relation,
+												 INT *step_id,
 												 List *steps_list)
 {
 	GPOS_ASSERT(nullptr != node);
@@ -220,13 +432,14 @@ CPartPruneStepsBuilder::PartPruneStepsFromFilter(CDXLNode *node, INT *step_id,
 	{
 		case EdxlopScalarCmp:
 		{
-			steps_list = PartPruneStepFromScalarCmp(node, step_id, steps_list);
+			steps_list =
+				PartPruneStepFromScalarCmp(node, relation, step_id, steps_list);
 			break;
 		}
 		case EdxlopScalarBoolExpr:
 		{
-			steps_list =
-				PartPruneStepFromScalarBoolExpr(node, step_id, steps_list);
+			steps_list = PartPruneStepFromScalarBoolExpr(node, relation,
+														 step_id, steps_list);
 			break;
 		}
 		default:
@@ -1438,7 +1438,7 @@ CTranslatorDXLToPlStmt::TranslateDXLHashJoin(
 	// set join type
 	join->jointype =
 		GetGPDBJoinTypeFromDXLJoinType(hashjoin_dxlop->GetJoinType());
-	join->prefetch_inner = true;
+	hashjoin->use_runtime_filter = hashjoin_dxlop->UseRuntimeFilter();
 
 	// translate operator costs
 	TranslatePlanCosts(hj_dxlnode, plan);
@@ -1446,6 +1446,13 @@ CTranslatorDXLToPlStmt::TranslateDXLHashJoin(
 	// translate join children
 	CDXLNode *left_tree_dxlnode = (*hj_dxlnode)[EdxlhjIndexHashLeft];
 	CDXLNode *right_tree_dxlnode = (*hj_dxlnode)[EdxlhjIndexHashRight];
+
+	// read the inner side first, unless the executor may swap the sides at
+	// runtime: like the planner, that only needs prefetch_inner if either
+	// side has a motion hazard (see motion_sanity_walker)
+	join->prefetch_inner = !gp_enable_hashjoin_role_reversal ||
+						   HasMotionHazard(left_tree_dxlnode) ||
+						   HasMotionHazard(right_tree_dxlnode);
 	CDXLNode *project_list_dxlnode = (*hj_dxlnode)[EdxlhjIndexProjList];
 	CDXLNode *filter_dxlnode = (*hj_dxlnode)[EdxlhjIndexFilter];
 	CDXLNode *join_filter_dxlnode = (*hj_dxlnode)[EdxlhjIndexJoinFilter];
@@ -1615,6 +1622,24 @@ CTranslatorDXLToPlStmt::TranslateDXLHashJoin(
 	SetHashKeysVarnoWalker((Node *) inner_hashkeys, nullptr);
 	((Hash *) right_plan)->hashkeys = inner_hashkeys;
 
+	// as in create_hashjoin_plan, if there is a single hash clause on a
+	// column of the outer side, supply the MCVs of the column for the skew
+	// optimization (see make_hash)
+	Oid skew_rel_oid = InvalidOid;
+	AttrNumber skew_attno = InvalidAttrNumber;
+	bool skew_inh = false;
+	if (gp_enable_hashjoin_role_reversal &&
+		1 == gpdb::ListLength(outer_hashkeys) &&
+		GetBaseTableColumn(left_plan, (Expr *) LInitial(outer_hashkeys),
+						   &skew_rel_oid, &skew_attno, &skew_inh))
+	{
+		Hash *hash = (Hash *) right_plan;
+		hash->skewTable = skew_rel_oid;
+		hash->skewColumn = skew_attno;
+		hash->skewInherit = skew_inh;
+		gpdb::SetHashSkewValues(hash);
+	}
+
 	plan->lefttree = left_plan;
 	plan->righttree = right_plan;
 	SetParamIds(plan);
@@ -1626,6 +1651,135 @@ CTranslatorDXLToPlStmt::TranslateDXLHashJoin(
 	return (Plan *) hashjoin;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::HasMotionHazard
+//
+//	@doc:
+//		Does the given subtree contain a motion, a partition selector or a
+//		shared scan. A join over such a subtree has to read its inner side
+//		completely before its outer side: motions on both sides could
+//		deadlock otherwise, partition selectors on the inner side have to
+//		run before the scans they prune, and shared scans may wait for a
+//		producer in another slice.
+//
+//---------------------------------------------------------------------------
+BOOL
+CTranslatorDXLToPlStmt::HasMotionHazard(const CDXLNode *dxlnode)
+{
+	switch (dxlnode->GetOperator()->GetDXLOperator())
+	{
+		case EdxlopPhysicalMotionGather:
+		case EdxlopPhysicalMotionBroadcast:
+		case EdxlopPhysicalMotionRedistribute:
+		case EdxlopPhysicalMotionRoutedDistribute:
+		case EdxlopPhysicalMotionRandom:
+		case EdxlopPhysicalPartitionSelector:
+		case EdxlopPhysicalCTEProducer:
+		case EdxlopPhysicalCTEConsumer:
+			return true;
+		default:
+			break;
+	}
+
+	const ULONG arity = dxlnode->Arity();
+	for (ULONG ul = 0; ul < arity; ul++)
+	{
+		if (HasMotionHazard((*dxlnode)[ul]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorDXLToPlStmt::GetBaseTableColumn
+//
+//	@doc:
+//		Find the base table column that the given key reads, where the key
+//		refers to the outputs of the given plan as OUTER_VAR. The column is
+//		followed down through motions and through nodes that pass their
+//		input on, until the scan of the table; returns false if the key is
+//		not a plain column reference all the way down
+//
+//---------------------------------------------------------------------------
+BOOL
+CTranslatorDXLToPlStmt::GetBaseTableColumn(Plan *plan, Expr *key,
+										   Oid *rel_oid, AttrNumber *attno,
+										   bool *inh)
+{
+	Expr *expr = key;
+	while (nullptr != plan)
+	{
+		if (IsA(expr, RelabelType))
+		{
+			expr = ((RelabelType *) expr)->arg;
+		}
+		if (!IsA(expr, Var) || OUTER_VAR != ((Var *) expr)->varno)
+		{
+			return false;
+		}
+
+		// find the expression the plan outputs for the column
+		AttrNumber resno = ((Var *) expr)->varattno;
+		if (resno <= 0 || (ULONG) resno > gpdb::ListLength(plan->targetlist))
+		{
+			return false;
+		}
+		TargetEntry *te =
+			(TargetEntry *) gpdb::ListNth(plan->targetlist, resno - 1);
+		GPOS_ASSERT(te->resno == resno);
+		expr = te->expr;
+		if (IsA(expr, RelabelType))
+		{
+			expr = ((RelabelType *) expr)->arg;
+		}
+		if (!IsA(expr, Var))
+		{
+			return false;
+		}
+
+		Var *var = (Var *) expr;
+		switch (nodeTag(plan))
+		{
+			case T_SeqScan:
+			case T_IndexScan:
+			case T_IndexOnlyScan:
+			case T_BitmapHeapScan:
+			{
+				if (((Scan *) plan)->scanrelid != var->varno ||
+					0 >= var->varattno)
+				{
+					return false;
+				}
+				RangeTblEntry *rte =
+					m_dxl_to_plstmt_context->GetRTEByIndex(var->varno);
+				if (RTE_RELATION != rte->rtekind)
+				{
+					return false;
+				}
+				*rel_oid = rte->relid;
+				*attno = var->varattno;
+				*inh = rte->inh;
+				return true;
+			}
+			case T_Motion:
+			case T_Result:
+			case T_Material:
+			case T_Sort:
+				plan = plan->lefttree;
+				break;
+			default:
+				return false;
+		}
+	}
+
+	return false;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorDXLToPlStmt::TranslateDXLTvf
@@ -2231,7 +2385,7 @@ CTranslatorDXLToPlStmt::TranslateDXLMergeJoin(
 				gpdb::ExprCollation((Node *) leftarg);
 
 			// Make sure that the following properties match
-			// those in CPhysicalFullMergeJoin::PosRequired().
+			// those in CPhysicalMergeJoin::PosRequired().
 			merge_join->mergeStrategies[ul] = BTLessStrategyNumber;
 			merge_join->mergeNullsFirst[ul] = false;
 			++ul;
@@ -3811,7 +3965,7 @@ CTranslatorDXLToPlStmt::TranslateDXLPartSelector(
 	ULongPtrArray *part_indexes = partition_selector_dxlop->Partitions();
 	List *prune_infos = CPartPruneStepsBuilder::CreatePartPruneInfos(
 		filterNode, relation.get(), rtindex, part_indexes, &colid_var_mapping,
-		m_translator_dxl_to_scalar);
+		m_translator_dxl_to_scalar, m_dxl_to_plstmt_context);
 
 	partition_selector->part_prune_info = MakeNode(PartitionPruneInfo);
 	partition_selector->part_prune_info->prune_infos = prune_infos;
@@ -5196,6 +5350,7 @@ CTranslatorDXLToPlStmt::ProcessDXLTblDescr(
 		GPOS_ASSERT(0 != attno);
 
 		(void) base_table_context->InsertMapping(dxl_col_descr->Id(), attno);
+		m_dxl_to_plstmt_context->AddColIdAttno(dxl_col_descr->Id(), attno);
 	}
 
 	ULONG acl_mode = table_descr->GetAclMode();
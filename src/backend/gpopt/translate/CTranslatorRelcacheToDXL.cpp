@@ -467,42 +467,22 @@ CTranslatorRelcacheToDXL::RetrieveExtStatsInfo(CMemoryPool *mp, IMDId *mdid)
 //		get_ao_version
 //
 //	@doc:
-//		Retrieve a relation's AORelationVersion. If table is partitioned then
-//		return the lowest AORelationVersion from all children. If table is not
-//		AO table (e.g. heap table) or a partitioned table that does not contain
-//		an AO table then return AORelationVersion_None.
+//		Retrieve a relation's AORelationVersion. If table is not AO table
+//		(e.g. heap table) then return AORelationVersion_None. The version of
+//		a partitioned table is collected with its leaf partitions, see
+//		CTranslatorRelcacheToDXL::RetrieveLeafPartitions.
 //
 //---------------------------------------------------------------------------
 static IMDRelation::Erelaoversion
-get_ao_version(gpdb::RelationWrapper &rel)
+get_ao_version(Relation rel)
 {
-	// partitioned table - return lowest version of child partitions
-	if (gpdb::GPDBRelationRetrievePartitionDesc(rel.get()))
-	{
-		IMDRelation::Erelaoversion low_ao_version =
-			IMDRelation::MaxAORelationVersion;
-		for (int i = 0;
-			 i < gpdb::GPDBRelationRetrievePartitionDesc(rel.get())->nparts;
-			 i++)
-		{
-			gpdb::RelationWrapper child_rel = gpdb::GetRelation(
-				gpdb::GPDBRelationRetrievePartitionDesc(rel.get())->oids[i]);
-			IMDRelation::Erelaoversion child_low_version =
-				get_ao_version(child_rel);
-			if (child_low_version < low_ao_version &&
-				child_low_version != IMDRelation::AORelationVersion_None)
-			{
-				low_ao_version = child_low_version;
-			}
-		}
-		return low_ao_version;
-	}
-	// non-partitioned AO table or leaf AO table
-	else if ((rel->rd_rel->relam == AO_ROW_TABLE_AM_OID ||
-			  rel->rd_rel->relam == AO_COLUMN_TABLE_AM_OID))
+	GPOS_ASSERT(rel->rd_rel->relkind != RELKIND_PARTITIONED_TABLE);
+
+	if (rel->rd_rel->relam == AO_ROW_TABLE_AM_OID ||
+		rel->rd_rel->relam == AO_COLUMN_TABLE_AM_OID)
 	{
 		return static_cast<IMDRelation::Erelaoversion>(
-			AORelationVersion_Get(rel.get()));
+			AORelationVersion_Get(rel));
 	}
 	return IMDRelation::AORelationVersion_None;
 }
@@ -562,14 +542,57 @@ CTranslatorRelcacheToDXL::RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 	IMdIdArray *partition_oids = nullptr;
 	IMDId *foreign_server_mdid = nullptr;
 
+	BOOL has_foreign_partitions = false;
+	BOOL partitions_match_root_cols = false;
+
 	// get rel name
 	mdname = GetRelName(mp, rel.get());
 
-	// get storage type
-	rel_storage_type = RetrieveRelStorageType(rel.get());
+	is_partitioned = (rel->rd_rel->relkind == RELKIND_PARTITIONED_TABLE);
+
+	if (is_partitioned)
+	{
+		// get the leaf partitions of all levels and the partition key of each
+		// level; the properties of the partitioned table that depend on its
+		// leaves are computed in the same pass, so that each leaf is opened
+		// only once and no leaf metadata needs to be retrieved for them
+		RetrievePartKeysAndTypes(mp, rel.get(), oid, &part_keys, &part_types);
+
+		SLeafPartitions leaves = {GPOS_NEW(mp) IMdIdArray(mp),
+								  IMDRelation::ErelstorageSentinel,
+								  IMDRelation::MaxAORelationVersion,
+								  false /* m_has_foreign */,
+								  true /* m_match_root_cols */};
+		RetrieveLeafPartitions(mp, rel.get(), rel.get(), 1 /* level */,
+							   part_keys, part_types, &leaves);
+
+		partition_oids = leaves.m_partition_oids;
+		has_foreign_partitions = leaves.m_has_foreign;
+		partitions_match_root_cols = leaves.m_match_root_cols;
+		rel_ao_version = leaves.m_ao_version;
+
+		// ignore the foreign partitions for determining the storage type,
+		// unless all of the partitions are foreign, as we'll be separating
+		// them out to different scans later in
+		// CXformExpandDynamicGetWithForeignPartitions
+		rel_storage_type = leaves.m_storage_type;
+		if (0 == partition_oids->Size())
+		{
+			rel_storage_type = IMDRelation::ErelstorageHeap;
+		}
+		else if (IMDRelation::ErelstorageSentinel == rel_storage_type)
+		{
+			rel_storage_type = IMDRelation::ErelstorageForeign;
+		}
+	}
+	else
+	{
+		// get storage type
+		rel_storage_type = RetrieveRelStorageType(rel.get());
 
-	// get append only table version
-	rel_ao_version = get_ao_version(rel);
+		// get append only table version
+		rel_ao_version = get_ao_version(rel.get());
+	}
 
 	// get relation columns
 	mdcol_array = RetrieveRelColumns(mp, md_accessor, rel.get());
@@ -607,31 +630,6 @@ CTranslatorRelcacheToDXL::RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 	// collect relation indexes
 	md_index_info_array = RetrieveRelIndexInfo(mp, rel.get());
 
-	is_partitioned = (rel->rd_rel->relkind == RELKIND_PARTITIONED_TABLE);
-
-	// get number of leaf partitions
-	if (is_partitioned)
-	{
-		RetrievePartKeysAndTypes(mp, rel.get(), oid, &part_keys, &part_types);
-
-		partition_oids = GPOS_NEW(mp) IMdIdArray(mp);
-		PartitionDesc part_desc =
-			gpdb::GPDBRelationRetrievePartitionDesc(rel.get());
-		for (int i = 0; i < part_desc->nparts; ++i)
-		{
-			Oid part_oid = part_desc->oids[i];
-			partition_oids->Append(GPOS_NEW(mp)
-									   CMDIdGPDB(IMDId::EmdidRel, part_oid));
-			gpdb::RelationWrapper rel_part = gpdb::GetRelation(part_oid);
-			if (rel_part->rd_rel->relkind == RELKIND_PARTITIONED_TABLE)
-			{
-				// Multi-level partitioned tables are unsupported - fall back
-				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
-						   GPOS_WSZ_LIT("Multi-level partitioned tables"));
-			}
-		}
-	}
-
 	// get key sets
 	BOOL should_add_default_keys = RelHasSystemColumns(rel->rd_rel->relkind);
 	keyset_array = RetrieveRelKeysets(mp, oid, should_add_default_keys,
@@ -667,7 +665,8 @@ CTranslatorRelcacheToDXL::RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
 	md_rel = GPOS_NEW(mp) CMDRelationGPDB(
 		mp, mdid, mdname, is_temporary, rel_storage_type, rel_ao_version, dist,
 		mdcol_array, distr_cols, distr_op_families, part_keys, part_types,
-		partition_oids, convert_hash_to_random, keyset_array,
+		partition_oids, has_foreign_partitions, partitions_match_root_cols,
+		convert_hash_to_random, keyset_array,
 		md_index_info_array, check_constraint_mdids, mdpart_constraint,
 		foreign_server_mdid, rel->rd_rel->reltuples);
 
@@ -1105,17 +1104,12 @@ CTranslatorRelcacheToDXL::RetrieveIndex(CMemoryPool *mp,
 	mdid_index->AddRef();
 	IMdIdArray *op_families_mdids = RetrieveIndexOpFamilies(mp, mdid_index);
 
-	// get child indexes
-	IMdIdArray *child_index_oids = nullptr;
-	if (index_rel->rd_rel->relkind == RELKIND_PARTITIONED_INDEX)
-	{
-		index_partitioned = true;
-		child_index_oids = RetrieveIndexPartitions(mp, index_oid);
-	}
-	else
-	{
-		child_index_oids = GPOS_NEW(mp) IMdIdArray(mp);
-	}
+	// child indexes are not retrieved: for a partitioned table with many
+	// partitions that is as expensive as it is unnecessary, since the index
+	// of each partition is looked up by the executor
+	IMdIdArray *child_index_oids = GPOS_NEW(mp) IMdIdArray(mp);
+	index_partitioned =
+		(index_rel->rd_rel->relkind == RELKIND_PARTITIONED_INDEX);
 
 	CMDIndexGPDB *index = GPOS_NEW(mp) CMDIndexGPDB(
 		mp, mdid_index, mdname, index_clustered, index_partitioned,
@@ -2567,22 +2561,18 @@ CTranslatorRelcacheToDXL::TransformHistogramToDXLBucketArray(
 //		CTranslatorRelcacheToDXL::RetrieveRelStorageType
 //
 //	@doc:
-//		Get relation storage type
+//		Get relation storage type. The storage type of a partitioned table
+//		is collected with its leaf partitions, see RetrieveLeafPartitions.
 //
 //---------------------------------------------------------------------------
 IMDRelation::Erelstoragetype
 CTranslatorRelcacheToDXL::RetrieveRelStorageType(Relation rel)
 {
+	GPOS_ASSERT(rel->rd_rel->relkind != RELKIND_PARTITIONED_TABLE);
+
 	IMDRelation::Erelstoragetype rel_storage_type =
 		IMDRelation::ErelstorageSentinel;
 
-	// handle partition root first, note the partition type returned here
-	// is not necessarily the same as the one root partition carries
-	if (rel->rd_rel->relkind == RELKIND_PARTITIONED_TABLE)
-	{
-		return RetrieveStorageTypeForPartitionedTable(rel);
-	}
-
 	switch (rel->rd_rel->relam)
 	{
 		case HEAP_TABLE_AM_OID:
@@ -2653,6 +2643,27 @@ CTranslatorRelcacheToDXL::RetrievePartKeysAndTypes(CMemoryPool *mp,
 	*part_keys = GPOS_NEW(mp) ULongPtrArray(mp);
 	*part_types = GPOS_NEW(mp) CharPtrArray(mp);
 
+	CHAR part_type = '\0';
+	AttrNumber attno = RetrievePartKey(rel, &part_type);
+
+	(*part_keys)->Append(GPOS_NEW(mp) ULONG(attno - 1));
+	(*part_types)->Append(GPOS_NEW(mp) CHAR(part_type));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrievePartKey
+//
+//	@doc:
+//		Get the partition key attno and strategy of a partitioned table,
+//		raising for the partition keys Orca does not support
+//
+//---------------------------------------------------------------------------
+AttrNumber
+CTranslatorRelcacheToDXL::RetrievePartKey(Relation rel, CHAR *part_type)
+{
+	GPOS_ASSERT(nullptr != part_type);
+
 	PartitionKeyData *partkey = gpdb::GPDBRelationRetrievePartitionKey(rel);
 
 	if (1 < partkey->partnatts)
@@ -2662,21 +2673,191 @@ CTranslatorRelcacheToDXL::RetrievePartKeysAndTypes(CMemoryPool *mp,
 	}
 
 	AttrNumber attno = partkey->partattrs[0];
-	CHAR part_type = (CHAR) partkey->strategy;
+	*part_type = (CHAR) partkey->strategy;
 	if (attno == 0)
 	{
 		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
 				   GPOS_WSZ_LIT("partitioning by expression"));
 	}
 
-	if (PARTITION_STRATEGY_HASH == part_type)
+	if (PARTITION_STRATEGY_HASH == *part_type)
 	{
 		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
 				   GPOS_WSZ_LIT("hash partitioning"));
 	}
 
-	(*part_keys)->Append(GPOS_NEW(mp) ULONG(attno - 1));
-	(*part_types)->Append(GPOS_NEW(mp) CHAR(part_type));
+	return attno;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveLeafPartitions
+//
+//	@doc:
+//		Append the leaf partitions below the given partitioned table to
+//		leaves, depth first in partition bound order, and fold their storage
+//		type, AO version and columns into leaves. The partitions of rel are
+//		at the given level of the hierarchy rooted at root_rel.
+//
+//		Orca models a multi-level partitioned table as the flat list of its
+//		leaves plus one partition key per level; the key of every level
+//		below the root is appended to part_keys and part_types, in terms of
+//		the attnos of the root. The partition constraint of a leaf includes
+//		the constraints of all its ancestors, so static partition
+//		elimination needs nothing else. All partitioned tables of a level
+//		must therefore share the same key and strategy.
+//
+//---------------------------------------------------------------------------
+void
+CTranslatorRelcacheToDXL::RetrieveLeafPartitions(
+	CMemoryPool *mp, Relation root_rel, Relation rel, ULONG level,
+	ULongPtrArray *part_keys, CharPtrArray *part_types,
+	SLeafPartitions *leaves)
+{
+	PartitionDesc part_desc = gpdb::GPDBRelationRetrievePartitionDesc(rel);
+	for (int i = 0; i < part_desc->nparts; ++i)
+	{
+		Oid part_oid = part_desc->oids[i];
+		gpdb::RelationWrapper rel_part = gpdb::GetRelation(part_oid);
+		if (rel_part->rd_rel->relkind != RELKIND_PARTITIONED_TABLE)
+		{
+			leaves->m_partition_oids->Append(
+				GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidRel, part_oid));
+			AddLeafPartition(root_rel, rel_part.get(), leaves);
+			continue;
+		}
+
+		if (!optimizer_multilevel_partitioning)
+		{
+			GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
+					   GPOS_WSZ_LIT("Multi-level partitioned tables"));
+		}
+
+		CHAR part_type = '\0';
+		AttrNumber attno = RetrievePartKey(rel_part.get(), &part_type);
+
+		// partitions may have their columns in a different order than the
+		// root, or dropped columns the root does not have
+		ULONG root_attno =
+			gpdb::GetPartitionRootAttno(root_rel, rel_part.get(), attno);
+		GPOS_ASSERT(0 < root_attno);
+
+		if (level == part_keys->Size())
+		{
+			part_keys->Append(GPOS_NEW(mp) ULONG(root_attno - 1));
+			part_types->Append(GPOS_NEW(mp) CHAR(part_type));
+		}
+		else if (*(*part_keys)[level] != root_attno - 1 ||
+				 *(*part_types)[level] != part_type)
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
+				GPOS_WSZ_LIT(
+					"Multi-level partitioned tables with different partition keys at the same level"));
+		}
+
+		RetrieveLeafPartitions(mp, root_rel, rel_part.get(), level + 1,
+							   part_keys, part_types, leaves);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::AddLeafPartition
+//
+//	@doc:
+//		Fold the storage type, AO version and columns of a leaf partition
+//		into the properties of the leaves of its root
+//
+//---------------------------------------------------------------------------
+void
+CTranslatorRelcacheToDXL::AddLeafPartition(Relation root_rel, Relation rel,
+										   SLeafPartitions *leaves)
+{
+	IMDRelation::Erelstoragetype storage_type = RetrieveRelStorageType(rel);
+
+	if (IMDRelation::ErelstorageForeign == storage_type)
+	{
+		if (!optimizer_enable_foreign_table)
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
+				GPOS_WSZ_LIT(
+					"Use optimizer_enable_foreign_table to enable Orca with foreign partitions"));
+		}
+
+		// Fall back to planner if there is a foreign partition using the greenplum_fdw
+		// this FDW does some coordinator specific setup and fdw_private populating
+		// in ExecInit* to work with parallel cursors. This must run on the coordinator,
+		// but in Orca is run on the segments. We likely can't use Orca's dynamic scan
+		// approach for this case
+		CWStringConst str_greenplum_fdw(GPOS_WSZ_LIT("greenplum_fdw"));
+		CAutoMemoryPool amp;
+		CMemoryPool *mp = amp.Pmp();
+		CWStringDynamic *fdw_name_str =
+			CDXLUtils::CreateDynamicStringFromCharArray(
+				mp, gpdb::GetRelFdwName(RelationGetRelid(rel)));
+
+		if (fdw_name_str->Equals(&str_greenplum_fdw))
+		{
+			GPOS_DELETE(fdw_name_str);
+			GPOS_RAISE(
+				gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
+				GPOS_WSZ_LIT(
+					"Queries with partitions of greenplum_fdw are not supported"));
+		}
+		GPOS_DELETE(fdw_name_str);
+
+		// foreign partitions have no system columns, and a foreign server
+		leaves->m_has_foreign = true;
+		leaves->m_match_root_cols = false;
+		return;
+	}
+
+	if (IMDRelation::ErelstorageSentinel == leaves->m_storage_type)
+	{
+		leaves->m_storage_type = storage_type;
+	}
+
+	// mark any partitioned table with supported partitions of mixed storage types,
+	// this is more conservative for certain skans (eg: we can't do an index scan if any
+	// partition is ao, we must only do a sequential or bitmap scan)
+	if (leaves->m_storage_type != storage_type)
+	{
+		leaves->m_storage_type = IMDRelation::ErelstorageMixedPartitioned;
+	}
+
+	// the lowest AO version of the leaves
+	IMDRelation::Erelaoversion ao_version = get_ao_version(rel);
+	if (ao_version < leaves->m_ao_version &&
+		ao_version != IMDRelation::AORelationVersion_None)
+	{
+		leaves->m_ao_version = ao_version;
+	}
+
+	// partitions have the columns of the root, but may have them in a
+	// different order or have different dropped columns
+	TupleDesc root_desc = root_rel->rd_att;
+	TupleDesc desc = rel->rd_att;
+	if (!leaves->m_match_root_cols || root_desc->natts != desc->natts)
+	{
+		leaves->m_match_root_cols = false;
+		return;
+	}
+
+	for (int att = 0; att < desc->natts; ++att)
+	{
+		Form_pg_attribute root_attr = TupleDescAttr(root_desc, att);
+		Form_pg_attribute attr = TupleDescAttr(desc, att);
+		if (root_attr->attisdropped != attr->attisdropped ||
+			(!attr->attisdropped &&
+			 0 != clib::Strcmp(NameStr(root_attr->attname),
+							   NameStr(attr->attname))))
+		{
+			leaves->m_match_root_cols = false;
+			return;
+		}
+	}
 }
 
 
@@ -3069,102 +3250,4 @@ CTranslatorRelcacheToDXL::RetrieveScOpOpFamilies(CMemoryPool *mp,
 	return input_col_mdids;
 }
 
-IMdIdArray *
-CTranslatorRelcacheToDXL::RetrieveIndexPartitions(CMemoryPool *mp, OID rel_oid)
-{
-	IMdIdArray *partition_oids = GPOS_NEW(mp) IMdIdArray(mp);
-
-	List *partition_oid_list = gpdb::GetRelChildIndexes(rel_oid);
-	ListCell *lc;
-	foreach (lc, partition_oid_list)
-	{
-		OID oid = lfirst_oid(lc);
-		partition_oids->Append(GPOS_NEW(mp)
-								   CMDIdGPDB(IMDId::EmdidGeneral, oid));
-	}
-
-	return partition_oids;
-}
-
-IMDRelation::Erelstoragetype
-CTranslatorRelcacheToDXL::RetrieveStorageTypeForPartitionedTable(Relation rel)
-{
-	IMDRelation::Erelstoragetype rel_storage_type =
-		IMDRelation::ErelstorageSentinel;
-	if (gpdb::GPDBRelationRetrievePartitionDesc(rel)->nparts == 0)
-	{
-		return IMDRelation::ErelstorageHeap;
-	}
-
-	BOOL all_foreign = true;
-	for (int i = 0; i < gpdb::GPDBRelationRetrievePartitionDesc(rel)->nparts;
-		 ++i)
-	{
-		Oid oid = gpdb::GPDBRelationRetrievePartitionDesc(rel)->oids[i];
-		gpdb::RelationWrapper child_rel = gpdb::GetRelation(oid);
-		IMDRelation::Erelstoragetype child_storage =
-			RetrieveRelStorageType(child_rel.get());
-		// Child rel with partdesc means it's not leaf partition, we don't care about it
-		if (gpdb::GPDBRelationRetrievePartitionDesc(child_rel.get()))
-		{
-			continue;
-		}
-
-		if (child_storage == IMDRelation::ErelstorageForeign)
-		{
-			// for partitioned tables with foreign partitions, we want to ignore the foreign partitions
-			// for determining the storage-type (unless all of the partitions are foreign) as we'll be separating them out to different scans later in CXformExpandDynamicGetWithForeignPartitions
-			if (!optimizer_enable_foreign_table)
-			{
-				GPOS_RAISE(
-					gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
-					GPOS_WSZ_LIT(
-						"Use optimizer_enable_foreign_table to enable Orca with foreign partitions"));
-			}
-
-			// Fall back to planner if there is a foreign partition using the greenplum_fdw
-			// this FDW does some coordinator specific setup and fdw_private populating
-			// in ExecInit* to work with parallel cursors. This must run on the coordinator,
-			// but in Orca is run on the segments. We likely can't use Orca's dynamic scan
-			// approach for this case
-			CWStringConst str_greenplum_fdw(GPOS_WSZ_LIT("greenplum_fdw"));
-			CAutoMemoryPool amp;
-			CMemoryPool *mp = amp.Pmp();
-			CWStringDynamic *fdw_name_str =
-				CDXLUtils::CreateDynamicStringFromCharArray(
-					mp, gpdb::GetRelFdwName(oid));
-
-			if (fdw_name_str->Equals(&str_greenplum_fdw))
-			{
-				GPOS_DELETE(fdw_name_str);
-				GPOS_RAISE(
-					gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
-					GPOS_WSZ_LIT(
-						"Queries with partitions of greenplum_fdw are not supported"));
-			}
-			GPOS_DELETE(fdw_name_str);
-			continue;
-		}
-		all_foreign = false;
-		if (rel_storage_type == IMDRelation::ErelstorageSentinel)
-		{
-			rel_storage_type = child_storage;
-		}
-
-		// mark any partitioned table with supported partitions of mixed storage types,
-		// this is more conservative for certain skans (eg: we can't do an index scan if any
-		// partition is ao, we must only do a sequential or bitmap scan)
-		if (rel_storage_type != child_storage)
-		{
-			rel_storage_type = IMDRelation::ErelstorageMixedPartitioned;
-		}
-	}
-	if (all_foreign)
-	{
-		rel_storage_type = IMDRelation::ErelstorageForeign;
-	}
-	return rel_storage_type;
-}
-
-
 // EOF
@@ -53,25 +53,16 @@ CConstExprEvaluatorProxy::CEmptyMappingColIdVar::VarFromDXLNodeScId(
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CConstExprEvaluatorProxy::EvaluateExpr
+//		CConstExprEvaluatorProxy::TranslateResultToDXL
 //
 //	@doc:
-//		Evaluate 'expr', assumed to be a constant expression, and return the DXL representation
-// 		of the result. Caller keeps ownership of 'expr' and takes ownership of the returned pointer.
+//		Translate 'result', the result of evaluating an expression, to DXL and
+//		free it. An exception is raised if the result is not a constant.
 //
 //---------------------------------------------------------------------------
 CDXLNode *
-CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
+CConstExprEvaluatorProxy::TranslateResultToDXL(Expr *result)
 {
-	// Translate DXL -> GPDB Expr
-	Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
-		dxl_expr, &m_emptymapcidvar);
-	GPOS_ASSERT(nullptr != expr);
-
-	// Evaluate the expression
-	Expr *result = gpdb::EvaluateExpr(expr, gpdb::ExprType((Node *) expr),
-									  gpdb::ExprTypeMod((Node *) expr));
-
 	if (!IsA(result, Const))
 	{
 #ifdef GPOS_DEBUG
@@ -89,9 +80,75 @@ CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
 	CDXLNode *dxl_result = GPOS_NEW(m_mp)
 		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarConstValue(m_mp, datum_dxl));
 	gpdb::GPDBFree(result);
+
+	return dxl_result;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::EvaluateExpr
+//
+//	@doc:
+//		Evaluate 'expr', assumed to be a constant expression, and return the DXL representation
+// 		of the result. Caller keeps ownership of 'expr' and takes ownership of the returned pointer.
+//
+//---------------------------------------------------------------------------
+CDXLNode *
+CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
+{
+	// Translate DXL -> GPDB Expr
+	Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
+		dxl_expr, &m_emptymapcidvar);
+	GPOS_ASSERT(nullptr != expr);
+
+	// Evaluate the expression
+	Expr *result = gpdb::EvaluateExpr(expr, gpdb::ExprType((Node *) expr),
+									  gpdb::ExprTypeMod((Node *) expr));
+
+	CDXLNode *dxl_result = TranslateResultToDXL(result);
 	gpdb::GPDBFree(expr);
 
 	return dxl_result;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::EvaluateExprs
+//
+//	@doc:
+//		Evaluate 'dxl_exprs', assumed to be constant expressions, in one call
+//		to the executor and return the DXL representation of the results in
+//		the same order. Caller keeps ownership of 'dxl_exprs' and takes
+//		ownership of the returned array.
+//
+//---------------------------------------------------------------------------
+CDXLNodeArray *
+CConstExprEvaluatorProxy::EvaluateExprs(const CDXLNodeArray *dxl_exprs)
+{
+	// Translate DXL -> GPDB Exprs
+	List *exprs = NIL;
+	for (ULONG ul = 0; ul < dxl_exprs->Size(); ul++)
+	{
+		Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
+			(*dxl_exprs)[ul], &m_emptymapcidvar);
+		GPOS_ASSERT(nullptr != expr);
+		exprs = gpdb::LAppend(exprs, expr);
+	}
+
+	// Evaluate the expressions
+	List *results = gpdb::EvaluateExprs(exprs);
+	GPOS_ASSERT(gpdb::ListLength(results) == gpdb::ListLength(exprs));
+
+	CDXLNodeArray *dxl_results = GPOS_NEW(m_mp) CDXLNodeArray(m_mp);
+	ListCell *lc = nullptr;
+	ForEach(lc, results)
+	{
+		dxl_results->Append(TranslateResultToDXL((Expr *) lfirst(lc)));
+	}
+	gpdb::ListFree(results);
+	gpdb::ListFreeDeep(exprs);
+
+	return dxl_results;
+}
+
 // EOF
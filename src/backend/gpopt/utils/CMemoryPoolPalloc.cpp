@@ -18,6 +18,7 @@ extern "C" {
 }
 
 #include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/utils/CMemoryPoolPalloc.h"
@@ -25,9 +26,31 @@ extern "C" {
 using namespace gpos;
 
 // ctor
-CMemoryPoolPalloc::CMemoryPoolPalloc()
+// An arena pool holds objects that mostly die together with the pool, so
+// its context starts with large blocks; AllocSet then serves most requests
+// by bumping a pointer within a block and frees everything at once with
+// the context. A compact pool, such as the one of an MD cache entry, usually
+// holds a single small object, so it starts with small blocks: the context's
+// footprint is what the cache charges against optimizer_mdcache_size.
+CMemoryPoolPalloc::CMemoryPoolPalloc(EAllocStrategy strategy)
 {
-	m_cxt = gpdb::GPDBAllocSetContextCreate();
+	switch (strategy)
+	{
+		case EasArena:
+			m_cxt = gpdb::GPDBAllocSetContextCreate(
+				GPOS_MEM_ARENA_CHUNK_INIT_SIZE, ALLOCSET_DEFAULT_MAXSIZE);
+			break;
+
+		case EasCompact:
+			m_cxt = gpdb::GPDBAllocSetContextCreate(ALLOCSET_SMALL_INITSIZE,
+													ALLOCSET_SMALL_MAXSIZE);
+			break;
+
+		default:
+			m_cxt = gpdb::GPDBAllocSetContextCreate(ALLOCSET_DEFAULT_INITSIZE,
+													ALLOCSET_DEFAULT_MAXSIZE);
+			break;
+	}
 }
 
 void *
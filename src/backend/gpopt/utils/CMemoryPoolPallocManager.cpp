@@ -31,9 +31,9 @@ CMemoryPoolPallocManager::CMemoryPoolPallocManager(CMemoryPool *internal,
 
 // create new memory pool
 CMemoryPool *
-CMemoryPoolPallocManager::NewMemoryPool()
+CMemoryPoolPallocManager::NewMemoryPool(CMemoryPool::EAllocStrategy strategy)
 {
-	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPalloc();
+	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPalloc(strategy);
 }
 
 void
@@ -36,6 +36,7 @@ extern "C" {
 #include "gpopt/config/CConfigParamMapping.h"
 #include "gpopt/engine/CCTEConfig.h"
 #include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/engine/CHint.h"
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/eval/CConstExprEvaluatorDXL.h"
@@ -66,9 +67,12 @@ extern "C" {
 #include "naucrates/exception.h"
 #include "naucrates/init.h"
 #include "naucrates/md/CMDIdCast.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdGPDB.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CSystemId.h"
+#include "naucrates/md/IMDCacheObject.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDRelStats.h"
 #include "naucrates/traceflags/traceflags.h"
@@ -81,9 +85,6 @@ using namespace gpdbcost;
 // size of error buffer
 #define GPOPT_ERROR_BUFFER_SIZE 10 * 1024 * 1024
 
-// definition of default AutoMemoryPool
-#define AUTO_MEM_POOL(amp) CAutoMemoryPool amp(CAutoMemoryPool::ElcExc)
-
 // default id for the source system
 const CSystemId default_sysid(IMDId::EmdidGeneral, GPOS_WSZ_STR_LENGTH("GPDB"));
 
@@ -308,6 +309,76 @@ COptTasks::ConvertToPlanStmtFromDXL(
 }
 
 
+// append an entry of the optimization profile to the given list
+static List *
+AppendProfileEntry(List *profile_list, const CHAR *kind, const CHAR *name,
+				   const COptimizationProfile::SCounters &counters)
+{
+	List *entry = NIL;
+	entry = gpdb::LAppend(entry, gpdb::MakeStringValue(PStrDup(kind)));
+	entry = gpdb::LAppend(entry, gpdb::MakeStringValue(PStrDup(name)));
+	entry = gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_ulCalls));
+	entry = gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_ullTimeUS));
+	entry = gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_lMemBytes));
+	entry = gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_ulGroups));
+	entry =
+		gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_ulGroupExprs));
+	entry = gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_ulBindings));
+	entry = gpdb::LAppend(entry, gpdb::MakeIntegerValue(counters.m_ulResults));
+
+	return gpdb::LAppend(profile_list, entry);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ConvertToProfileList
+//
+//	@doc:
+//		Translate an optimization profile into a list of entries, one per
+//		search stage, job type and applied xform
+//
+//---------------------------------------------------------------------------
+List *
+COptTasks::ConvertToProfileList(const COptimizationProfile *profile)
+{
+	GPOS_ASSERT(nullptr != profile);
+
+	List *profile_list = NIL;
+	for (ULONG ul = 0; ul < profile->UlStages(); ul++)
+	{
+		CHAR stage_name[16];
+		snprintf(stage_name, sizeof(stage_name), "%u", ul);
+		profile_list = AppendProfileEntry(profile_list, "Stage", stage_name,
+										  profile->Stage(ul));
+	}
+
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		if (0 < profile->Job(ul).m_ulCalls)
+		{
+			profile_list =
+				AppendProfileEntry(profile_list, "Job",
+								   COptimizationProfile::SzJobType(ul),
+								   profile->Job(ul));
+		}
+	}
+
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		if (0 < profile->Xform(ul).m_ulCalls)
+		{
+			profile_list = AppendProfileEntry(
+				profile_list, "Xform",
+				CXformFactory::Pxff()->Pxf((CXform::EXformId) ul)->SzId(),
+				profile->Xform(ul));
+		}
+	}
+
+	return profile_list;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::LoadSearchStrategy
@@ -385,6 +456,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model,
 		(ULONG) optimizer_push_group_by_below_setop_threshold;
 	ULONG xform_bind_threshold = (ULONG) optimizer_xform_bind_threshold;
 	ULONG skew_factor = (ULONG) optimizer_skew_factor;
+	ULONG planning_deadline = (ULONG) optimizer_planning_deadline;
 
 	return GPOS_NEW(mp) COptimizerConfig(
 		GPOS_NEW(mp)
@@ -400,7 +472,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model,
 				  false, /* don't create Assert nodes for constraints, we'll
 								      * enforce them ourselves in the executor */
 				  push_group_by_below_setop_threshold, xform_bind_threshold,
-				  skew_factor),
+				  skew_factor, planning_deadline),
 		plan_hints,
 		GPOS_NEW(mp) CWindowOids(OID(F_WINDOW_ROW_NUMBER), OID(F_WINDOW_RANK)));
 }
@@ -732,50 +804,142 @@ COptTasks::GetPlanHints(CMemoryPool *mp, Query *query)
 
 //---------------------------------------------------------------------------
 //	@function:
-//		COptTasks::OptimizeTask
+//		COptTasks::IsInvalidatedMDCacheEntry
 //
 //	@doc:
-//		task that does the optimizes query to physical DXL
+//		Does the given metadata cache entry depend on a catalog object that
+//		was changed since the last query was planned?
 //
 //---------------------------------------------------------------------------
-void *
-COptTasks::OptimizeTask(void *ptr)
+BOOL
+COptTasks::IsInvalidatedMDCacheEntry(CMDKey *const &mdkey,
+									 IMDCacheObject *const &md_obj,
+									 void *	 // context
+)
 {
-	GPOS_ASSERT(nullptr != ptr);
-	SOptContext *opt_ctxt = SOptContext::Cast(ptr);
-
-	GPOS_ASSERT(nullptr != opt_ctxt->m_query);
-	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_dxl);
-	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_stmt);
+	const IMDId *mdid = mdkey->MDId();
 
-	AUTO_MEM_POOL(amp);
-	CMemoryPool *mp = amp.Pmp();
+	switch (mdid->MdidType())
+	{
+		case IMDId::EmdidGeneral:
+			// operators, functions and aggregates are only invalidated by
+			// resetting the whole cache
+			return IMDCacheObject::EmdtType == md_obj->MDType() &&
+				   gpdb::MDCacheTypeInvalidated(
+					   CMDIdGPDB::CastMdid(mdid)->Oid());
+
+		case IMDId::EmdidRel:
+		case IMDId::EmdidInd:
+		case IMDId::EmdidExtStatsInfo:
+			return gpdb::MDCacheRelationInvalidated(
+				CMDIdGPDB::CastMdid(mdid)->Oid());
+
+		case IMDId::EmdidRelStats:
+			return gpdb::MDCacheRelationInvalidated(
+				CMDIdGPDB::CastMdid(
+					CMDIdRelStats::CastMdid(mdid)->GetRelMdId())
+					->Oid());
+
+		case IMDId::EmdidColStats:
+			return gpdb::MDCacheColStatsInvalidated(
+				CMDIdGPDB::CastMdid(
+					CMDIdColStats::CastMdid(mdid)->GetRelMdId())
+					->Oid());
+
+		case IMDId::EmdidCheckConstraint:
+			return gpdb::MDCacheConstraintInvalidated(
+				CMDIdGPDB::CastMdid(mdid)->Oid());
+
+		case IMDId::EmdidExtStats:
+			// pg_statistic_ext has no invalidation callback, so extended
+			// statistics go with any change
+			return true;
+
+		default:
+			return false;
+	}
+}
 
-	// Does the metadatacache need to be reset?
-	//
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::RefreshMDCache
+//
+//	@doc:
+//		Initialize the metadata cache, or evict the entries affected by
+//		catalog changes, or change its size if requested
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::RefreshMDCache()
+{
 	// On the first call, before the cache has been initialized, we
 	// don't care about the return value of MDCacheNeedsReset(). But
 	// we need to call it anyway, to give it a chance to initialize
 	// the invalidation mechanism.
-	bool reset_mdcache = gpdb::MDCacheNeedsReset();
+	bool has_invalidations = false;
+	bool reset_mdcache = gpdb::MDCacheNeedsReset(&has_invalidations);
 
-	// initialize metadata cache, or purge if needed, or change size if requested
 	if (!CMDCache::FInitialized())
 	{
 		CMDCache::Init();
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		return;
 	}
-	else if (reset_mdcache)
+
+	if (reset_mdcache)
 	{
 		CMDCache::Reset();
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		return;
 	}
-	else if (CMDCache::ULLGetCacheQuota() !=
-			 (ULLONG) optimizer_mdcache_size * 1024L)
+
+	if (has_invalidations)
+	{
+		GPOS_TRY
+		{
+			(void) CMDCache::Evict(IsInvalidatedMDCacheEntry,
+								   nullptr /*context*/);
+		}
+		GPOS_CATCH_EX(ex)
+		{
+			// the changes are consumed, do not keep a partially evicted cache
+			CMDCache::Reset();
+			CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+			GPOS_RETHROW(ex);
+		}
+		GPOS_CATCH_END;
+	}
+
+	if (CMDCache::ULLGetCacheQuota() != (ULLONG) optimizer_mdcache_size * 1024L)
 	{
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
 	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::OptimizeTask
+//
+//	@doc:
+//		task that does the optimizes query to physical DXL
+//
+//---------------------------------------------------------------------------
+void *
+COptTasks::OptimizeTask(void *ptr)
+{
+	GPOS_ASSERT(nullptr != ptr);
+	SOptContext *opt_ctxt = SOptContext::Cast(ptr);
+
+	GPOS_ASSERT(nullptr != opt_ctxt->m_query);
+	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_dxl);
+	GPOS_ASSERT(nullptr == opt_ctxt->m_plan_stmt);
 
+	// almost everything allocated during optimization dies with the task
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, CMemoryPool::EasArena);
+	CMemoryPool *mp = amp.Pmp();
+
+	// evict metadata cache entries that depend on changed catalog objects
+	RefreshMDCache();
 
 	// load search strategy
 	CSearchStageArray *search_strategy_arr =
@@ -874,6 +1038,12 @@ COptTasks::OptimizeTask(void *ptr)
 						mp, &mda, opt_ctxt->m_query, plan_dxl,
 						opt_ctxt->m_query->canSetTag,
 						query_to_dxl_translator->GetDistributionHashOpsKind()));
+
+				if (nullptr != optimizer_config->GetProfile())
+				{
+					opt_ctxt->m_plan_stmt->optimizerProfile =
+						ConvertToProfileList(optimizer_config->GetProfile());
+				}
 			}
 
 			CStatisticsConfig *stats_conf = optimizer_config->GetStatsConf();
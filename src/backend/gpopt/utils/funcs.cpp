@@ -26,6 +26,7 @@ extern "C" {
 #include "gpos/_api.h"
 
 #include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDCache.h"
 #include "gpopt/utils/COptTasks.h"
 #include "gpopt/utils/funcs.h"
 
@@ -117,3 +118,32 @@ LibraryVersion()
 	PG_RETURN_TEXT_P(result);
 }
 }
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		MDCacheStats
+//
+//	@doc:
+//		Returns the metadata cache counters of the current session as a
+//		message
+//
+//---------------------------------------------------------------------------
+extern "C" {
+Datum
+MDCacheStats()
+{
+	StringInfoData str;
+	initStringInfo(&str);
+	appendStringInfo(&str, "hits: " UINT64_FORMAT, CMDCache::ULLGetCacheHits());
+	appendStringInfo(&str, ", misses: " UINT64_FORMAT,
+					 CMDCache::ULLGetCacheMisses());
+	appendStringInfo(&str, ", invalidated entries: " UINT64_FORMAT,
+					 CMDCache::ULLGetCacheInvalidations());
+	appendStringInfo(&str, ", resets: " UINT64_FORMAT,
+					 CMDCache::ULLGetCacheResets());
+	text *result = cstring_to_text(str.data);
+
+	PG_RETURN_TEXT_P(result);
+}
+}
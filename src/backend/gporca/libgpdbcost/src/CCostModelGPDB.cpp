@@ -1130,7 +1130,9 @@ CCostModelGPDB::CostMergeJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
 	GPOS_ASSERT(nullptr != pci);
 #ifdef GPOS_DEBUG
 	COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
-	GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id);
+	GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id ||
+				COperator::EopPhysicalInnerMergeJoin == op_id ||
+				COperator::EopPhysicalLeftOuterMergeJoin == op_id);
 #endif	// GPOS_DEBUG
 
 	const DOUBLE num_rows_outer = pci->PdRows()[0];
@@ -2508,6 +2510,8 @@ CCostModelGPDB::Cost(
 		}
 
 		case COperator::EopPhysicalFullMergeJoin:
+		case COperator::EopPhysicalInnerMergeJoin:
+		case COperator::EopPhysicalLeftOuterMergeJoin:
 		{
 			return CostMergeJoin(m_mp, exprhdl, this, pci);
 		}
@@ -14,6 +14,8 @@
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
 #include "gpos/common/CHashMap.h"
+#include "gpos/common/COpenHashMap.h"
+#include "gpos/common/COpenHashMapIter.h"
 #include "gpos/common/CList.h"
 #include "gpos/common/DbgPrintMixin.h"
 
@@ -34,16 +36,17 @@ using CColRef2dArray = CDynamicPtrArray<CColRefArray, CleanupRelease>;
 
 // hash map mapping ULONG -> CColRef
 using UlongToColRefMap =
-	CHashMap<ULONG, CColRef, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+	COpenHashMap<ULONG, CColRef, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
 			 CleanupDelete<ULONG>, CleanupNULL<CColRef>>;
 // hash map mapping ULONG -> const CColRef
 using UlongToConstColRefMap =
-	CHashMap<ULONG, const CColRef, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+	COpenHashMap<ULONG, const CColRef, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
 			 CleanupDelete<ULONG>, CleanupNULL<const CColRef>>;
 // iterator
 using UlongToColRefMapIter =
-	CHashMapIter<ULONG, CColRef, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
-				 CleanupDelete<ULONG>, CleanupNULL<CColRef>>;
+	COpenHashMapIter<ULONG, CColRef, gpos::HashValue<ULONG>,
+					 gpos::Equals<ULONG>, CleanupDelete<ULONG>,
+					 CleanupNULL<CColRef>>;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -30,6 +30,12 @@ namespace gpopt
 // range array
 using CRangeArray = CDynamicPtrArray<CRange, CleanupRelease>;
 
+class CConstraintInterval;
+
+// interval array
+using CConstraintIntervalArray =
+	CDynamicPtrArray<CConstraintInterval, CleanupRelease>;
+
 using namespace gpos;
 using namespace gpmd;
 
@@ -56,6 +62,32 @@ private:
 	// does the interval include the null value
 	BOOL m_fIncludesNull;
 
+	// is every range a point whose ends are the same datum; such an
+	// interval is a sorted set of points, which is searched rather than
+	// merged range by range when combined with other intervals
+	BOOL m_fPointSet;
+
+	// position of the first range in the given array, starting at the
+	// given position, that is not disjoint from and to the left of the
+	// given range; the size of the array if there is none
+	static ULONG UlFirstRangeNotLeftOf(CRangeArray *pdrgprng, ULONG ulStart,
+									   CRange *prange);
+
+	// intersection of this point set with another interval
+	CConstraintInterval *PciIntersectPoints(CMemoryPool *mp,
+											CConstraintInterval *pci);
+
+	// union of this point set with another point set
+	CConstraintInterval *PciUnionPoints(CMemoryPool *mp,
+										CConstraintInterval *pci);
+
+	// does this interval contain all points of the given point set
+	BOOL FContainsPoints(CConstraintInterval *pci);
+
+	// union of all given intervals, computed pairwise
+	static CConstraintInterval *PciUnionAll(CMemoryPool *mp,
+											CConstraintIntervalArray *pdrgpci);
+
 	// adds ranges from a source array to a destination array, starting
 	// at the range with the given index
 	static void AddRemainingRanges(CMemoryPool *mp, CRangeArray *pdrgprngSrc,
@@ -168,6 +200,13 @@ public:
 		return m_fIncludesNull;
 	}
 
+	// is the interval a sorted set of points
+	BOOL
+	FPointSet() const
+	{
+		return m_fPointSet;
+	}
+
 	// is this constraint a contradiction
 	BOOL FContradiction() const override;
 
@@ -270,6 +309,12 @@ public:
 		CMemoryPool *mp, CExpression *pexpr, CColRef *colref,
 		BOOL infer_nulls_as = false);
 
+	// combine intervals on the same column into their conjunction or
+	// disjunction; returns NULL if the given constraints are not all
+	// intervals of the same type
+	static CConstraintInterval *PciIntervalFromIntervals(
+		CMemoryPool *mp, CConstraintArray *pdrgpcnstr, BOOL fConj);
+
 };	// class CConstraintInterval
 
 // shorthand for printing, reference
@@ -285,9 +330,6 @@ operator<<(IOstream &os, const CConstraintInterval *interval)
 {
 	return interval->OsPrint(os);
 }
-
-using CConstraintIntervalArray =
-	CDynamicPtrArray<CConstraintInterval, CleanupRelease>;
 }  // namespace gpopt
 
 #endif	// !GPOPT_CConstraintInterval_H
@@ -43,6 +43,7 @@ using namespace gpnaucrates;
 using namespace gpos;
 
 // fwd declarations
+class CExpression;
 class IConstExprEvaluator;
 
 //---------------------------------------------------------------------------
@@ -60,6 +61,14 @@ private:
 	// constant expression evaluator
 	IConstExprEvaluator *m_pceeval;
 
+	// construct a comparison expression from the given components
+	static CExpression *PexprComparison(CMemoryPool *mp, const IDatum *datum1,
+										const IDatum *datum2,
+										IMDType::ECmpType cmp_type);
+
+	// value of the given evaluated comparison
+	static BOOL FComparisonResult(CExpression *pexprResult);
+
 	// construct a comparison expression from the given components and evaluate it
 	BOOL FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
 						 const IDatum *datum2,
@@ -97,6 +106,10 @@ public:
 	BOOL IsGreaterThanOrEqual(const IDatum *datum1,
 							  const IDatum *datum2) const override;
 
+	// tests if every element of the array is less than the next one; the
+	// comparisons that need the external evaluator are evaluated in one batch
+	BOOL IsSorted(const IDatumArray *pdrgpdatum) const override;
+
 };	// CDefaultComparator
 }  // namespace gpopt
 
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CJoinStatsCache.h
+//
+//	@doc:
+//		Cache of join statistics shared by the join order enumerators of
+//		one optimization
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CJoinStatsCache_H
+#define GPOPT_CJoinStatsCache_H
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/COpenHashMap.h"
+#include "gpos/common/CRefCount.h"
+
+#include "naucrates/statistics/IStatistics.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpnaucrates;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CJoinStatsCache
+//
+//	@doc:
+//		Maps a join of memo groups to the statistics derived for it.
+//
+//		The key is the set of ids of the groups being joined, the set of ids
+//		of the groups of the applied join predicates, and the way the join
+//		selectivity was computed. Statistics do not depend on the order in
+//		which the join order enumerators (greedy, min-card, DP, DPv2) join
+//		these groups, so an enumerator can reuse what another one derived
+//		for the same set of relations and predicates. Cached statistics are
+//		immutable and handed out by reference count.
+//
+//---------------------------------------------------------------------------
+class CJoinStatsCache : public CRefCount
+{
+private:
+	//---------------------------------------------------------------------------
+	//	@struct:
+	//		SKey
+	//
+	//	@doc:
+	//		Key of the cache; owns its bitsets
+	//
+	//---------------------------------------------------------------------------
+	struct SKey
+	{
+		// ids of the joined groups
+		CBitSet *m_groups;
+
+		// ids of the groups of the applied predicates
+		CBitSet *m_preds;
+
+		// is join selectivity computed from histogram buckets
+		BOOL m_fBucketScaleFactor;
+
+		// ctor
+		SKey(CBitSet *groups, CBitSet *preds, BOOL fBucketScaleFactor)
+			: m_groups(groups),
+			  m_preds(preds),
+			  m_fBucketScaleFactor(fBucketScaleFactor)
+		{
+			GPOS_ASSERT(nullptr != groups);
+			GPOS_ASSERT(nullptr != preds);
+		}
+
+		// dtor
+		~SKey()
+		{
+			m_groups->Release();
+			m_preds->Release();
+		}
+
+		// hash function
+		static ULONG HashValue(const SKey *key);
+
+		// equality function
+		static BOOL Equals(const SKey *keyFst, const SKey *keySnd);
+	};
+
+	using KeyToStatsMap =
+		COpenHashMap<SKey, IStatistics, SKey::HashValue, SKey::Equals,
+					 CleanupDelete<SKey>, CleanupRelease<IStatistics>>;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// map of cached stats
+	KeyToStatsMap *m_phmkeystats;
+
+public:
+	CJoinStatsCache(const CJoinStatsCache &) = delete;
+
+	// ctor
+	explicit CJoinStatsCache(CMemoryPool *mp);
+
+	// dtor
+	~CJoinStatsCache() override;
+
+	// stats of the given join, or nullptr if not cached;
+	// does not take ownership of the given bitsets
+	IStatistics *Pstats(CBitSet *groups, CBitSet *preds,
+						BOOL fBucketScaleFactor) const;
+
+	// cache the stats of the given join; takes ownership of the given
+	// bitsets and stats
+	void Insert(CBitSet *groups, CBitSet *preds, BOOL fBucketScaleFactor,
+				IStatistics *stats);
+
+	// number of cached entries
+	ULONG
+	Size() const
+	{
+		return m_phmkeystats->Size();
+	}
+};	// class CJoinStatsCache
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CJoinStatsCache_H
+
+// EOF
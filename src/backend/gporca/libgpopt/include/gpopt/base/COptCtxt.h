@@ -17,6 +17,7 @@
 
 #include "gpopt/base/CCTEInfo.h"
 #include "gpopt/base/CColumnFactory.h"
+#include "gpopt/base/CJoinStatsCache.h"
 #include "gpopt/base/IComparator.h"
 #include "gpopt/base/SPartSelectorInfo.h"
 #include "gpopt/mdcache/CMDAccessor.h"
@@ -123,6 +124,9 @@ private:
 	// (required by CDynamicPhysicalScan for recomputing statistics for DPE)
 	SPartSelectorInfo *m_part_selector_info;
 
+	// stats of joins derived by the join order enumerators
+	CJoinStatsCache *m_join_stats_cache;
+
 public:
 	COptCtxt(COptCtxt &) = delete;
 
@@ -297,6 +301,13 @@ public:
 
 	const SPartSelectorInfoEntry *GetPartSelectorInfo(ULONG selector_id) const;
 
+	// join stats cache accessor
+	CJoinStatsCache *
+	GetJoinStatsCache() const
+	{
+		return m_join_stats_cache;
+	}
+
 	// set required system columns
 	void
 	SetReqdSystemCols(CColRefArray *pdrgpcrSystemCols)
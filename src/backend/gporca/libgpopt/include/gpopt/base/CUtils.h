@@ -586,6 +586,9 @@ public:
 	// check if a given operator is a hash join
 	static BOOL FHashJoin(COperator *pop);
 
+	// check if a given operator is a merge join
+	static BOOL FMergeJoin(COperator *pop);
+
 	// check if a given operator is a correlated nested loops join
 	static BOOL FCorrelatedNLJoin(COperator *pop);
 
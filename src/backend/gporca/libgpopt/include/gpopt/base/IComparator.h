@@ -20,15 +20,12 @@
 
 #include "gpos/base.h"
 
-namespace gpnaucrates
-{
-// fwd declarations
-class IDatum;
-}  // namespace gpnaucrates
+#include "naucrates/base/IDatum.h"
 
 namespace gpopt
 {
 using gpnaucrates::IDatum;
+using gpnaucrates::IDatumArray;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -62,6 +59,21 @@ public:
 	// tests if the first argument is greater or equal to the second
 	virtual gpos::BOOL IsGreaterThanOrEqual(const IDatum *datum1,
 											const IDatum *datum2) const = 0;
+
+	// tests if every element of the array is less than the next one
+	virtual gpos::BOOL
+	IsSorted(const IDatumArray *pdrgpdatum) const
+	{
+		for (gpos::ULONG ul = 1; ul < pdrgpdatum->Size(); ul++)
+		{
+			if (!IsLessThan((*pdrgpdatum)[ul - 1], (*pdrgpdatum)[ul]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
 };
 }  // namespace gpopt
 
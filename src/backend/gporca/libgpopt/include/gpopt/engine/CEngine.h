@@ -12,6 +12,7 @@
 #define GPOPT_CEngine_H
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 
 #include "gpopt/search/CMemo.h"
 #include "gpopt/search/CSearchStage.h"
@@ -33,6 +34,7 @@ class COptimizationContext;
 class CReqdPropPlan;
 class CReqdPropRelational;
 class CEnumeratorConfig;
+class COptimizationProfile;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -57,6 +59,15 @@ private:
 	// index of current search stage
 	ULONG m_ulCurrSearchStage;
 
+	// planning deadline in milliseconds, 0 if there is none
+	ULONG m_ulDeadline;
+
+	// time elapsed since optimization started
+	CWallClock m_clockDeadline;
+
+	// has a search stage found a complete plan
+	BOOL m_fPlanFound;
+
 	// memo table
 	CMemo *m_pmemo;
 
@@ -80,6 +91,10 @@ private:
 	// number of alternatives generated by each xform
 	UlongPtrArray *m_pdrgpulpXformResults;
 
+	// time, memory and memo growth per xform, job type and search stage;
+	// nullptr unless profiling is enabled
+	COptimizationProfile *m_profile;
+
 #ifdef GPOS_DEBUG
 
 	// a set of internal debugging function used for recursive
@@ -160,8 +175,11 @@ private:
 	BOOL
 	FSearchTerminated() const
 	{
-		// at least one stage has completed and achieved required cost
-		return (nullptr != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+		// at least one stage has completed and achieved required cost, or
+		// the planning deadline has expired
+		return (nullptr != PssPrevious() &&
+				PssPrevious()->FAchievedReqdCost()) ||
+			   FDeadlineExpired();
 	}
 
 	// generate random plan id
@@ -309,6 +327,20 @@ public:
 		return m_pqc;
 	}
 
+	// memo accessor
+	CMemo *
+	Pmemo() const
+	{
+		return m_pmemo;
+	}
+
+	// optimization profile, nullptr unless profiling is enabled
+	COptimizationProfile *
+	Profile() const
+	{
+		return m_profile;
+	}
+
 	// return current search stage
 	CSearchStage *
 	PssCurrent() const
@@ -316,6 +348,23 @@ public:
 		return (*m_search_stage_array)[m_ulCurrSearchStage];
 	}
 
+	// has the planning deadline expired; the deadline only applies once a
+	// complete plan has been found, so that there is a plan to return
+	BOOL
+	FDeadlineExpired() const
+	{
+		return m_fPlanFound && 0 != m_ulDeadline &&
+			   m_clockDeadline.ElapsedMS() > m_ulDeadline;
+	}
+
+	// is the current search stage timed-out, or has the planning deadline
+	// expired
+	BOOL
+	FTimedOut() const
+	{
+		return PssCurrent()->FTimedOut() || FDeadlineExpired();
+	}
+
 	// current search stage index accessor
 	ULONG
 	UlCurrSearchStage() const
@@ -0,0 +1,198 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COptimizationProfile.h
+//
+//	@doc:
+//		Profile of where the optimization engine spends its time and memory
+//---------------------------------------------------------------------------
+#ifndef GPOPT_COptimizationProfile_H
+#define GPOPT_COptimizationProfile_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CRefCount.h"
+
+#include "gpopt/search/CJob.h"
+#include "gpopt/xforms/CXform.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COptimizationProfile
+//
+//	@doc:
+//		Wall time, memory and memo growth of one optimization, aggregated
+//		per xform, per job type and per search stage.
+//
+//		The profile is collected in release builds when the
+//		EopttraceProfileOptimization trace flag is set. The engine creates
+//		it and attaches it to the optimizer configuration, so that the
+//		caller can read it once the engine is gone.
+//
+//---------------------------------------------------------------------------
+class COptimizationProfile : public CRefCount
+{
+public:
+	//---------------------------------------------------------------------------
+	//	@struct:
+	//		SCounters
+	//
+	//	@doc:
+	//		Counters of one xform, job type or search stage
+	//
+	//---------------------------------------------------------------------------
+	struct SCounters
+	{
+		// number of xform applications, job steps or stages
+		ULONG m_ulCalls{0};
+
+		// wall time in microseconds
+		ULLONG m_ullTimeUS{0};
+
+		// growth of the optimizer memory pool in bytes
+		LINT m_lMemBytes{0};
+
+		// number of groups added to the memo
+		ULONG m_ulGroups{0};
+
+		// number of group expressions added to the memo
+		ULONG m_ulGroupExprs{0};
+
+		// number of xform bindings
+		ULONG m_ulBindings{0};
+
+		// number of xform results
+		ULONG m_ulResults{0};
+
+		// number of completed jobs
+		ULONG m_ulCompleted{0};
+
+		// add the given measurements
+		void
+		Add(ULLONG ullTimeUS, LINT lMemBytes, ULONG ulGroups,
+			ULONG ulGroupExprs)
+		{
+			m_ulCalls++;
+			m_ullTimeUS += ullTimeUS;
+			m_lMemBytes += lMemBytes;
+			m_ulGroups += ulGroups;
+			m_ulGroupExprs += ulGroupExprs;
+		}
+	};
+
+	using SCountersArray = CDynamicPtrArray<SCounters, CleanupDelete>;
+
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// counters per xform
+	SCounters m_rgxform[CXform::ExfSentinel];
+
+	// counters per job type
+	SCounters m_rgjob[CJob::EjtSentinel];
+
+	// counters per search stage
+	SCountersArray *m_pdrgpstage;
+
+	// number of groups in the final memo
+	ULONG m_ulMemoGroups{0};
+
+	// number of group expressions in the final memo
+	ULONG m_ulMemoGroupExprs{0};
+
+public:
+	COptimizationProfile(const COptimizationProfile &) = delete;
+
+	// ctor
+	explicit COptimizationProfile(CMemoryPool *mp);
+
+	// dtor
+	~COptimizationProfile() override;
+
+	// record an xform application
+	void RecordXform(CXform::EXformId exfid, ULLONG ullTimeUS, LINT lMemBytes,
+					 ULONG ulGroups, ULONG ulGroupExprs, ULONG ulBindings,
+					 ULONG ulResults);
+
+	// record a job step
+	void RecordJob(CJob::EJobType ejt, ULLONG ullTimeUS, LINT lMemBytes,
+				   BOOL fCompleted);
+
+	// record a completed search stage
+	void RecordStage(ULLONG ullTimeUS, LINT lMemBytes, ULONG ulGroups,
+					 ULONG ulGroupExprs);
+
+	// record the size of the memo at the end of the search
+	void
+	RecordMemo(ULONG ulGroups, ULONG ulGroupExprs)
+	{
+		m_ulMemoGroups = ulGroups;
+		m_ulMemoGroupExprs = ulGroupExprs;
+	}
+
+	// number of groups in the final memo
+	ULONG
+	UlMemoGroups() const
+	{
+		return m_ulMemoGroups;
+	}
+
+	// number of group expressions in the final memo
+	ULONG
+	UlMemoGroupExprs() const
+	{
+		return m_ulMemoGroupExprs;
+	}
+
+	// counters of the given xform
+	const SCounters &
+	Xform(ULONG exfid) const
+	{
+		GPOS_ASSERT(exfid < CXform::ExfSentinel);
+
+		return m_rgxform[exfid];
+	}
+
+	// counters of the given job type
+	const SCounters &
+	Job(ULONG ejt) const
+	{
+		GPOS_ASSERT(ejt < CJob::EjtSentinel);
+
+		return m_rgjob[ejt];
+	}
+
+	// number of recorded search stages
+	ULONG
+	UlStages() const
+	{
+		return m_pdrgpstage->Size();
+	}
+
+	// counters of the given search stage
+	const SCounters &
+	Stage(ULONG ulStage) const
+	{
+		return *(*m_pdrgpstage)[ulStage];
+	}
+
+	// name of the given job type
+	static const CHAR *SzJobType(ULONG ejt);
+
+	// print function
+	IOstream &OsPrint(IOstream &os) const;
+
+};	// class COptimizationProfile
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_COptimizationProfile_H
+
+// EOF
@@ -21,6 +21,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CColRef.h"
+#include "gpopt/base/CUtils.h"
 #include "gpopt/eval/IConstExprEvaluator.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
 #include "gpopt/translate/CTranslatorExprToDXL.h"
@@ -46,10 +47,22 @@ class IConstDXLNodeEvaluator;
 //	@doc:
 //		Constant expression evaluator implementation that delegates to a DXL evaluator
 //
+//		Results are memoized by expression, so that an expression that has
+//		been evaluated before is not sent to the DXL evaluator again.
+//
 //---------------------------------------------------------------------------
 class CConstExprEvaluatorDXL : public IConstExprEvaluator
 {
 private:
+	// map of evaluated expressions to their results
+	using ExprToResultMap =
+		CHashMap<CExpression, CExpression, CExpression::HashValue,
+				 CUtils::Equals, CleanupRelease<CExpression>,
+				 CleanupRelease<CExpression>>;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
 	// evaluates expressions represented as DXL, not owned
 	IConstDXLNodeEvaluator *m_pconstdxleval;
 
@@ -59,6 +72,21 @@ private:
 	// translates DXL coming from the evaluator back to CExpression
 	CTranslatorDXLToExpr m_trdxl2expr;
 
+	// results of the expressions evaluated so far
+	ExprToResultMap *m_phmexprResult;
+
+	// raise an exception if the given expression cannot be evaluated
+	static void CheckSupported(CExpression *pexpr);
+
+	// result of the given expression if it has been evaluated before,
+	// nullptr otherwise; caller takes ownership of returned expression
+	CExpression *PexprLookup(CExpression *pexpr) const;
+
+	// translate the result of the given evaluated expression and memoize
+	// it; caller takes ownership of returned expression
+	CExpression *PexprMemoize(const CDXLNode *pdxlnExpr,
+							  const CDXLNode *pdxlnResult);
+
 public:
 	CConstExprEvaluatorDXL(const CConstExprEvaluatorDXL &) = delete;
 
@@ -73,6 +101,12 @@ public:
 	// caller takes ownership of returned expression
 	CExpression *PexprEval(CExpression *pexpr) override;
 
+	// evaluate the given expressions and return their results in the same
+	// order; expressions not evaluated before are sent to the DXL evaluator
+	// in one batch; caller takes ownership of returned array
+	CExpressionArray *PdrgpexprEval(CMemoryPool *mp,
+									CExpressionArray *pdrgpexpr) override;
+
 	// Returns true iff the evaluator can evaluate expressions
 	BOOL FCanEvalExpressions() override;
 };
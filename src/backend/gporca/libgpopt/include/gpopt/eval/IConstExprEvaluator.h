@@ -21,12 +21,12 @@
 #include "gpos/base.h"
 #include "gpos/common/CRefCount.h"
 
+#include "gpopt/operators/CExpression.h"
+
 namespace gpopt
 {
 using namespace gpos;
 
-class CExpression;	// forward declaration
-
 //---------------------------------------------------------------------------
 //	@class:
 //		IConstExprEvaluator
@@ -47,6 +47,12 @@ public:
 	// caller takes ownership of returned expression
 	virtual CExpression *PexprEval(CExpression *pexpr) = 0;
 
+	// evaluate the given expressions and return their results as new
+	// expressions, in the same order; the default evaluates them one by one
+	// caller takes ownership of returned array
+	virtual CExpressionArray *PdrgpexprEval(CMemoryPool *mp,
+											CExpressionArray *pdrgpexpr);
+
 	// returns true iff the evaluator can evaluate constant expressions without
 	// subqueries
 	virtual BOOL FCanEvalExpressions() = 0;
@@ -44,6 +44,18 @@ private:
 	// the maximum size of the cache
 	static ULLONG m_ullCacheQuota;
 
+	// number of lookups served by the cache
+	static ULLONG m_ullCacheHits;
+
+	// number of lookups that had to go to the metadata provider
+	static ULLONG m_ullCacheMisses;
+
+	// number of entries evicted because of catalog changes
+	static ULLONG m_ullCacheInvalidations;
+
+	// number of times the whole cache was reset
+	static ULLONG m_ullCacheResets;
+
 	// private ctor
 	CMDCache() = default;
 
@@ -78,6 +90,49 @@ public:
 	// reset global instance
 	static void Reset();
 
+	// evict the entries selected by the given predicate
+	static ULONG Evict(CMDAccessor::MDCache::EvictFuncPtr pfnEvict,
+					   void *pvContext);
+
+	// record the outcome of a cache lookup
+	static void
+	RecordLookup(BOOL fHit)
+	{
+		if (fHit)
+		{
+			m_ullCacheHits++;
+		}
+		else
+		{
+			m_ullCacheMisses++;
+		}
+	}
+
+	// lookup and invalidation counters of the current session
+	static ULLONG
+	ULLGetCacheHits()
+	{
+		return m_ullCacheHits;
+	}
+
+	static ULLONG
+	ULLGetCacheMisses()
+	{
+		return m_ullCacheMisses;
+	}
+
+	static ULLONG
+	ULLGetCacheInvalidations()
+	{
+		return m_ullCacheInvalidations;
+	}
+
+	static ULLONG
+	ULLGetCacheResets()
+	{
+		return m_ullCacheResets;
+	}
+
 	// global accessor
 	static CMDAccessor::MDCache *
 	Pcache()
@@ -37,9 +37,14 @@ class IConstExprEvaluator;
 class CMinidumperUtils
 {
 public:
-	// load a minidump
+	// load a minidump held in XML or binary DXL
 	static CDXLMinidump *PdxlmdLoad(CMemoryPool *mp, const CHAR *file_name);
 
+	// write a minidump in the other DXL encoding: binary DXL for an XML
+	// minidump and XML for a binary one
+	static void ConvertMinidump(CMemoryPool *mp, const CHAR *file_name,
+								const CHAR *szOutputFileName);
+
 	// generate a minidump file name in the provided buffer
 	static void GenerateMinidumpFileName(
 		CHAR *buf, ULONG length, ULONG ulSessionId, ULONG ulCmdId,
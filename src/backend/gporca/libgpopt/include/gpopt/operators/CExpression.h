@@ -221,6 +221,9 @@ public:
 	IStatistics *PstatsDerive(CReqdPropRelational *prprel,
 							  IStatisticsArray *stats_ctxt);
 
+	// attach stats derived for an equivalent expression
+	void AttachStats(IStatistics *stats);
+
 	// reset a derived property
 	void ResetDerivedProperty(CDrvdProp::EPropType ept);
 
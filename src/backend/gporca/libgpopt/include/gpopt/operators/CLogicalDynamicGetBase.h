@@ -68,7 +68,8 @@ protected:
 	// Construct a mapping from each column in root table to an index in each
 	// child partition's table descr by matching column names$
 	static ColRefToUlongMapArray *ConstructRootColMappingPerPart(
-		CMemoryPool *mp, CColRefArray *root_cols, IMdIdArray *partition_mdids);
+		CMemoryPool *mp, CColRefArray *root_cols, IMDId *root_mdid,
+		IMdIdArray *partition_mdids);
 
 	using ColNameToIndexMap =
 		CHashMap<const CWStringConst, ULONG, CWStringConst::HashValue,
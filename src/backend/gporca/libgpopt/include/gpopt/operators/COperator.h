@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CHashMap.h"
+#include "gpos/common/COpenHashMap.h"
 #include "gpos/common/CRefCount.h"
 
 #include "gpopt/base/CColRefSet.h"
@@ -36,8 +37,8 @@ using COperatorArray = CDynamicPtrArray<COperator, CleanupRelease>;
 
 // hash map mapping CColRef -> CColRef
 using ColRefToColRefMap =
-	CHashMap<CColRef, CColRef, CColRef::HashValue, CColRef::Equals,
-			 CleanupNULL<CColRef>, CleanupNULL<CColRef>>;
+	COpenHashMap<CColRef, CColRef, CColRef::HashValue, CColRef::Equals,
+				 CleanupNULL<CColRef>, CleanupNULL<CColRef>>;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -265,6 +266,8 @@ public:
 
 		EopLogicalIndexOnlyGet,
 		EopLogicalDynamicIndexOnlyGet,
+		EopPhysicalInnerMergeJoin,
+		EopPhysicalLeftOuterMergeJoin,
 		EopSentinel
 	};
 
@@ -6,17 +6,12 @@
 
 #include "gpos/base.h"
 
-#include "gpopt/operators/CPhysicalJoin.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 
 namespace gpopt
 {
-class CPhysicalFullMergeJoin : public CPhysicalJoin
+class CPhysicalFullMergeJoin : public CPhysicalMergeJoin
 {
-private:
-	CExpressionArray *m_outer_merge_clauses;
-
-	CExpressionArray *m_inner_merge_clauses;
-
 public:
 	CPhysicalFullMergeJoin(const CPhysicalFullMergeJoin &) = delete;
 
@@ -53,43 +48,6 @@ public:
 		return dynamic_cast<CPhysicalFullMergeJoin *>(pop);
 	}
 
-	CDistributionSpec *PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
-								   CDistributionSpec *pdsRequired,
-								   ULONG child_index,
-								   CDrvdPropArray *pdrgpdpCtxt,
-								   ULONG ulOptReq) const override;
-
-	CEnfdDistribution *Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
-						   CReqdPropPlan *prppInput, ULONG child_index,
-						   CDrvdPropArray *pdrgpdpCtxt,
-						   ULONG ulDistrReq) override;
-
-	COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
-							COrderSpec *posInput, ULONG child_index,
-							CDrvdPropArray *pdrgpdpCtxt,
-							ULONG ulOptReq) const override;
-
-	// compute required rewindability of the n-th child
-	CRewindabilitySpec *PrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
-									CRewindabilitySpec *prsRequired,
-									ULONG child_index,
-									CDrvdPropArray *pdrgpdpCtxt,
-									ULONG ulOptReq) const override;
-
-	// return order property enforcing type for this operator
-	CEnfdProp::EPropEnforcingType EpetOrder(
-		CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
-
-	CEnfdDistribution::EDistributionMatching Edm(
-		CReqdPropPlan *,   // prppInput
-		ULONG,			   //child_index,
-		CDrvdPropArray *,  // pdrgpdpCtxt,
-		ULONG			   // ulOptReq
-		) override;
-
-	CDistributionSpec *PdsDerive(CMemoryPool *mp,
-								 CExpressionHandle &exprhdl) const override;
-
 };	// class CPhysicalFullMergeJoin
 
 }  // namespace gpopt
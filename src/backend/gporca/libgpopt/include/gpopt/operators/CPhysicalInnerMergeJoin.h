@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2024 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPhysicalInnerMergeJoin.h
+//
+//	@doc:
+//		Inner merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalInnerMergeJoin_H
+#define GPOPT_CPhysicalInnerMergeJoin_H
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Inner merge join operator
+//
+//---------------------------------------------------------------------------
+class CPhysicalInnerMergeJoin : public CPhysicalMergeJoin
+{
+public:
+	CPhysicalInnerMergeJoin(const CPhysicalInnerMergeJoin &) = delete;
+
+	// ctor
+	CPhysicalInnerMergeJoin(
+		CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+		CExpressionArray *inner_merge_clauses, IMdIdArray *hash_opfamilies,
+		BOOL is_null_aware = true,
+		CXform::EXformId origin_xform = CXform::ExfSentinel);
+
+	// dtor
+	~CPhysicalInnerMergeJoin() override;
+
+	// ident accessors
+	EOperatorId
+	Eopid() const override
+	{
+		return EopPhysicalInnerMergeJoin;
+	}
+
+	// return a string for operator name
+	const CHAR *
+	SzId() const override
+	{
+		return "CPhysicalInnerMergeJoin";
+	}
+
+	// conversion function
+	static CPhysicalInnerMergeJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(EopPhysicalInnerMergeJoin == pop->Eopid());
+
+		return dynamic_cast<CPhysicalInnerMergeJoin *>(pop);
+	}
+
+};	// class CPhysicalInnerMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalInnerMergeJoin_H
+
+// EOF
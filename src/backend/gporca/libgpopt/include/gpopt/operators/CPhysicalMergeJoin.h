@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2024 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPhysicalMergeJoin.h
+//
+//	@doc:
+//		Base merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalMergeJoin_H
+#define GPOPT_CPhysicalMergeJoin_H
+
+#include "gpos/base.h"
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CPhysicalJoin.h"
+
+namespace gpopt
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalMergeJoin
+//
+//	@doc:
+//		Base merge join operator; requires both children to be co-located
+//		on, and sorted by, the merge clauses. Join predicates that are not
+//		merge clauses are evaluated as a join filter on the matched rows.
+//
+//---------------------------------------------------------------------------
+class CPhysicalMergeJoin : public CPhysicalJoin
+{
+private:
+	// merge clauses of the outer child
+	CExpressionArray *m_outer_merge_clauses;
+
+	// merge clauses of the inner child
+	CExpressionArray *m_inner_merge_clauses;
+
+protected:
+	// ctor
+	CPhysicalMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+					   CExpressionArray *inner_merge_clauses,
+					   CXform::EXformId origin_xform);
+
+public:
+	CPhysicalMergeJoin(const CPhysicalMergeJoin &) = delete;
+
+	// dtor
+	~CPhysicalMergeJoin() override;
+
+	// merge clauses of the outer child
+	CExpressionArray *
+	PdrgpexprOuterKeys() const
+	{
+		return m_outer_merge_clauses;
+	}
+
+	// merge clauses of the inner child
+	CExpressionArray *
+	PdrgpexprInnerKeys() const
+	{
+		return m_inner_merge_clauses;
+	}
+
+	CDistributionSpec *PdsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+								   CDistributionSpec *pdsRequired,
+								   ULONG child_index,
+								   CDrvdPropArray *pdrgpdpCtxt,
+								   ULONG ulOptReq) const override;
+
+	CEnfdDistribution *Ped(CMemoryPool *mp, CExpressionHandle &exprhdl,
+						   CReqdPropPlan *prppInput, ULONG child_index,
+						   CDrvdPropArray *pdrgpdpCtxt,
+						   ULONG ulDistrReq) override;
+
+	COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+							COrderSpec *posInput, ULONG child_index,
+							CDrvdPropArray *pdrgpdpCtxt,
+							ULONG ulOptReq) const override;
+
+	// compute required rewindability of the n-th child
+	CRewindabilitySpec *PrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl,
+									CRewindabilitySpec *prsRequired,
+									ULONG child_index,
+									CDrvdPropArray *pdrgpdpCtxt,
+									ULONG ulOptReq) const override;
+
+	// return order property enforcing type for this operator
+	CEnfdProp::EPropEnforcingType EpetOrder(
+		CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
+
+	CEnfdDistribution::EDistributionMatching Edm(
+		CReqdPropPlan *,   // prppInput
+		ULONG,			   //child_index,
+		CDrvdPropArray *,  // pdrgpdpCtxt,
+		ULONG			   // ulOptReq
+		) override;
+
+	CDistributionSpec *PdsDerive(CMemoryPool *mp,
+								 CExpressionHandle &exprhdl) const override;
+
+	// conversion function
+	static CPhysicalMergeJoin *
+	PopConvert(COperator *pop)
+	{
+		GPOS_ASSERT(CUtils::FMergeJoin(pop));
+
+		return dynamic_cast<CPhysicalMergeJoin *>(pop);
+	}
+
+};	// class CPhysicalMergeJoin
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CPhysicalMergeJoin_H
+
+// EOF
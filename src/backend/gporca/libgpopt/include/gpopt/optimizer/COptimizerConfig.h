@@ -29,6 +29,7 @@ using namespace gpos;
 
 // forward decl
 class ICostModel;
+class COptimizationProfile;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -69,6 +70,9 @@ private:
 	// default window oids
 	CWindowOids *m_window_oids;
 
+	// profile of the optimization, if requested
+	COptimizationProfile *m_profile{nullptr};
+
 public:
 	// ctor
 	COptimizerConfig(CEnumeratorConfig *pec, CStatisticsConfig *stats_config,
@@ -127,6 +131,16 @@ public:
 		return m_plan_hint;
 	}
 
+	// profile of the optimization, nullptr if it was not collected
+	COptimizationProfile *
+	GetProfile() const
+	{
+		return m_profile;
+	}
+
+	// attach the profile of the optimization; takes ownership
+	void SetProfile(COptimizationProfile *profile);
+
 	// generate default optimizer configurations
 	static COptimizerConfig *PoconfDefault(CMemoryPool *mp);
 
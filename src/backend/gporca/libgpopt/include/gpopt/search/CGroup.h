@@ -412,6 +412,10 @@ public:
 		return m_pccDummy;
 	}
 
+	// id identifying the group in hashes, that of the group it was merged
+	// into if it has been merged
+	ULONG IdForHash() const;
+
 	// hash function
 	ULONG HashValue() const;
 
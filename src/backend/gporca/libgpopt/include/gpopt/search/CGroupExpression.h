@@ -102,6 +102,10 @@ private:
 	// of order-insensitive operators
 	CGroupArray *m_pdrgpgroupSorted{nullptr};
 
+	// structural fingerprint of operator and child groups, see
+	// UllFingerprint
+	ULLONG m_ullFingerprint{0};
+
 	// back pointer to group
 	CGroup *m_pgroup{nullptr};
 
@@ -308,12 +312,14 @@ public:
 		return gexpr.Matches(this);
 	}
 
-	// equality function for hash table
+	// equality function for hash table; group expressions with different
+	// fingerprints cannot match, which spares comparing them in full
 	static BOOL
 	Equals(const CGroupExpression &gexprLeft,
 		   const CGroupExpression &gexprRight)
 	{
-		return gexprLeft == gexprRight;
+		return gexprLeft.m_ullFingerprint == gexprRight.m_ullFingerprint &&
+			   gexprLeft == gexprRight;
 	}
 
 	// match group expression against given operator and its children
@@ -322,15 +328,25 @@ public:
 	// match non-scalar children of group expression against given children of passed expression
 	BOOL FMatchNonScalarChildren(const CGroupExpression *pgexpr) const;
 
-	// hash function
+	// structural fingerprint
+	ULLONG
+	UllFingerprint() const
+	{
+		return m_ullFingerprint;
+	}
+
+	// recompute fingerprint after child groups were merged - not thread-safe
+	void ResetFingerprint();
+
+	// hash function, folds the fingerprint
 	ULONG
 	HashValue() const
 	{
-		return HashValue(m_pop, m_pdrgpgroup);
+		return (ULONG)(m_ullFingerprint ^ (m_ullFingerprint >> 32));
 	}
 
-	// static hash function for operator and group references
-	static ULONG HashValue(COperator *pop, CGroupArray *drgpgroup);
+	// static fingerprint function for operator and group references
+	static ULLONG UllFingerprint(COperator *pop, CGroupArray *pdrgpgroup);
 
 	// static hash function for group expression
 	static ULONG HashValue(const CGroupExpression &);
@@ -143,8 +143,9 @@ public:
 		TEnumState estNext = estSentinel;
 		do
 		{
-			// check if current search stage is timed-out
-			if (psc->Peng()->PssCurrent()->FTimedOut())
+			// check if current search stage is timed-out or the planning
+			// deadline has expired
+			if (psc->Peng()->FTimedOut())
 			{
 				// cleanup job state and terminate state machine
 				pjOwner->Cleanup();
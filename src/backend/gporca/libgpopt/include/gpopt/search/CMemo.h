@@ -67,6 +67,9 @@ private:
 	// number of groups
 	ULONG_PTR m_ulpGrps;
 
+	// number of group expressions inserted so far
+	ULONG_PTR m_ulpGrpExprsInserted{0};
+
 	// tree map of member group expressions
 	MemoTreeMap *m_pmemotmap;
 
@@ -118,9 +121,22 @@ public:
 	// return total number of group expressions
 	ULONG UlGrpExprs();
 
+	// return number of group expressions inserted so far, including those
+	// of groups that were merged later; cheaper than UlGrpExprs()
+	ULONG_PTR
+	UlpGrpExprsInserted() const
+	{
+		return m_ulpGrpExprsInserted;
+	}
+
 	// return number of duplicate groups
 	ULONG UlDuplicateGroups();
 
+	// count collisions of 32-bit hash values and of fingerprints of group
+	// expressions in memo hash table - not thread-safe
+	void CountFingerprintCollisions(ULONG *pulHashCollisions,
+									ULONG *pulFingerprintCollisions);
+
 	// mark groups as duplicates
 	static void MarkDuplicates(CGroup *pgroupFst, CGroup *pgroupSnd);
 
@@ -147,6 +147,9 @@ public:
 
 	// generate default search strategy
 	static CSearchStageArray *PdrgpssDefault(CMemoryPool *mp);
+
+	// generate search strategy for optimization under a planning deadline
+	static CSearchStageArray *PdrgpssAnytime(CMemoryPool *mp);
 };
 
 // shorthand for printing
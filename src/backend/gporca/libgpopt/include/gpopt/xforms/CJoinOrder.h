@@ -215,6 +215,21 @@ protected:
 	// derive stats on a given component
 	virtual void DeriveStats(CExpression *pexpr);
 
+	// does DeriveStats compute join selectivity from histogram buckets
+	virtual BOOL
+	FStatsFromHistogramBuckets() const
+	{
+		return false;
+	}
+
+	// compute the join stats cache key of the given set of components
+	BOOL FJoinStatsKey(CBitSet *pbsComps, CBitSet *pbsGroups,
+					   CBitSet *pbsPreds) const;
+
+	// derive stats on an expression joining the given set of components,
+	// reusing stats derived for the same join in this optimization
+	void DeriveJoinStats(CExpression *pexpr, CBitSet *pbsComps);
+
 	// mark edges used by expression
 	void MarkUsedEdges(SComponent *comp);
 
@@ -14,6 +14,8 @@
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
 #include "gpos/common/CHashMap.h"
+#include "gpos/common/COpenHashMap.h"
+#include "gpos/common/COpenHashMapIter.h"
 #include "gpos/common/DbgPrintMixin.h"
 #include "gpos/io/IOstream.h"
 
@@ -317,14 +319,20 @@ private:
 	{
 		// the set of atoms, this uniquely identifies the group
 		CBitSet *m_atoms;
+		// the edges that reference any of the atoms, used to quickly find
+		// the join predicates between two groups
+		CBitSet *m_edges;
 		// infos of the best (lowest cost) expressions (so far, if at the current level)
 		// for each interesting property
 		SExpressionInfoArray *m_best_expr_info_array;
 		CDouble m_cardinality;
 		CDouble m_lowest_expr_cost;
 
-		SGroupInfo(CMemoryPool *mp, CBitSet *atoms)
-			: m_atoms(atoms), m_cardinality(-1.0), m_lowest_expr_cost(-1.0)
+		SGroupInfo(CMemoryPool *mp, CBitSet *atoms, CBitSet *edges)
+			: m_atoms(atoms),
+			  m_edges(edges),
+			  m_cardinality(-1.0),
+			  m_lowest_expr_cost(-1.0)
 		{
 			m_best_expr_info_array = GPOS_NEW(mp) SExpressionInfoArray(mp);
 		}
@@ -332,6 +340,7 @@ private:
 		~SGroupInfo() override
 		{
 			m_atoms->Release();
+			m_edges->Release();
 			m_best_expr_info_array->Release();
 		}
 
@@ -395,13 +404,13 @@ private:
 
 	// dynamic array of SGroupInfos
 	using BitSetToGroupInfoMap =
-		CHashMap<CBitSet, SGroupInfo, UlHashBitSet, FEqualBitSet,
-				 CleanupRelease<CBitSet>, CleanupRelease<SGroupInfo>>;
+		COpenHashMap<CBitSet, SGroupInfo, UlHashBitSet, FEqualBitSet,
+					 CleanupRelease<CBitSet>, CleanupRelease<SGroupInfo>>;
 
 	// iterator over group infos in a level
 	using BitSetToGroupInfoMapIter =
-		CHashMapIter<CBitSet, SGroupInfo, UlHashBitSet, FEqualBitSet,
-					 CleanupRelease<CBitSet>, CleanupRelease<SGroupInfo>>;
+		COpenHashMapIter<CBitSet, SGroupInfo, UlHashBitSet, FEqualBitSet,
+						 CleanupRelease<CBitSet>, CleanupRelease<SGroupInfo>>;
 
 	// dynamic array of SLevelInfos, where each index represents the level
 	using DPv2Levels = CDynamicPtrArray<SLevelInfo, CleanupRelease<SLevelInfo>>;
@@ -450,7 +459,11 @@ private:
 	}
 
 	// build expression linking given groups
-	CExpression *PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd);
+	CExpression *PexprBuildInnerJoinPred(SGroupInfo *pgiFst,
+										 SGroupInfo *pgiSnd);
+
+	// edges referencing any of the given atoms
+	CBitSet *PbsEdgesOfAtoms(CBitSet *atoms);
 
 	// compute cost of a join expression in a group
 	void ComputeCost(SExpressionInfo *expr_info, CDouble join_cardinality);
@@ -474,6 +487,12 @@ private:
 
 	void DeriveStats(CExpression *pexpr) override;
 
+	BOOL
+	FStatsFromHistogramBuckets() const override
+	{
+		return true;
+	}
+
 	// create a CLogicalJoin and a CExpression to join two groups, for a required property
 	SExpressionInfo *GetJoinExprForProperties(
 		SGroupInfo *left_child, SGroupInfo *right_child,
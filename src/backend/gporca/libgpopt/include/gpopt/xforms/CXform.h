@@ -234,6 +234,8 @@ public:
 		ExfSelect2IndexOnlyGet,
 		ExfSelect2DynamicIndexOnlyGet,
 		ExfLimit2IndexOnlyGet,
+		ExfInnerJoin2MergeJoin,
+		ExfLeftOuterJoin2MergeJoin,
 		ExfInvalid,
 		ExfSentinel = ExfInvalid
 	};
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2024 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CXformInnerJoin2MergeJoin.h
+//
+//	@doc:
+//		Transform inner join to inner merge join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformInnerJoin2MergeJoin_H
+#define GPOPT_CXformInnerJoin2MergeJoin_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformImplementation.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformInnerJoin2MergeJoin
+//
+//	@doc:
+//		Transform inner join to inner merge join
+//
+//---------------------------------------------------------------------------
+class CXformInnerJoin2MergeJoin : public CXformImplementation
+{
+private:
+public:
+	CXformInnerJoin2MergeJoin(const CXformInnerJoin2MergeJoin &) = delete;
+
+	// ctor
+	explicit CXformInnerJoin2MergeJoin(CMemoryPool *mp);
+
+	// dtor
+	~CXformInnerJoin2MergeJoin() override = default;
+
+	// ident accessors
+	EXformId
+	Exfid() const override
+	{
+		return ExfInnerJoin2MergeJoin;
+	}
+
+	// return a string for xform name
+	const CHAR *
+	SzId() const override
+	{
+		return "CXformInnerJoin2MergeJoin";
+	}
+
+	// compute xform promise for a given expression handle
+	EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const override;
+
+};	// class CXformInnerJoin2MergeJoin
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformInnerJoin2MergeJoin_H
+
+// EOF
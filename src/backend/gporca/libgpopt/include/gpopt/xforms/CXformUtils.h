@@ -810,9 +810,20 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 	CExpressionArray *pdrgpexprInner = nullptr;
 	IMdIdArray *join_opfamilies = nullptr;
 
-	// check if we have already computed join keys for the scalar child
-	LookupJoinKeys(mp, pexpr, &pdrgpexprOuter, &pdrgpexprInner,
-				   &join_opfamilies);
+	// a full merge join evaluates all of its predicates as merge clauses;
+	// inner and left outer merge joins evaluate the predicates that are not
+	// merge joinable as a join filter
+	const BOOL fFullJoin =
+		COperator::EopLogicalFullOuterJoin == pexpr->Pop()->Eopid();
+
+	// check if we have already computed join keys for the scalar child;
+	// the keys cached on the scalar child of an inner or left outer join
+	// are hash join keys, which need not be merge joinable
+	if (fFullJoin)
+	{
+		LookupJoinKeys(mp, pexpr, &pdrgpexprOuter, &pdrgpexprInner,
+					   &join_opfamilies);
+	}
 	if (nullptr != pdrgpexprOuter)
 	{
 		GPOS_ASSERT(nullptr != pdrgpexprInner);
@@ -883,7 +894,7 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 				join_opfamilies->Append(hash_opfamily);
 			}
 		}
-		else
+		else if (fFullJoin)
 		{
 			// In case of FULL merge joins, all the merge clauses must be merge
 			// compatible or we cannot create a merge join.
@@ -898,16 +909,29 @@ CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres,
 	GPOS_ASSERT_IMP(GPOS_FTRACE(EopttraceConsiderOpfamiliesForDistribution),
 					pdrgpexprInner->Size() == join_opfamilies->Size());
 
-	// construct new MergeJoin expression using explicit casting, if needed
-	pexpr->Pop()->AddRef();
-	pexprOuter->AddRef();
-	pexprInner->AddRef();
-	CExpression *pexprResult = GPOS_NEW(mp)
-		CExpression(mp, pexpr->Pop(), pexprOuter, pexprInner,
-					CPredicateUtils::PexprConjunction(mp, pdrgpexpr));
-
-	// cache hash join keys on scalar child group
-	CacheJoinKeys(pexprResult, pdrgpexprOuter, pdrgpexprInner, join_opfamilies);
+	CExpression *pexprResult = nullptr;
+	if (fFullJoin)
+	{
+		// construct new MergeJoin expression using explicit casting, if needed
+		pexpr->Pop()->AddRef();
+		pexprOuter->AddRef();
+		pexprInner->AddRef();
+		pexprResult = GPOS_NEW(mp)
+			CExpression(mp, pexpr->Pop(), pexprOuter, pexprInner,
+						CPredicateUtils::PexprConjunction(mp, pdrgpexpr));
+
+		// cache hash join keys on scalar child group
+		CacheJoinKeys(pexprResult, pdrgpexprOuter, pdrgpexprInner,
+					  join_opfamilies);
+	}
+	else
+	{
+		// keep the join predicate as is, the translator to DXL splits it
+		// into merge clauses and join filter
+		pdrgpexpr->Release();
+		pexpr->AddRef();
+		pexprResult = pexpr;
+	}
 
 	// Add an alternative only if we found at least one merge-joinable predicate
 	if (0 != pdrgpexprOuter->Size())
@@ -80,6 +80,7 @@
 #include "gpopt/xforms/CXformInnerApply2InnerJoin.h"
 #include "gpopt/xforms/CXformInnerApply2InnerJoinNoCorrelations.h"
 #include "gpopt/xforms/CXformInnerApplyWithOuterKey2InnerJoin.h"
+#include "gpopt/xforms/CXformInnerJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinNotInSwap.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinSwap.h"
 #include "gpopt/xforms/CXformInnerJoinSemiJoinSwap.h"
@@ -106,6 +107,7 @@
 #include "gpopt/xforms/CXformLeftOuterApply2LeftOuterJoin.h"
 #include "gpopt/xforms/CXformLeftOuterApply2LeftOuterJoinNoCorrelations.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2HashJoin.h"
+#include "gpopt/xforms/CXformLeftOuterJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLeftSemiApply2LeftSemiJoin.h"
 #include "gpopt/xforms/CXformLeftSemiApply2LeftSemiJoinNoCorrelations.h"
@@ -879,6 +879,20 @@ CConstraint::PdrgpcnstrDeduplicate(CMemoryPool *mp,
 			continue;
 		}
 
+		GPOS_ASSERT(EctConjunction == ect || EctDisjunction == ect);
+
+		// intervals are combined directly, rather than through their
+		// scalar expressions
+		CConstraint *pcnstrNew = CConstraintInterval::PciIntervalFromIntervals(
+			mp, pdrgpcnstrCol, EctConjunction == ect);
+		if (nullptr != pcnstrNew)
+		{
+			pdrgpcnstrCol->Release();
+			pdrgpcnstrNew->Append(pcnstrNew);
+			pcrsDeduped->Include(colref);
+			continue;
+		}
+
 		CExpression *pexpr = nullptr;
 
 		if (EctConjunction == ect)
@@ -887,13 +901,12 @@ CConstraint::PdrgpcnstrDeduplicate(CMemoryPool *mp,
 		}
 		else
 		{
-			GPOS_ASSERT(EctDisjunction == ect);
 			pexpr = PexprScalarConjDisj(mp, pdrgpcnstrCol, false /*fConj*/);
 		}
 		pdrgpcnstrCol->Release();
 		GPOS_ASSERT(nullptr != pexpr);
 
-		CConstraint *pcnstrNew =
+		pcnstrNew =
 			CConstraintInterval::PciIntervalFromScalarExpr(mp, pexpr, colref);
 		if (nullptr == pcnstrNew)
 		{
@@ -46,11 +46,24 @@ CConstraintInterval::CConstraintInterval(CMemoryPool *mp, const CColRef *colref,
 	: CConstraint(mp, GPOS_NEW(mp) CColRefSet(mp)),
 	  m_pcr(colref),
 	  m_pdrgprng(pdrgprng),
-	  m_fIncludesNull(fIncludesNull)
+	  m_fIncludesNull(fIncludesNull),
+	  m_fPointSet(true)
 {
 	GPOS_ASSERT(nullptr != colref);
 	GPOS_ASSERT(nullptr != pdrgprng);
 	m_pcrsUsed->Include(colref);
+
+	// only compare pointers here, so that detecting a point set does not
+	// cost any datum comparisons
+	const ULONG length = pdrgprng->Size();
+	for (ULONG ul = 0; ul < length && m_fPointSet; ul++)
+	{
+		CRange *prange = (*pdrgprng)[ul];
+		m_fPointSet = nullptr != prange->PdatumLeft() &&
+					  prange->PdatumLeft() == prange->PdatumRight() &&
+					  CRange::EriIncluded == prange->EriLeft() &&
+					  CRange::EriIncluded == prange->EriRight();
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -296,8 +309,10 @@ CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(CMemoryPool *mp,
 	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
 	gpos::CAutoRef<CDatumSortedSet> apdatumsortedset(
 		GPOS_NEW(mp) CDatumSortedSet(mp, pexprArray, pcomp));
-	// construct ranges representing IN or NOT IN
-	CRangeArray *prgrng = GPOS_NEW(mp) CRangeArray(mp);
+	// construct ranges representing IN or NOT IN; there is one range per
+	// element, plus one for NOT IN
+	CRangeArray *prgrng =
+		GPOS_NEW(mp) CRangeArray(mp, apdatumsortedset->Size() + 1);
 
 	switch (cmp_type)
 	{
@@ -399,6 +414,83 @@ CConstraintInterval::PciIntervalFromConstraint(CMemoryPool *mp,
 	return PciIntervalFromScalarExpr(mp, pexprScalar, pcrFirst);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PciIntervalFromIntervals
+//
+//	@doc:
+//		Combine intervals on the same column into their conjunction or
+//		disjunction. This gives the same interval as deriving one from the
+//		conjunction or disjunction of their scalar expressions, without
+//		generating and parsing those expressions again, which is costly for
+//		intervals with many ranges, such as the ones of long IN lists.
+//		Returns NULL if any of the given constraints is not an interval, or
+//		if the intervals have different types
+//
+//---------------------------------------------------------------------------
+CConstraintInterval *
+CConstraintInterval::PciIntervalFromIntervals(CMemoryPool *mp,
+											  CConstraintArray *pdrgpcnstr,
+											  BOOL fConj)
+{
+	GPOS_ASSERT(nullptr != pdrgpcnstr);
+	GPOS_ASSERT(0 < pdrgpcnstr->Size());
+
+	const ULONG length = pdrgpcnstr->Size();
+	IMDId *mdid = nullptr;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		CConstraint *pcnstr = (*pdrgpcnstr)[ul];
+		if (CConstraint::EctInterval != pcnstr->Ect())
+		{
+			return nullptr;
+		}
+
+		CRangeArray *pdrgprng =
+			dynamic_cast<CConstraintInterval *>(pcnstr)->Pdrgprng();
+		if (0 == pdrgprng->Size())
+		{
+			continue;
+		}
+
+		IMDId *mdidRange = (*pdrgprng)[0]->MDId();
+		if (nullptr != mdid && !mdid->Equals(mdidRange))
+		{
+			return nullptr;
+		}
+		mdid = mdidRange;
+	}
+
+	CConstraintInterval *pciFirst =
+		dynamic_cast<CConstraintInterval *>((*pdrgpcnstr)[0]);
+	if (fConj)
+	{
+		pciFirst->AddRef();
+		CConstraintInterval *pci = pciFirst;
+		for (ULONG ul = 1; ul < length; ul++)
+		{
+			CConstraintInterval *pciAnd = pci->PciIntersect(
+				mp, dynamic_cast<CConstraintInterval *>((*pdrgpcnstr)[ul]));
+			pci->Release();
+			pci = pciAnd;
+		}
+
+		return pci;
+	}
+
+	CConstraintIntervalArray *pdrgpci =
+		GPOS_NEW(mp) CConstraintIntervalArray(mp);
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		CConstraintInterval *pci =
+			dynamic_cast<CConstraintInterval *>((*pdrgpcnstr)[ul]);
+		pci->AddRef();
+		pdrgpci->Append(pci);
+	}
+
+	return PciUnionAll(mp, pdrgpci);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintInterval::PciIntervalFromScalarNullAndUnknownTest
@@ -829,6 +921,23 @@ CConstraintInterval::PciIntervalFromScalarBoolOr(
 		child_constraints->Append(pciChild);
 	}
 
+	return PciUnionAll(mp, child_constraints);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PciUnionAll
+//
+//	@doc:
+//		Union of all intervals in the given array, which is consumed
+//
+//---------------------------------------------------------------------------
+CConstraintInterval *
+CConstraintInterval::PciUnionAll(CMemoryPool *mp,
+								 CConstraintIntervalArray *child_constraints)
+{
+	GPOS_ASSERT(0 < child_constraints->Size());
+
 	CConstraintIntervalArray *constraints;
 
 	// PciUnion each interval in pairs. Given intervals I1,I2.., I5, perform the unions as follows:
@@ -1258,6 +1367,18 @@ CConstraintInterval::PciIntersect(CMemoryPool *mp, CConstraintInterval *pci)
 
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
+	// search the larger point set for the ranges of the other interval
+	if (m_fPointSet &&
+		(!pci->FPointSet() || m_pdrgprng->Size() >= pdrgprngOther->Size()))
+	{
+		return PciIntersectPoints(mp, pci);
+	}
+
+	if (pci->FPointSet())
+	{
+		return pci->PciIntersectPoints(mp, this);
+	}
+
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
 
 	ULONG ulFst = 0;
@@ -1291,6 +1412,162 @@ CConstraintInterval::PciIntersect(CMemoryPool *mp, CConstraintInterval *pci)
 		mp, m_pcr, pdrgprngNew, m_fIncludesNull && pci->FIncludesNull());
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::UlFirstRangeNotLeftOf
+//
+//	@doc:
+//		Position of the first range in the given array, starting at the
+//		given position, that is not disjoint from and to the left of the
+//		given range. Ranges of an interval are sorted and disjoint, so the
+//		ranges to the left of the given one form a prefix; the search
+//		gallops over it, costing a logarithm of the number of ranges
+//		skipped rather than one comparison per range
+//
+//---------------------------------------------------------------------------
+ULONG
+CConstraintInterval::UlFirstRangeNotLeftOf(CRangeArray *pdrgprng,
+										   ULONG ulStart, CRange *prange)
+{
+	const ULONG length = pdrgprng->Size();
+
+	// find a position that is not to the left of the given range, doubling
+	// the step each time
+	ULONG ulLow = ulStart;
+	ULONG ulHigh = ulStart;
+	ULONG ulStep = 1;
+	while (ulHigh < length && (*pdrgprng)[ulHigh]->FDisjointLeft(prange))
+	{
+		ulLow = ulHigh + 1;
+		ulHigh = ulHigh + ulStep;
+		ulStep = ulStep * 2;
+	}
+	ulHigh = std::min(ulHigh, length);
+
+	// binary search between the last range found to the left and it
+	while (ulLow < ulHigh)
+	{
+		const ULONG ulMid = ulLow + (ulHigh - ulLow) / 2;
+		if ((*pdrgprng)[ulMid]->FDisjointLeft(prange))
+		{
+			ulLow = ulMid + 1;
+		}
+		else
+		{
+			ulHigh = ulMid;
+		}
+	}
+
+	return ulLow;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PciIntersectPoints
+//
+//	@doc:
+//		Intersection of this point set with another interval. Every range of
+//		the other interval looks up the first point not to its left, and
+//		collects the points it contains from there on; no new ranges are
+//		created
+//
+//---------------------------------------------------------------------------
+CConstraintInterval *
+CConstraintInterval::PciIntersectPoints(CMemoryPool *mp,
+										CConstraintInterval *pci)
+{
+	GPOS_ASSERT(m_fPointSet);
+	GPOS_ASSERT(m_pcr == pci->Pcr());
+
+	CRangeArray *pdrgprngOther = pci->Pdrgprng();
+	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
+
+	const ULONG ulPoints = m_pdrgprng->Size();
+	const ULONG ulRanges = pdrgprngOther->Size();
+	ULONG ulPos = 0;
+	for (ULONG ul = 0; ul < ulRanges && ulPos < ulPoints; ul++)
+	{
+		CRange *prange = (*pdrgprngOther)[ul];
+		ulPos = UlFirstRangeNotLeftOf(m_pdrgprng, ulPos, prange);
+
+		// a point that is not to the left of the range is either contained
+		// in it or to its right
+		while (ulPos < ulPoints && prange->Contains((*m_pdrgprng)[ulPos]))
+		{
+			CRange *prangePoint = (*m_pdrgprng)[ulPos];
+			prangePoint->AddRef();
+			pdrgprngNew->Append(prangePoint);
+			ulPos++;
+		}
+	}
+
+	return GPOS_NEW(mp) CConstraintInterval(
+		mp, m_pcr, pdrgprngNew, m_fIncludesNull && pci->FIncludesNull());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PciUnionPoints
+//
+//	@doc:
+//		Union of this point set with another point set; a merge of the two
+//		sorted sets of points that shares their ranges
+//
+//---------------------------------------------------------------------------
+CConstraintInterval *
+CConstraintInterval::PciUnionPoints(CMemoryPool *mp, CConstraintInterval *pci)
+{
+	GPOS_ASSERT(m_fPointSet && pci->FPointSet());
+	GPOS_ASSERT(m_pcr == pci->Pcr());
+
+	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
+	CRangeArray *pdrgprngOther = pci->Pdrgprng();
+
+	const ULONG ulNumRangesFst = m_pdrgprng->Size();
+	const ULONG ulNumRangesSnd = pdrgprngOther->Size();
+	CRangeArray *pdrgprngNew =
+		GPOS_NEW(mp) CRangeArray(mp, ulNumRangesFst + ulNumRangesSnd);
+
+	ULONG ulFst = 0;
+	ULONG ulSnd = 0;
+	while (ulFst < ulNumRangesFst || ulSnd < ulNumRangesSnd)
+	{
+		CRange *prangeNew = nullptr;
+		if (ulSnd == ulNumRangesSnd)
+		{
+			prangeNew = (*m_pdrgprng)[ulFst++];
+		}
+		else if (ulFst == ulNumRangesFst)
+		{
+			prangeNew = (*pdrgprngOther)[ulSnd++];
+		}
+		else
+		{
+			IDatum *pdatumFst = (*m_pdrgprng)[ulFst]->PdatumLeft();
+			IDatum *pdatumSnd = (*pdrgprngOther)[ulSnd]->PdatumLeft();
+			if (pcomp->Equals(pdatumFst, pdatumSnd))
+			{
+				prangeNew = (*m_pdrgprng)[ulFst++];
+				ulSnd++;
+			}
+			else if (pcomp->IsLessThan(pdatumFst, pdatumSnd))
+			{
+				prangeNew = (*m_pdrgprng)[ulFst++];
+			}
+			else
+			{
+				prangeNew = (*pdrgprngOther)[ulSnd++];
+			}
+		}
+
+		prangeNew->AddRef();
+		pdrgprngNew->Append(prangeNew);
+	}
+
+	return GPOS_NEW(mp) CConstraintInterval(
+		mp, m_pcr, pdrgprngNew, m_fIncludesNull || pci->FIncludesNull());
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintInterval::PciUnion
@@ -1305,6 +1582,11 @@ CConstraintInterval::PciUnion(CMemoryPool *mp, CConstraintInterval *pci)
 	GPOS_ASSERT(nullptr != pci);
 	GPOS_ASSERT(m_pcr == pci->Pcr());
 
+	if (m_fPointSet && pci->FPointSet())
+	{
+		return PciUnionPoints(mp, pci);
+	}
+
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
@@ -1429,6 +1711,11 @@ CConstraintInterval::FContainsInterval(CMemoryPool *mp,
 		return false;
 	}
 
+	if (pci->FPointSet())
+	{
+		return FContainsPoints(pci);
+	}
+
 	CConstraintInterval *pciDiff = pci->PciDifference(mp, this);
 
 	// if the difference is empty, then this interval contains the given one
@@ -1438,6 +1725,38 @@ CConstraintInterval::FContainsInterval(CMemoryPool *mp,
 	return fContains;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::FContainsPoints
+//
+//	@doc:
+//		Does the current interval contain all points of the given point set?
+//		Each point is looked up among the ranges of this interval, starting
+//		from where the previous one was found
+//
+//---------------------------------------------------------------------------
+BOOL
+CConstraintInterval::FContainsPoints(CConstraintInterval *pci)
+{
+	GPOS_ASSERT(pci->FPointSet());
+
+	CRangeArray *pdrgprngPoints = pci->Pdrgprng();
+	const ULONG ulPoints = pdrgprngPoints->Size();
+	const ULONG ulRanges = m_pdrgprng->Size();
+	ULONG ulPos = 0;
+	for (ULONG ul = 0; ul < ulPoints; ul++)
+	{
+		CRange *prangePoint = (*pdrgprngPoints)[ul];
+		ulPos = UlFirstRangeNotLeftOf(m_pdrgprng, ulPos, prangePoint);
+		if (ulPos == ulRanges || !(*m_pdrgprng)[ulPos]->Contains(prangePoint))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintInterval::PciUnbounded
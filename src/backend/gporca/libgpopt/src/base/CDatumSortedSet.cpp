@@ -20,7 +20,8 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 	const ULONG ulArrayExprArity = CUtils::UlScalarArrayArity(pexprArray);
 	GPOS_ASSERT(0 < ulArrayExprArity);
 
-	gpos::CAutoRef<IDatumArray> aprngdatum(GPOS_NEW(mp) IDatumArray(mp));
+	gpos::CAutoRef<IDatumArray> aprngdatum(
+		GPOS_NEW(mp) IDatumArray(mp, ulArrayExprArity));
 	for (ULONG ul = 0; ul < ulArrayExprArity; ul++)
 	{
 		CScalarConst *popScConst =
@@ -42,10 +43,25 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 	{
 		return;
 	}
+
+	// generated IN lists are often sorted already, which takes one
+	// comparison per element to find out, and makes sorting and
+	// de-duplicating unnecessary
+	const ULONG ulRangeArrayArity = aprngdatum->Size();
+	if (pcomp->IsSorted(aprngdatum.Value()))
+	{
+		for (ULONG ul = 0; ul < ulRangeArrayArity; ul++)
+		{
+			IDatum *datum = (*aprngdatum)[ul];
+			datum->AddRef();
+			Append(datum);
+		}
+		return;
+	}
+
 	aprngdatum->Sort(&CUtils::IDatumCmp);
 
 	// de-duplicate
-	const ULONG ulRangeArrayArity = aprngdatum->Size();
 	IDatum *pdatumPrev = (*aprngdatum)[0];
 	pdatumPrev->AddRef();
 	Append(pdatumPrev);
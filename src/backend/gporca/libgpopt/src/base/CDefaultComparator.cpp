@@ -17,6 +17,7 @@
 
 #include "gpopt/base/CDefaultComparator.h"
 
+#include "gpos/common/CAutoRef.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 
 #include "gpopt/base/COptCtxt.h"
@@ -50,37 +51,69 @@ CDefaultComparator::CDefaultComparator(IConstExprEvaluator *pceeval)
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CDefaultComparator::PexprEvalComparison
+//		CDefaultComparator::PexprComparison
 //
 //	@doc:
 //		Constructs a comparison expression of type cmp_type between the two given
-//		data and evaluates it.
+//		data.
 //
 //---------------------------------------------------------------------------
-BOOL
-CDefaultComparator::FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
+CExpression *
+CDefaultComparator::PexprComparison(CMemoryPool *mp, const IDatum *datum1,
 									const IDatum *datum2,
-									IMDType::ECmpType cmp_type) const
+									IMDType::ECmpType cmp_type)
 {
-	GPOS_ASSERT(m_pceeval->FCanEvalExpressions());
-
 	IDatum *pdatum1Copy = datum1->MakeCopy(mp);
 	CExpression *pexpr1 = GPOS_NEW(mp)
 		CExpression(mp, GPOS_NEW(mp) CScalarConst(mp, pdatum1Copy));
 	IDatum *pdatum2Copy = datum2->MakeCopy(mp);
 	CExpression *pexpr2 = GPOS_NEW(mp)
 		CExpression(mp, GPOS_NEW(mp) CScalarConst(mp, pdatum2Copy));
-	CExpression *pexprComp =
-		CUtils::PexprScalarCmp(mp, pexpr1, pexpr2, cmp_type);
 
-	CExpression *pexprResult = m_pceeval->PexprEval(pexprComp);
-	pexprComp->Release();
+	return CUtils::PexprScalarCmp(mp, pexpr1, pexpr2, cmp_type);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FComparisonResult
+//
+//	@doc:
+//		Extracts the boolean value of an evaluated comparison.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FComparisonResult(CExpression *pexprResult)
+{
 	CScalarConst *popScalarConst = CScalarConst::PopConvert(pexprResult->Pop());
 	IDatum *datum = popScalarConst->GetDatum();
 
 	GPOS_ASSERT(IMDType::EtiBool == datum->GetDatumType());
 	IDatumBool *pdatumBool = dynamic_cast<IDatumBool *>(datum);
-	BOOL result = pdatumBool->GetValue();
+
+	return pdatumBool->GetValue();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FEvalComparison
+//
+//	@doc:
+//		Constructs a comparison expression of type cmp_type between the two given
+//		data and evaluates it.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
+									const IDatum *datum2,
+									IMDType::ECmpType cmp_type) const
+{
+	GPOS_ASSERT(m_pceeval->FCanEvalExpressions());
+
+	CExpression *pexprComp = PexprComparison(mp, datum1, datum2, cmp_type);
+	CExpression *pexprResult = m_pceeval->PexprEval(pexprComp);
+	pexprComp->Release();
+
+	BOOL result = FComparisonResult(pexprResult);
 	pexprResult->Release();
 
 	return result;
@@ -337,4 +370,73 @@ CDefaultComparator::IsGreaterThanOrEqual(const IDatum *datum1,
 	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptGEq);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::IsSorted
+//
+//	@doc:
+//		Tests if every element of the array is less than the next one. Pairs
+//		that the internal evaluator handles are compared right away, the
+//		others are collected and sent to the external evaluator in one batch.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::IsSorted(const IDatumArray *pdrgpdatum) const
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRef<CExpressionArray> a_pdrgpexprComp(GPOS_NEW(mp)
+												   CExpressionArray(mp));
+	for (ULONG ul = 1; ul < pdrgpdatum->Size(); ul++)
+	{
+		const IDatum *datum1 = (*pdrgpdatum)[ul - 1];
+		const IDatum *datum2 = (*pdrgpdatum)[ul];
+
+		BOOL can_use_external_evaluator = false;
+		if (FUseInternalEvaluator(datum1, datum2, &can_use_external_evaluator))
+		{
+			if (!datum1->StatsAreLessThan(datum2))
+			{
+				return false;
+			}
+		}
+		else if (!can_use_external_evaluator)
+		{
+			return false;
+		}
+		else if (datum1->IsNull() || datum2->IsNull())
+		{
+			// NULLs are handled without evaluation
+			if (!IsLessThan(datum1, datum2))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			a_pdrgpexprComp->Append(
+				PexprComparison(mp, datum1, datum2, IMDType::EcmptL));
+		}
+	}
+
+	if (0 == a_pdrgpexprComp->Size())
+	{
+		return true;
+	}
+
+	GPOS_ASSERT(m_pceeval->FCanEvalExpressions());
+	CAutoRef<CExpressionArray> a_pdrgpexprResult(
+		m_pceeval->PdrgpexprEval(mp, a_pdrgpexprComp.Value()));
+	for (ULONG ul = 0; ul < a_pdrgpexprResult->Size(); ul++)
+	{
+		if (!FComparisonResult((*a_pdrgpexprResult)[ul]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 // EOF
@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CJoinStatsCache.cpp
+//
+//	@doc:
+//		Implementation of the join statistics cache
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CJoinStatsCache.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::SKey::HashValue
+//
+//	@doc:
+//		Hash function
+//
+//---------------------------------------------------------------------------
+ULONG
+CJoinStatsCache::SKey::HashValue(const SKey *key)
+{
+	ULONG ulHash = gpos::CombineHashes(key->m_groups->HashValue(),
+									   key->m_preds->HashValue());
+
+	return gpos::CombineHashes(ulHash,
+							   gpos::HashValue<BOOL>(&key->m_fBucketScaleFactor));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::SKey::Equals
+//
+//	@doc:
+//		Equality function
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinStatsCache::SKey::Equals(const SKey *keyFst, const SKey *keySnd)
+{
+	return keyFst->m_fBucketScaleFactor == keySnd->m_fBucketScaleFactor &&
+		   keyFst->m_groups->Equals(keySnd->m_groups) &&
+		   keyFst->m_preds->Equals(keySnd->m_preds);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::CJoinStatsCache
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache::CJoinStatsCache(CMemoryPool *mp)
+	: m_mp(mp), m_phmkeystats(GPOS_NEW(mp) KeyToStatsMap(mp))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::~CJoinStatsCache
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CJoinStatsCache::~CJoinStatsCache()
+{
+	m_phmkeystats->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::Pstats
+//
+//	@doc:
+//		Stats of the given join, or nullptr if not cached
+//
+//---------------------------------------------------------------------------
+IStatistics *
+CJoinStatsCache::Pstats(CBitSet *groups, CBitSet *preds,
+						BOOL fBucketScaleFactor) const
+{
+	// the lookup key releases its bitsets when it goes out of scope
+	groups->AddRef();
+	preds->AddRef();
+	SKey key(groups, preds, fBucketScaleFactor);
+
+	return m_phmkeystats->Find(&key);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinStatsCache::Insert
+//
+//	@doc:
+//		Cache the stats of the given join
+//
+//---------------------------------------------------------------------------
+void
+CJoinStatsCache::Insert(CBitSet *groups, CBitSet *preds,
+						BOOL fBucketScaleFactor, IStatistics *stats)
+{
+	GPOS_ASSERT(nullptr != stats);
+
+	SKey *key = GPOS_NEW(m_mp) SKey(groups, preds, fBucketScaleFactor);
+	if (!m_phmkeystats->Insert(key, stats))
+	{
+		// another enumerator cached the same join already
+		GPOS_DELETE(key);
+		stats->Release();
+	}
+}
+
+// EOF
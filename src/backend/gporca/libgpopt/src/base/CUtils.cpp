@@ -46,6 +46,7 @@
 #include "gpopt/operators/CPhysicalAgg.h"
 #include "gpopt/operators/CPhysicalCTEConsumer.h"
 #include "gpopt/operators/CPhysicalCTEProducer.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpopt/operators/CPhysicalMotionRandom.h"
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPredicateUtils.h"
@@ -1123,6 +1124,21 @@ CUtils::FHashJoin(COperator *pop)
 	return (nullptr != popHJN);
 }
 
+// check if a given operator is a merge join
+BOOL
+CUtils::FMergeJoin(COperator *pop)
+{
+	GPOS_ASSERT(nullptr != pop);
+
+	CPhysicalMergeJoin *popMJ = nullptr;
+	if (pop->FPhysical())
+	{
+		popMJ = dynamic_cast<CPhysicalMergeJoin *>(pop);
+	}
+
+	return (nullptr != popMJ);
+}
+
 // check if a given operator is a correlated nested loops join
 BOOL
 CUtils::FCorrelatedNLJoin(COperator *pop)
@@ -1159,7 +1175,7 @@ CUtils::FPhysicalJoin(COperator *pop)
 {
 	GPOS_ASSERT(nullptr != pop);
 
-	return FHashJoin(pop) || FNLJoin(pop);
+	return FHashJoin(pop) || FNLJoin(pop) || FMergeJoin(pop);
 }
 
 // check if a given operator is a physical left outer join
@@ -1171,6 +1187,7 @@ CUtils::FPhysicalLeftOuterJoin(COperator *pop)
 	return COperator::EopPhysicalLeftOuterNLJoin == pop->Eopid() ||
 		   COperator::EopPhysicalLeftOuterIndexNLJoin == pop->Eopid() ||
 		   COperator::EopPhysicalLeftOuterHashJoin == pop->Eopid() ||
+		   COperator::EopPhysicalLeftOuterMergeJoin == pop->Eopid() ||
 		   COperator::EopPhysicalCorrelatedLeftOuterNLJoin == pop->Eopid();
 }
 
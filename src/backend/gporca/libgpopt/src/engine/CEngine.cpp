@@ -12,6 +12,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/common/syslibwrapper.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
@@ -29,6 +30,7 @@
 #include "gpopt/base/CReqdPropPlan.h"
 #include "gpopt/base/CReqdPropRelational.h"
 #include "gpopt/engine/CEnumeratorConfig.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/exception.h"
 #include "gpopt/minidump/CSerializableStackTrace.h"
@@ -81,13 +83,16 @@ CEngine::CEngine(CMemoryPool *mp)
 	  m_pqc(nullptr),
 	  m_search_stage_array(nullptr),
 	  m_ulCurrSearchStage(0),
+	  m_ulDeadline(0),
+	  m_fPlanFound(false),
 	  m_pmemo(nullptr),
 	  m_pexprEnforcerPattern(nullptr),
 	  m_xforms(nullptr),
 	  m_pdrgpulpXformCalls(nullptr),
 	  m_pdrgpulpXformTimes(nullptr),
 	  m_pdrgpulpXformBindings(nullptr),
-	  m_pdrgpulpXformResults(nullptr)
+	  m_pdrgpulpXformResults(nullptr),
+	  m_profile(nullptr)
 {
 	m_pmemo = GPOS_NEW(mp) CMemo(mp);
 	m_pexprEnforcerPattern =
@@ -121,6 +126,7 @@ CEngine::~CEngine()
 	m_pdrgpulpXformResults->Release();
 	m_pexprEnforcerPattern->Release();
 	CRefCount::SafeRelease(m_search_stage_array);
+	CRefCount::SafeRelease(m_profile);
 }
 
 
@@ -162,8 +168,17 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 					0 == pqc->Prpp()->PcrsRequired()->Size() &&
 						"requiring columns from a zero column expression");
 
+	m_ulDeadline = COptCtxt::PoctxtFromTLS()
+					   ->GetOptimizerConfig()
+					   ->GetHint()
+					   ->UlPlanningDeadline();
+
 	m_search_stage_array = search_stage_array;
-	if (nullptr == search_stage_array)
+	if (nullptr == search_stage_array && 0 != m_ulDeadline)
+	{
+		m_search_stage_array = CSearchStage::PdrgpssAnytime(m_mp);
+	}
+	else if (nullptr == search_stage_array)
 	{
 		m_search_stage_array = CSearchStage::PdrgpssDefault(m_mp);
 	}
@@ -197,6 +212,15 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 		}
 	}
 
+	if (GPOS_FTRACE(EopttraceProfileOptimization))
+	{
+		// the optimizer config outlives the engine, so that the caller
+		// can retrieve the profile after optimization
+		m_profile = GPOS_NEW(m_mp) COptimizationProfile(m_mp);
+		m_profile->AddRef();
+		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->SetProfile(m_profile);
+	}
+
 	m_pqc = pqc;
 	InitLogicalExpression(m_pqc->Pexpr());
 
@@ -733,7 +757,7 @@ CEngine::ApplyTransformations(CMemoryPool *pmpLocal, CXformSet *xform_set,
 						  ulElapsedTime, ulNumberOfBindings);
 		pxfres->Release();
 
-		if (PssCurrent()->FTimedOut())
+		if (FTimedOut())
 		{
 			break;
 		}
@@ -757,7 +781,7 @@ CEngine::TransitionGroupExpression(CMemoryPool *pmpLocal,
 	GPOS_ASSERT(CGroupExpression::estExplored == estTarget ||
 				CGroupExpression::estImplemented == estTarget);
 
-	if (PssCurrent()->FTimedOut())
+	if (FTimedOut())
 	{
 		return;
 	}
@@ -817,7 +841,7 @@ CEngine::TransitionGroup(CMemoryPool *pmpLocal, CGroup *pgroup,
 	// check stack size
 	GPOS_CHECK_STACK_SIZE;
 
-	if (PssCurrent()->FTimedOut())
+	if (FTimedOut())
 	{
 		return;
 	}
@@ -865,7 +889,7 @@ CEngine::TransitionGroup(CMemoryPool *pmpLocal, CGroup *pgroup,
 										  estGExprTargetState);
 			}
 
-			if (PssCurrent()->FTimedOut())
+			if (FTimedOut())
 			{
 				break;
 			}
@@ -981,7 +1005,7 @@ CEngine::PccOptimizeChild(
 	CGroupExpression *pgexprChildBest =
 		PgexprOptimize(pgroupChild, pocChild, pgexpr);
 	pocChild->Release();
-	if (nullptr == pgexprChildBest || PssCurrent()->FTimedOut())
+	if (nullptr == pgexprChildBest || FTimedOut())
 	{
 		// failed to generate a plan for the child, or search stage is timed-out
 		return nullptr;
@@ -1207,7 +1231,7 @@ CEngine::PgexprOptimize(CGroup *pgroup, COptimizationContext *poc,
 				OptimizeGroupExpression(pgexprCurrent, poc);
 			}
 
-			if (PssCurrent()->FTimedOut())
+			if (FTimedOut())
 			{
 				break;
 			}
@@ -1248,7 +1272,7 @@ CEngine::Explore()
 	GPOS_ASSERT(!PgroupRoot()->FExplored());
 
 	TransitionGroup(m_mp, PgroupRoot(), CGroup::estExplored /*estTarget*/);
-	GPOS_ASSERT_IMP(!PssCurrent()->FTimedOut(), PgroupRoot()->FExplored());
+	GPOS_ASSERT_IMP(!FTimedOut(), PgroupRoot()->FExplored());
 }
 
 
@@ -1270,7 +1294,7 @@ CEngine::Implement()
 	GPOS_ASSERT(!PgroupRoot()->FImplemented());
 
 	TransitionGroup(m_mp, PgroupRoot(), CGroup::estImplemented /*estTarget*/);
-	GPOS_ASSERT_IMP(!PssCurrent()->FTimedOut(), PgroupRoot()->FImplemented());
+	GPOS_ASSERT_IMP(!FTimedOut(), PgroupRoot()->FImplemented());
 }
 
 
@@ -1288,6 +1312,8 @@ CEngine::RecursiveOptimize()
 	CAutoTimer at("\n[OPT]: Total Optimization Time",
 				  GPOS_FTRACE(EopttracePrintOptimizationStatistics));
 
+	m_clockDeadline.Restart();
+
 	const ULONG ulSearchStages = m_search_stage_array->Size();
 	for (ULONG ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++)
 	{
@@ -1322,6 +1348,7 @@ CEngine::RecursiveOptimize()
 			m_mp, m_pmemo->PgroupRoot(), m_pqc->Prpp(),
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
+		m_fPlanFound = m_fPlanFound || nullptr != pexprPlan;
 
 		FinalizeSearchStage();
 	}
@@ -1641,6 +1668,15 @@ CEngine::ProcessTraceFlags()
 				<< ", " << m_pmemo->UlGrpExprs() << " group expressions"
 				<< ", " << m_xforms->Size() << " activated xforms]";
 
+		ULONG ulHashCollisions = 0;
+		ULONG ulFingerprintCollisions = 0;
+		m_pmemo->CountFingerprintCollisions(&ulHashCollisions,
+											&ulFingerprintCollisions);
+		at.Os() << std::endl
+				<< "[OPT]: Memo hash table (stage " << m_ulCurrSearchStage
+				<< "): [" << ulHashCollisions << " hash collisions, "
+				<< ulFingerprintCollisions << " fingerprint collisions]";
+
 		at.Os() << std::endl
 				<< "[OPT]: stage " << m_ulCurrSearchStage << " completed in "
 				<< PssCurrent()->UlElapsedTime() << "ms, ";
@@ -1683,16 +1719,24 @@ CEngine::Optimize()
 		std::min((ULONG) GPOPT_JOBS_CAP,
 				 (ULONG)(m_pmemo->UlpGroups() * GPOPT_JOBS_PER_GROUP));
 	CJobFactory jf(m_mp, ulJobs);
-	CScheduler sched(m_mp, ulJobs);
+	CScheduler sched;
 
 	CSchedulerContext sc;
 	sc.Init(m_mp, &jf, &sched, this);
 
+	m_clockDeadline.Restart();
+
 	const ULONG ulSearchStages = m_search_stage_array->Size();
 	for (ULONG ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++)
 	{
 		PssCurrent()->RestartTimer();
 
+		CWallClock clock;
+		const ULLONG ullMem =
+			(nullptr != m_profile) ? m_mp->TotalAllocatedSize() : 0;
+		const ULONG_PTR ulpGroups = m_pmemo->UlpGroups();
+		const ULONG_PTR ulpGrpExprs = m_pmemo->UlpGrpExprsInserted();
+
 		// optimize root group
 		m_pqc->Prpp()->AddRef();
 		COptimizationContext *poc = GPOS_NEW(m_mp) COptimizationContext(
@@ -1716,10 +1760,24 @@ CEngine::Optimize()
 			m_mp, m_pmemo->PgroupRoot(), m_pqc->Prpp(),
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
+		m_fPlanFound = m_fPlanFound || nullptr != pexprPlan;
+
+		if (nullptr != m_profile)
+		{
+			m_profile->RecordStage(
+				clock.ElapsedUS(), (LINT)(m_mp->TotalAllocatedSize() - ullMem),
+				(ULONG)(m_pmemo->UlpGroups() - ulpGroups),
+				(ULONG)(m_pmemo->UlpGrpExprsInserted() - ulpGrpExprs));
+		}
 
 		FinalizeSearchStage();
 	}
 
+	if (nullptr != m_profile)
+	{
+		m_profile->RecordMemo((ULONG) m_pmemo->UlpGroups(),
+							  m_pmemo->UlGrpExprs());
+	}
 
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
@@ -1727,6 +1785,18 @@ CEngine::Optimize()
 		atSearch.Os() << "[OPT]: Search terminated at stage "
 					  << m_ulCurrSearchStage << "/"
 					  << m_search_stage_array->Size();
+
+		if (FDeadlineExpired())
+		{
+			atSearch.Os() << ", planning deadline of " << m_ulDeadline
+						  << "ms expired";
+		}
+
+		if (nullptr != m_profile)
+		{
+			atSearch.Os() << std::endl;
+			m_profile->OsPrint(atSearch.Os());
+		}
 	}
 
 
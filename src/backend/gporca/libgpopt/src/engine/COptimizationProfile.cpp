@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COptimizationProfile.cpp
+//
+//	@doc:
+//		Implementation of the optimization profile
+//---------------------------------------------------------------------------
+
+#include "gpopt/engine/COptimizationProfile.h"
+
+#include "gpopt/xforms/CXformFactory.h"
+
+using namespace gpopt;
+
+// names of job types, indexed by CJob::EJobType
+static const CHAR *rgszJobType[] = {
+	"Test",
+	"Group Optimization",
+	"Group Implementation",
+	"Group Exploration",
+	"Group Expression Optimization",
+	"Group Expression Implementation",
+	"Group Expression Exploration",
+	"Transformation",
+};
+
+GPOS_CPL_ASSERT(CJob::EjtSentinel == GPOS_ARRAY_SIZE(rgszJobType),
+				"job type name array does not match job types");
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::COptimizationProfile
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+COptimizationProfile::COptimizationProfile(CMemoryPool *mp)
+	: m_mp(mp), m_pdrgpstage(GPOS_NEW(mp) SCountersArray(mp))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::~COptimizationProfile
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+COptimizationProfile::~COptimizationProfile()
+{
+	m_pdrgpstage->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordXform
+//
+//	@doc:
+//		Record an xform application
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordXform(CXform::EXformId exfid, ULLONG ullTimeUS,
+								  LINT lMemBytes, ULONG ulGroups,
+								  ULONG ulGroupExprs, ULONG ulBindings,
+								  ULONG ulResults)
+{
+	GPOS_ASSERT(exfid < CXform::ExfSentinel);
+
+	SCounters &counters = m_rgxform[exfid];
+	counters.Add(ullTimeUS, lMemBytes, ulGroups, ulGroupExprs);
+	counters.m_ulBindings += ulBindings;
+	counters.m_ulResults += ulResults;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordJob
+//
+//	@doc:
+//		Record a job step; jobs suspend while their child jobs run, so each
+//		step only accounts for the job's own work
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordJob(CJob::EJobType ejt, ULLONG ullTimeUS,
+								LINT lMemBytes, BOOL fCompleted)
+{
+	GPOS_ASSERT(ejt < CJob::EjtSentinel);
+
+	SCounters &counters = m_rgjob[ejt];
+	counters.Add(ullTimeUS, lMemBytes, 0 /*ulGroups*/, 0 /*ulGroupExprs*/);
+	if (fCompleted)
+	{
+		counters.m_ulCompleted++;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::RecordStage
+//
+//	@doc:
+//		Record a completed search stage
+//
+//---------------------------------------------------------------------------
+void
+COptimizationProfile::RecordStage(ULLONG ullTimeUS, LINT lMemBytes,
+								  ULONG ulGroups, ULONG ulGroupExprs)
+{
+	SCounters *pcounters = GPOS_NEW(m_mp) SCounters();
+	pcounters->Add(ullTimeUS, lMemBytes, ulGroups, ulGroupExprs);
+	m_pdrgpstage->Append(pcounters);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::SzJobType
+//
+//	@doc:
+//		Name of the given job type
+//
+//---------------------------------------------------------------------------
+const CHAR *
+COptimizationProfile::SzJobType(ULONG ejt)
+{
+	GPOS_ASSERT(ejt < CJob::EjtSentinel);
+
+	return rgszJobType[ejt];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizationProfile::OsPrint
+//
+//	@doc:
+//		Print function
+//
+//---------------------------------------------------------------------------
+IOstream &
+COptimizationProfile::OsPrint(IOstream &os) const
+{
+	os << "[OPT-PROFILE]: memo: " << m_ulMemoGroups << " groups, "
+	   << m_ulMemoGroupExprs << " group expressions" << std::endl;
+
+	for (ULONG ul = 0; ul < UlStages(); ul++)
+	{
+		const SCounters &counters = Stage(ul);
+		os << "[OPT-PROFILE]: stage " << ul << ": " << counters.m_ullTimeUS
+		   << "us, " << counters.m_lMemBytes << " bytes, "
+		   << counters.m_ulGroups << " groups, " << counters.m_ulGroupExprs
+		   << " group expressions" << std::endl;
+	}
+
+	for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+	{
+		const SCounters &counters = Job(ul);
+		if (0 == counters.m_ulCalls)
+		{
+			continue;
+		}
+		os << "[OPT-PROFILE]: job " << SzJobType(ul) << ": "
+		   << counters.m_ulCompleted << " jobs, " << counters.m_ulCalls
+		   << " steps, " << counters.m_ullTimeUS
+		   << "us, " << counters.m_lMemBytes << " bytes" << std::endl;
+	}
+
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		const SCounters &counters = Xform(ul);
+		if (0 == counters.m_ulCalls)
+		{
+			continue;
+		}
+		os << "[OPT-PROFILE]: xform "
+		   << CXformFactory::Pxff()->Pxf((CXform::EXformId) ul)->SzId()
+		   << ": " << counters.m_ulCalls << " calls, "
+		   << counters.m_ulBindings << " bindings, " << counters.m_ulResults
+		   << " results, " << counters.m_ullTimeUS << "us, "
+		   << counters.m_lMemBytes << " bytes, " << counters.m_ulGroups
+		   << " groups, " << counters.m_ulGroupExprs << " group expressions"
+		   << std::endl;
+	}
+
+	return os;
+}
+
+// EOF
@@ -17,6 +17,9 @@
 
 #include "gpopt/eval/CConstExprEvaluatorDXL.h"
 
+#include "gpos/common/CAutoRef.h"
+#include "gpos/common/CAutoRg.h"
+
 #include "gpopt/base/CDrvdPropScalar.h"
 #include "gpopt/eval/IConstDXLNodeEvaluator.h"
 #include "gpopt/exception.h"
@@ -41,10 +44,12 @@ using namespace gpos;
 CConstExprEvaluatorDXL::CConstExprEvaluatorDXL(
 	CMemoryPool *mp, CMDAccessor *md_accessor,
 	IConstDXLNodeEvaluator *pconstdxleval)
-	: m_pconstdxleval(pconstdxleval),
+	: m_mp(mp),
+	  m_pconstdxleval(pconstdxleval),
 	  m_trexpr2dxl(mp, md_accessor, nullptr /*pdrgpiSegments*/,
 				   false /*fInitColumnFactory*/),
-	  m_trdxl2expr(mp, md_accessor, false /*fInitColumnFactory*/)
+	  m_trdxl2expr(mp, md_accessor, false /*fInitColumnFactory*/),
+	  m_phmexprResult(GPOS_NEW(mp) ExprToResultMap(mp))
 {
 }
 
@@ -56,19 +61,21 @@ CConstExprEvaluatorDXL::CConstExprEvaluatorDXL(
 //		Dtor
 //
 //---------------------------------------------------------------------------
-CConstExprEvaluatorDXL::~CConstExprEvaluatorDXL() = default;
+CConstExprEvaluatorDXL::~CConstExprEvaluatorDXL()
+{
+	m_phmexprResult->Release();
+}
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CConstExprEvaluatorDXL::PexprEval
+//		CConstExprEvaluatorDXL::CheckSupported
 //
 //	@doc:
-//		Evaluate the given expression and return the result as a new expression.
-//		Caller takes ownership of returned expression
+//		Raise an exception if the given expression cannot be evaluated
 //
 //---------------------------------------------------------------------------
-CExpression *
-CConstExprEvaluatorDXL::PexprEval(CExpression *pexpr)
+void
+CConstExprEvaluatorDXL::CheckSupported(CExpression *pexpr)
 {
 	GPOS_ASSERT(nullptr != pexpr);
 
@@ -76,20 +83,154 @@ CConstExprEvaluatorDXL::PexprEval(CExpression *pexpr)
 	{
 		GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiEvalUnsupportedScalarExpr);
 	}
-	CDXLNode *pdxlnExpr = m_trexpr2dxl.PdxlnScalar(pexpr);
-	CDXLNode *pdxlnResult = m_pconstdxleval->EvaluateExpr(pdxlnExpr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::PexprLookup
+//
+//	@doc:
+//		Result of the given expression if it has been evaluated before,
+//		nullptr otherwise. Caller takes ownership of returned expression
+//
+//---------------------------------------------------------------------------
+CExpression *
+CConstExprEvaluatorDXL::PexprLookup(CExpression *pexpr) const
+{
+	CExpression *pexprResult = m_phmexprResult->Find(pexpr);
+	if (nullptr != pexprResult)
+	{
+		pexprResult->AddRef();
+	}
+
+	return pexprResult;
+}
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::PexprMemoize
+//
+//	@doc:
+//		Translate the result of the given evaluated expression and memoize
+//		it. The expression is keyed by its translation from DXL, so that the
+//		key lives in the memory pool of the evaluator rather than in the
+//		one of the caller. Caller takes ownership of returned expression
+//
+//---------------------------------------------------------------------------
+CExpression *
+CConstExprEvaluatorDXL::PexprMemoize(const CDXLNode *pdxlnExpr,
+									 const CDXLNode *pdxlnResult)
+{
 	GPOS_ASSERT(EdxloptypeScalar ==
 				pdxlnResult->GetOperator()->GetDXLOperatorType());
 
 	CExpression *pexprResult = m_trdxl2expr.PexprTranslateScalar(
 		pdxlnResult, nullptr /*colref_array*/);
+	CExpression *pexprKey =
+		m_trdxl2expr.PexprTranslateScalar(pdxlnExpr, nullptr /*colref_array*/);
+
+	pexprResult->AddRef();
+	if (!m_phmexprResult->Insert(pexprKey, pexprResult))
+	{
+		// the same expression was evaluated twice in one batch
+		pexprKey->Release();
+		pexprResult->Release();
+	}
+
+	return pexprResult;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::PexprEval
+//
+//	@doc:
+//		Evaluate the given expression and return the result as a new expression.
+//		Caller takes ownership of returned expression
+//
+//---------------------------------------------------------------------------
+CExpression *
+CConstExprEvaluatorDXL::PexprEval(CExpression *pexpr)
+{
+	CheckSupported(pexpr);
+
+	CExpression *pexprResult = PexprLookup(pexpr);
+	if (nullptr != pexprResult)
+	{
+		return pexprResult;
+	}
+
+	CDXLNode *pdxlnExpr = m_trexpr2dxl.PdxlnScalar(pexpr);
+	CDXLNode *pdxlnResult = m_pconstdxleval->EvaluateExpr(pdxlnExpr);
+
+	pexprResult = PexprMemoize(pdxlnExpr, pdxlnResult);
 	pdxlnResult->Release();
 	pdxlnExpr->Release();
 
 	return pexprResult;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::PdrgpexprEval
+//
+//	@doc:
+//		Evaluate the given expressions and return their results in the same
+//		order. Expressions that have not been evaluated before are sent to
+//		the DXL evaluator in one batch. Caller takes ownership of returned
+//		array
+//
+//---------------------------------------------------------------------------
+CExpressionArray *
+CConstExprEvaluatorDXL::PdrgpexprEval(CMemoryPool *mp,
+									  CExpressionArray *pdrgpexpr)
+{
+	GPOS_ASSERT(nullptr != pdrgpexpr);
+
+	const ULONG size = pdrgpexpr->Size();
+
+	// memoized results, nullptr for the expressions to evaluate
+	CAutoRg<CExpression *> a_rgpexprMemo(
+		GPOS_NEW_ARRAY(m_mp, CExpression *, size));
+	CAutoRef<CDXLNodeArray> a_pdrgpdxlnExpr(GPOS_NEW(m_mp)
+												CDXLNodeArray(m_mp));
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CExpression *pexpr = (*pdrgpexpr)[ul];
+		CheckSupported(pexpr);
+
+		a_rgpexprMemo[ul] = PexprLookup(pexpr);
+		if (nullptr == a_rgpexprMemo[ul])
+		{
+			a_pdrgpdxlnExpr->Append(m_trexpr2dxl.PdxlnScalar(pexpr));
+		}
+	}
+
+	CAutoRef<CDXLNodeArray> a_pdrgpdxlnResult;
+	if (0 < a_pdrgpdxlnExpr->Size())
+	{
+		a_pdrgpdxlnResult =
+			m_pconstdxleval->EvaluateExprs(a_pdrgpdxlnExpr.Value());
+		GPOS_ASSERT(a_pdrgpdxlnExpr->Size() == a_pdrgpdxlnResult->Size());
+	}
+
+	CExpressionArray *pdrgpexprResult = GPOS_NEW(mp) CExpressionArray(mp, size);
+	ULONG ulEvaluated = 0;
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CExpression *pexprResult = a_rgpexprMemo[ul];
+		if (nullptr == pexprResult)
+		{
+			pexprResult = PexprMemoize((*a_pdrgpdxlnExpr)[ulEvaluated],
+									   (*a_pdrgpdxlnResult)[ulEvaluated]);
+			ulEvaluated++;
+		}
+		pdrgpexprResult->Append(pexprResult);
+	}
+
+	return pdrgpexprResult;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstExprEvaluatorDXL::FCanEvalExpressions
@@ -0,0 +1,41 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		IConstExprEvaluator.cpp
+//
+//	@doc:
+//		Default implementation of batched constant expression evaluation
+//---------------------------------------------------------------------------
+
+#include "gpopt/eval/IConstExprEvaluator.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		IConstExprEvaluator::PdrgpexprEval
+//
+//	@doc:
+//		Evaluate the given expressions one by one and return their results
+//		in the same order. Caller takes ownership of returned array
+//
+//---------------------------------------------------------------------------
+CExpressionArray *
+IConstExprEvaluator::PdrgpexprEval(CMemoryPool *mp,
+								   CExpressionArray *pdrgpexpr)
+{
+	GPOS_ASSERT(nullptr != pdrgpexpr);
+
+	const ULONG size = pdrgpexpr->Size();
+	CExpressionArray *pdrgpexprResult = GPOS_NEW(mp) CExpressionArray(mp, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		pdrgpexprResult->Append(PexprEval((*pdrgpexpr)[ul]));
+	}
+
+	return pdrgpexprResult;
+}
+
+// EOF
@@ -24,6 +24,12 @@ CMDAccessor::MDCache *CMDCache::m_pcache = nullptr;
 // maximum size of the cache
 ULLONG CMDCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
 
+// lookup and invalidation counters
+ULLONG CMDCache::m_ullCacheHits = 0;
+ULLONG CMDCache::m_ullCacheMisses = 0;
+ULLONG CMDCache::m_ullCacheInvalidations = 0;
+ULLONG CMDCache::m_ullCacheResets = 0;
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::Init
@@ -122,6 +128,27 @@ CMDCache::Reset()
 {
 	Shutdown();
 	Init();
+	m_ullCacheResets++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::Evict
+//
+//	@doc:
+//		Evict the entries selected by the given predicate, e.g. the entries
+//		that depend on a changed catalog object
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCache::Evict(CMDAccessor::MDCache::EvictFuncPtr pfnEvict, void *pvContext)
+{
+	GPOS_ASSERT(nullptr != m_pcache && "Metadata cache was not created");
+
+	ULONG ulEvicted = m_pcache->EvictEntries(pfnEvict, pvContext);
+	m_ullCacheInvalidations += ulEvicted;
+
+	return ulEvicted;
 }
 
 // EOF
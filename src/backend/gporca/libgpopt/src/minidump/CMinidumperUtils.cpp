@@ -21,6 +21,8 @@
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/error/CErrorContext.h"
 #include "gpos/error/CErrorHandlerStandard.h"
+#include "gpos/io/CFileWriter.h"
+#include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/task/CAutoSuspendAbort.h"
 #include "gpos/task/CAutoTraceFlag.h"
@@ -41,6 +43,7 @@
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/dxl/parser/CParseHandlerDXL.h"
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
 #include "naucrates/md/CMDProviderMemory.h"
 #include "naucrates/traceflags/traceflags.h"
 
@@ -131,6 +134,51 @@ CMinidumperUtils::PdxlmdLoad(CMemoryPool *mp, const CHAR *file_name)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumperUtils::ConvertMinidump
+//
+//	@doc:
+//		Write the given minidump in the other DXL encoding: binary DXL for
+//		an XML minidump and XML for a binary one
+//
+//---------------------------------------------------------------------------
+void
+CMinidumperUtils::ConvertMinidump(CMemoryPool *mp, const CHAR *file_name,
+								  const CHAR *szOutputFileName)
+{
+	GPOS_ASSERT(nullptr != file_name);
+	GPOS_ASSERT(nullptr != szOutputFileName);
+
+	ULONG_PTR ulpSize = 0;
+	CAutoRg<BYTE> a_pb(CDXLUtils::ReadBytes(mp, file_name, &ulpSize));
+
+	CFileWriter fw;
+	fw.Open(szOutputFileName, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+	if (CDXLBinaryFormat::FBinaryDXL(a_pb.Rgt(), ulpSize))
+	{
+		CWStringDynamic str(mp);
+		COstreamString oss(&str);
+		CDXLUtils::SerializeBinaryDXL(mp, a_pb.Rgt(), ulpSize, oss,
+									  true /*indentation*/);
+
+		CAutoRg<CHAR> a_sz(CDXLUtils::CreateMultiByteCharStringFromWCString(
+			mp, str.GetBuffer()));
+		fw.Write(reinterpret_cast<const BYTE *>(a_sz.Rgt()),
+				 clib::Strlen(a_sz.Rgt()));
+	}
+	else
+	{
+		ULONG_PTR ulpBinarySize = 0;
+		CAutoRg<BYTE> a_pbBinary(
+			CDXLUtils::EncodeBinaryDXL(mp, file_name, &ulpBinarySize));
+		fw.Write(a_pbBinary.Rgt(), ulpBinarySize);
+	}
+
+	fw.Close();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMinidumperUtils::GenerateMinidumpFileName
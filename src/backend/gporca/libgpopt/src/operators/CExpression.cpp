@@ -626,6 +626,26 @@ CExpression::PstatsDerive(CReqdPropRelational *prprel,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpression::AttachStats
+//
+//	@doc:
+//		Attach stats derived for an equivalent expression, instead of
+//		deriving them; takes ownership of the given stats
+//
+//---------------------------------------------------------------------------
+void
+CExpression::AttachStats(IStatistics *stats)
+{
+	GPOS_ASSERT(nullptr != stats);
+	GPOS_ASSERT(nullptr == m_pstats);
+	GPOS_ASSERT(!Pop()->FScalar());
+
+	m_pstats = stats;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CExpression::ResetDerivedProperty
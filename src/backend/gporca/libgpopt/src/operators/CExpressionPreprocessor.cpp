@@ -2873,8 +2873,12 @@ CExpressionPreprocessor::PrunePartitions(CMemoryPool *mp, CExpression *expr)
 				}
 				if (rel_cnstr != nullptr)
 				{
+					rel_cnstr->AddRef();
 					preds->Append(rel_cnstr);
 				}
+				// a point set of a long IN list in the predicate is
+				// intersected with the partition constraint by searching
+				// it, see CConstraintInterval::PciIntersect
 				pcnstr = CConstraint::PcnstrConjunction(mp, preds);
 			}
 
@@ -2888,14 +2892,13 @@ CExpressionPreprocessor::PrunePartitions(CMemoryPool *mp, CExpression *expr)
 				foreign_server_mdids->Append(foreign_server_mdid);
 				part_mdid->AddRef();
 				selected_partition_mdids->Append(part_mdid);
-				rel_cnstr = PcnstrFromChildPartition(
-					partrel, dyn_get->PdrgpcrOutput(),
-					(*dyn_get->GetRootColMappingPerPart())[ul]);
 				if (rel_cnstr)
 				{
+					rel_cnstr->AddRef();
 					selected_partition_cnstrs->Append(rel_cnstr);
 				}
 			}
+			CRefCount::SafeRelease(rel_cnstr);
 			CRefCount::SafeRelease(pcnstr);
 		}
 		CRefCount::SafeRelease(pred_cnstr);
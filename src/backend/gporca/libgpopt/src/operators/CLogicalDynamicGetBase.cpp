@@ -83,7 +83,8 @@ CLogicalDynamicGetBase::CLogicalDynamicGetBase(
 
 	m_pcrsDist = CLogical::PcrsDist(mp, Ptabdesc(), m_pdrgpcrOutput);
 	m_root_col_mapping_per_part =
-		ConstructRootColMappingPerPart(mp, m_pdrgpcrOutput, m_partition_mdids);
+		ConstructRootColMappingPerPart(mp, m_pdrgpcrOutput, Ptabdesc()->MDId(),
+									   m_partition_mdids);
 }
 
 
@@ -121,7 +122,8 @@ CLogicalDynamicGetBase::CLogicalDynamicGetBase(CMemoryPool *mp,
 	m_pcrsDist = CLogical::PcrsDist(mp, Ptabdesc(), m_pdrgpcrOutput);
 
 	m_root_col_mapping_per_part =
-		ConstructRootColMappingPerPart(mp, m_pdrgpcrOutput, m_partition_mdids);
+		ConstructRootColMappingPerPart(mp, m_pdrgpcrOutput, Ptabdesc()->MDId(),
+									   m_partition_mdids);
 }
 
 //---------------------------------------------------------------------------
@@ -229,14 +231,34 @@ CLogicalDynamicGetBase::DerivePartitionInfo(CMemoryPool *mp,
 // the same colref. However, if they've been dropped/swapped, the mapping will
 // be different. This method is fairly expensive, as it's building multiple hashmaps
 // and ends up getting called from a few different places in the codebase.
+// If the root records that all partitions have its columns, the partitions are
+// not retrieved and all of them share one identity mapping.
 ColRefToUlongMapArray *
 CLogicalDynamicGetBase::ConstructRootColMappingPerPart(
-	CMemoryPool *mp, CColRefArray *root_cols, IMdIdArray *partition_mdids)
+	CMemoryPool *mp, CColRefArray *root_cols, IMDId *root_mdid,
+	IMdIdArray *partition_mdids)
 {
 	CMDAccessor *mda = COptCtxt::PoctxtFromTLS()->Pmda();
 
 	ColRefToUlongMapArray *part_maps = GPOS_NEW(mp) ColRefToUlongMapArray(mp);
 
+	if (mda->RetrieveRel(root_mdid)->PartitionsMatchRootColumns())
+	{
+		ColRefToUlongMap *mapping = GPOS_NEW(mp) ColRefToUlongMap(mp);
+		for (ULONG i = 0; i < root_cols->Size(); ++i)
+		{
+			mapping->Insert((*root_cols)[i], GPOS_NEW(mp) ULONG(i));
+		}
+
+		for (ULONG ul = 0; ul < partition_mdids->Size(); ++ul)
+		{
+			mapping->AddRef();
+			part_maps->Append(mapping);
+		}
+		mapping->Release();
+		return part_maps;
+	}
+
 	// Build hashmap of colname to the index
 	ColNameToIndexMap *root_mapping = GPOS_NEW(mp) ColNameToIndexMap(mp);
 	for (ULONG i = 0; i < root_cols->Size(); ++i)
@@ -0,0 +1,48 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2024 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPhysicalInnerMergeJoin.cpp
+//
+//	@doc:
+//		Implementation of inner merge join operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalInnerMergeJoin.h"
+
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerMergeJoin::CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalInnerMergeJoin::CPhysicalInnerMergeJoin(
+	CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+	CExpressionArray *inner_merge_clauses, IMdIdArray *, BOOL,
+	CXform::EXformId origin_xform)
+	: CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses,
+						 origin_xform)
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerMergeJoin::~CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalInnerMergeJoin::~CPhysicalInnerMergeJoin() = default;
+
+
+// EOF
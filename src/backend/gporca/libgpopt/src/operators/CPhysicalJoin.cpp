@@ -709,7 +709,7 @@ CPhysicalJoin::FMergeJoinCompatible(
 		// to send such requests.
 		// So, check that hash family used for distribution matches the default for
 		// its operands' types. This must match the operator using in
-		// CPhysicalFullMergeJoin::PosRequired().
+		// CPhysicalMergeJoin::PosRequired().
 		if (!CUtils::Equals(op->HashOpfamilyMdid(),
 							left_type->GetDistrOpfamilyMdid()) ||
 			!CUtils::Equals(op->HashOpfamilyMdid(),
@@ -0,0 +1,65 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2024 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CPhysicalLeftOuterMergeJoin.cpp
+//
+//	@doc:
+//		Implementation of left outer merge join operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalLeftOuterMergeJoin.h"
+
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalLeftOuterMergeJoin::CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalLeftOuterMergeJoin::CPhysicalLeftOuterMergeJoin(
+	CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+	CExpressionArray *inner_merge_clauses, IMdIdArray *, BOOL,
+	CXform::EXformId origin_xform)
+	: CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses,
+						 origin_xform)
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalLeftOuterMergeJoin::~CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalLeftOuterMergeJoin::~CPhysicalLeftOuterMergeJoin() = default;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalLeftOuterMergeJoin::PdsDerive
+//
+//	@doc:
+//		Derive distribution; inner columns are null-extended, so only the
+//		distribution of the outer child carries over to the join
+//
+//---------------------------------------------------------------------------
+CDistributionSpec *
+CPhysicalLeftOuterMergeJoin::PdsDerive(CMemoryPool *mp,
+									   CExpressionHandle &exprhdl) const
+{
+	return CPhysicalJoin::PdsDerive(mp, exprhdl);
+}
+
+
+// EOF
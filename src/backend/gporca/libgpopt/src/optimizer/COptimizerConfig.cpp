@@ -16,6 +16,7 @@
 #include "gpos/string/CWStringDynamic.h"
 
 #include "gpopt/cost/ICostModel.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "naucrates/dxl/CCostModelConfigSerializer.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 
@@ -67,6 +68,22 @@ COptimizerConfig::~COptimizerConfig()
 	CRefCount::SafeRelease(m_plan_hint);
 	m_hint->Release();
 	m_window_oids->Release();
+	CRefCount::SafeRelease(m_profile);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizerConfig::SetProfile
+//
+//	@doc:
+//		Attach the profile of the optimization
+//
+//---------------------------------------------------------------------------
+void
+COptimizerConfig::SetProfile(COptimizationProfile *profile)
+{
+	CRefCount::SafeRelease(m_profile);
+	m_profile = profile;
 }
 
 //---------------------------------------------------------------------------
@@ -214,6 +231,9 @@ COptimizerConfig::Serialize(CMemoryPool *mp, CXMLSerializer *xml_serializer,
 	xml_serializer->AddAttribute(
 		CDXLTokens::GetDXLTokenStr(gpdxl::EdxltokenSkewFactor),
 		m_hint->UlSkewFactor());
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenPlanningDeadline),
+		m_hint->UlPlanningDeadline());
 	xml_serializer->CloseElement(
 		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
 		CDXLTokens::GetDXLTokenStr(EdxltokenHint));
@@ -572,22 +572,38 @@ CGroup::SetJoinKeys(CExpressionArray *pdrgpexprOuter,
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CGroup::HashValue
+//		CGroup::IdForHash
 //
 //	@doc:
-//		Hash function for group identification
+//		Id used to identify the group in hashes
 //
 //---------------------------------------------------------------------------
 ULONG
-CGroup::HashValue() const
+CGroup::IdForHash() const
 {
-	ULONG id = m_id;
 	if (FDuplicateGroup() && 0 == m_ulGExprs)
 	{
 		// group has been merged into another group
-		id = PgroupDuplicate()->Id();
+		return PgroupDuplicate()->Id();
 	}
 
+	return m_id;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroup::HashValue
+//
+//	@doc:
+//		Hash function for group identification
+//
+//---------------------------------------------------------------------------
+ULONG
+CGroup::HashValue() const
+{
+	ULONG id = IdForHash();
+
 	return gpos::HashValue<ULONG>(&id);
 }
 
@@ -35,6 +35,33 @@ FORCE_GENERATE_DBGSTR(CGroupExpression);
 
 #define GPOPT_COSTCTXT_HT_BUCKETS 100
 
+// seed of group expression fingerprints
+#define GPOPT_GEXPR_FINGERPRINT_SEED ULLONG(0x9E3779B97F4A7C15)
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UllMix
+//
+//	@doc:
+//		Mix a value into a 64-bit fingerprint, using the finalizer of
+//		MurmurHash3 to spread every input bit over the whole fingerprint
+//
+//---------------------------------------------------------------------------
+static ULLONG
+UllMix(ULLONG ullFingerprint, ULLONG ullValue)
+{
+	ULLONG ull = ullFingerprint ^ (ullValue + GPOPT_GEXPR_FINGERPRINT_SEED +
+								   (ullFingerprint << 6) +
+								   (ullFingerprint >> 2));
+	ull ^= ull >> 33;
+	ull *= ULLONG(0xFF51AFD7ED558CCD);
+	ull ^= ull >> 33;
+	ull *= ULLONG(0xC4CEB9FE1A85EC53);
+	ull ^= ull >> 33;
+
+	return ull;
+}
+
 // invalid group expression
 const CGroupExpression CGroupExpression::m_gexprInvalid{};
 
@@ -76,6 +103,8 @@ CGroupExpression::CGroupExpression(CMemoryPool *mp, COperator *pop,
 		GPOS_ASSERT(m_pdrgpgroupSorted->IsSorted(CGroup::Compare));
 	}
 
+	ResetFingerprint();
+
 	m_ppartialplancostmap = GPOS_NEW(mp) PartialPlanToCostMap(mp);
 
 	// initialize cost contexts hash table
@@ -933,27 +962,51 @@ CGroupExpression::Matches(const CGroupExpression *pgexpr) const
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CGroupExpression::HashValue
+//		CGroupExpression::UllFingerprint
 //
 //	@doc:
-//		static hash function for operator and group references
+//		static fingerprint function for operator and group references;
+//		64-bit mixing of the operator hash, operator id, arity and child
+//		group ids, so that operators with many children do not collide
+//		the way combined 32-bit group hashes do
 //
 //---------------------------------------------------------------------------
-ULONG
-CGroupExpression::HashValue(COperator *pop, CGroupArray *pdrgpgroup)
+ULLONG
+CGroupExpression::UllFingerprint(COperator *pop, CGroupArray *pdrgpgroup)
 {
 	GPOS_ASSERT(nullptr != pop);
 	GPOS_ASSERT(nullptr != pdrgpgroup);
 
-	ULONG ulHash = pop->HashValue();
+	const ULONG arity = pdrgpgroup->Size();
+	ULLONG ullFingerprint = UllMix(GPOPT_GEXPR_FINGERPRINT_SEED,
+								   ((ULLONG) pop->HashValue() << 32) |
+									   (ULLONG) pop->Eopid());
+	ullFingerprint = UllMix(ullFingerprint, arity);
 
-	ULONG arity = pdrgpgroup->Size();
-	for (ULONG i = 0; i < arity; i++)
+	for (ULONG ul = 0; ul < arity; ul++)
 	{
-		ulHash = CombineHashes(ulHash, (*pdrgpgroup)[i]->HashValue());
+		ullFingerprint = UllMix(ullFingerprint, (*pdrgpgroup)[ul]->IdForHash());
 	}
 
-	return ulHash;
+	return ullFingerprint;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CGroupExpression::ResetFingerprint
+//
+//	@doc:
+//		Compute fingerprint from current child groups in their given order;
+//		commuted children of order-insensitive operators keep their own memo
+//		entries, which implementation xforms rely on to produce both join
+//		sides
+//
+//---------------------------------------------------------------------------
+void
+CGroupExpression::ResetFingerprint()
+{
+	m_ullFingerprint = UllFingerprint(m_pop, m_pdrgpgroup);
 }
 
 
@@ -11,7 +11,10 @@
 
 #include "gpopt/search/CJobTransformation.h"
 
+#include "gpos/common/CWallClock.h"
+
 #include "gpopt/engine/CEngine.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/operators/CLogical.h"
 #include "gpopt/search/CGroup.h"
 #include "gpopt/search/CGroupExpression.h"
@@ -129,16 +132,35 @@ CJobTransformation::EevtTransform(CSchedulerContext *psc, CJob *pjOwner)
 	CGroupExpression *pgexpr = pjt->m_pgexpr;
 	CXform *pxform = pjt->m_xform;
 
+	CEngine *peng = psc->Peng();
+	COptimizationProfile *profile = peng->Profile();
+	CWallClock clock;
+	const ULLONG ullMem =
+		(nullptr != profile) ? pmpGlobal->TotalAllocatedSize() : 0;
+	const ULONG_PTR ulpGroups = peng->Pmemo()->UlpGroups();
+	const ULONG_PTR ulpGrpExprs = peng->Pmemo()->UlpGrpExprsInserted();
+
 	// insert transformation results to memo
 	CXformResult *pxfres = GPOS_NEW(pmpGlobal) CXformResult(pmpGlobal);
 	ULONG ulElapsedTime = 0;
 	ULONG ulNumberOfBindings = 0;
 	pgexpr->Transform(pmpGlobal, pmpLocal, pxform, pxfres, &ulElapsedTime,
 					  &ulNumberOfBindings);
-	psc->Peng()->InsertXformResult(pgexpr->Pgroup(), pxfres, pxform->Exfid(),
-								   pgexpr, ulElapsedTime, ulNumberOfBindings);
+	const ULONG ulResults = pxfres->Pdrgpexpr()->Size();
+	peng->InsertXformResult(pgexpr->Pgroup(), pxfres, pxform->Exfid(), pgexpr,
+							ulElapsedTime, ulNumberOfBindings);
 	pxfres->Release();
 
+	if (nullptr != profile)
+	{
+		profile->RecordXform(
+			pxform->Exfid(), clock.ElapsedUS(),
+			(LINT)(pmpGlobal->TotalAllocatedSize() - ullMem),
+			(ULONG)(peng->Pmemo()->UlpGroups() - ulpGroups),
+			(ULONG)(peng->Pmemo()->UlpGrpExprsInserted() - ulpGrpExprs),
+			ulNumberOfBindings, ulResults);
+	}
+
 	return eevCompleted;
 }
 
@@ -13,10 +13,13 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CAutoTimer.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CHashSet.h"
 #include "gpos/common/CSyncHashtableAccessByIter.h"
 #include "gpos/common/CSyncHashtableAccessByKey.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
+#include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/string/CWStringDynamic.h"
 
 #include "gpopt/base/CDrvdProp.h"
@@ -34,6 +37,17 @@ using namespace gpopt;
 
 #define GPOPT_MEMO_HT_BUCKETS 50000
 
+// map of fingerprints to the first group expression having them
+using FingerprintToGExprMap =
+	CHashMap<ULLONG, CGroupExpression, gpos::HashValue<ULLONG>,
+			 gpos::Equals<ULLONG>, CleanupDelete<ULLONG>,
+			 CleanupNULL<CGroupExpression>>;
+
+// set of hash values
+using HashValueSet =
+	CHashSet<ULONG, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+			 CleanupDelete<ULONG>>;
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemo::CMemo
@@ -176,6 +190,7 @@ CMemo::PgroupInsert(CGroup *pgroupTarget, CGroupExpression *pgexpr,
 	if (nullptr == pgexprFound)
 	{
 		shta.Insert(pgexpr);
+		m_ulpGrpExprsInserted++;
 
 		// group proxy scope
 		{
@@ -512,6 +527,9 @@ CMemo::FRehash()
 		CGroupExpression *pgexpr = listGExprs.RemoveHead();
 		CGroupExpression *pgexprFound = nullptr;
 
+		// child groups may have been merged since the fingerprint was taken
+		pgexpr->ResetFingerprint();
+
 		{
 			// hash table accessor scope
 			ShtAcc shta(m_sht, *pgexpr);
@@ -797,6 +815,68 @@ CMemo::UlDuplicateGroups()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemo::CountFingerprintCollisions
+//
+//	@doc:
+//		Count, among the group expressions in the memo hash table, the
+//		distinct fingerprints whose 32-bit hash value was already taken by
+//		another fingerprint, and the group expressions whose fingerprint was
+//		already taken by a group expression that does not match them;
+//
+//		this function is NOT thread safe, and must not be called while
+//		exploration/implementation/optimization is undergoing
+//
+//---------------------------------------------------------------------------
+void
+CMemo::CountFingerprintCollisions(ULONG *pulHashCollisions,
+								  ULONG *pulFingerprintCollisions)
+{
+	GPOS_ASSERT(nullptr != pulHashCollisions);
+	GPOS_ASSERT(nullptr != pulFingerprintCollisions);
+
+	*pulHashCollisions = 0;
+	*pulFingerprintCollisions = 0;
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+	FingerprintToGExprMap *phmullgexpr = GPOS_NEW(mp) FingerprintToGExprMap(mp);
+	HashValueSet *phsulHash = GPOS_NEW(mp) HashValueSet(mp);
+
+	ShtIter shtit(m_sht);
+	while (shtit.Advance())
+	{
+		ShtAccIter shtitacc(shtit);
+		CGroupExpression *pgexpr = shtitacc.Value();
+		if (nullptr == pgexpr)
+		{
+			continue;
+		}
+
+		const ULLONG ullFingerprint = pgexpr->UllFingerprint();
+		CGroupExpression *pgexprFound = phmullgexpr->Find(&ullFingerprint);
+		if (nullptr != pgexprFound)
+		{
+			if (!pgexprFound->Matches(pgexpr))
+			{
+				(*pulFingerprintCollisions)++;
+			}
+			continue;
+		}
+
+		phmullgexpr->Insert(GPOS_NEW(mp) ULLONG(ullFingerprint), pgexpr);
+		if (!phsulHash->Insert(GPOS_NEW(mp) ULONG(pgexpr->HashValue())))
+		{
+			(*pulHashCollisions)++;
+		}
+	}
+
+	phsulHash->Release();
+	phmullgexpr->Release();
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemo::UlGrpExprs
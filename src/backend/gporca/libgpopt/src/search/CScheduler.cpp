@@ -12,8 +12,11 @@
 #include "gpopt/search/CScheduler.h"
 
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 #include "gpos/error/CAutoTrace.h"
 
+#include "gpopt/engine/CEngine.h"
+#include "gpopt/engine/COptimizationProfile.h"
 #include "gpopt/search/CJobFactory.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "naucrates/traceflags/traceflags.h"
@@ -29,14 +32,12 @@ using namespace gpopt;
 //		Ctor
 //
 //---------------------------------------------------------------------------
-CScheduler::CScheduler(CMemoryPool *mp, ULONG ulJobs
+CScheduler::CScheduler(
 #ifdef GPOS_DEBUG
-					   ,
-					   BOOL fTrackingJobs
+	BOOL fTrackingJobs
 #endif	// GPOS_DEBUG
-					   )
-	: m_spjl(mp, ulJobs),
-	  m_ulpTotal(0),
+	)
+	: m_ulpTotal(0),
 	  m_ulpRunning(0),
 	  m_ulpQueued(0),
 	  m_ulpStatsQueued(0),
@@ -50,11 +51,8 @@ CScheduler::CScheduler(CMemoryPool *mp, ULONG ulJobs
 	  m_fTrackingJobs(fTrackingJobs)
 #endif	// GPOS_DEBUG
 {
-	// initialize pool of job links
-	m_spjl.Init(GPOS_OFFSET(SJobLink, m_id));
-
 	// initialize list of waiting new jobs
-	m_listjlWaiting.Init(GPOS_OFFSET(SJobLink, m_link));
+	m_listjWaiting.Init(GPOS_OFFSET(CJob, m_linkWaiting));
 
 #ifdef GPOS_DEBUG
 	// initialize list of running jobs
@@ -113,15 +111,32 @@ CScheduler::ExecuteJobs(CSchedulerContext *psc)
 	CJob *pj = nullptr;
 	ULONG count = 0;
 
+	COptimizationProfile *profile =
+		(nullptr != psc->Peng()) ? psc->Peng()->Profile() : nullptr;
+	CMemoryPool *pmpGlobal = psc->GetGlobalMemoryPool();
+
 	// keep retrieving jobs
 	while (nullptr != (pj = PjRetrieve()))
 	{
 		// prepare for job execution
 		PreExecute(pj);
 
+		// a completed job may be released by FExecute
+		const CJob::EJobType ejt = pj->Ejt();
+		CWallClock clock;
+		const ULLONG ullMem =
+			(nullptr != profile) ? pmpGlobal->TotalAllocatedSize() : 0;
+
 		// execute job
 		BOOL fCompleted = FExecute(pj, psc);
 
+		if (nullptr != profile)
+		{
+			profile->RecordJob(
+				ejt, clock.ElapsedUS(),
+				(LINT)(pmpGlobal->TotalAllocatedSize() - ullMem), fCompleted);
+		}
+
 #ifdef GPOS_DEBUG
 		// restrict parallelism to keep track of jobs
 		if (FTrackingJobs())
@@ -233,16 +248,6 @@ CScheduler::Schedule(CJob *pj)
 {
 	GPOS_ASSERT(nullptr != pj);
 
-	// get job link
-	SJobLink *pjl = m_spjl.PtRetrieve();
-
-	// throw OOM if no link can be retrieved
-	if (nullptr == pjl)
-	{
-		GPOS_OOM_CHECK(nullptr);
-	}
-	pjl->Init(pj);
-
 #ifdef GPOS_DEBUG
 	if (FTrackingJobs())
 	{
@@ -253,8 +258,8 @@ CScheduler::Schedule(CJob *pj)
 	}
 #endif	// GPOS_DEBUG
 
-	// add to waiting list
-	m_listjlWaiting.Push(pjl);
+	// add to waiting list; jobs are retrieved in LIFO order
+	m_listjWaiting.Prepend(pj);
 
 	// increment number of queued jobs
 	m_ulpQueued++;
@@ -389,12 +394,11 @@ CJob *
 CScheduler::PjRetrieve()
 {
 	// retrieve runnable job from lists of waiting jobs
-	SJobLink *pjl = m_listjlWaiting.Pop();
 	CJob *pj = nullptr;
 
-	if (nullptr != pjl)
+	if (!m_listjWaiting.IsEmpty())
 	{
-		pj = pjl->m_pj;
+		pj = m_listjWaiting.RemoveHead();
 
 		GPOS_ASSERT(nullptr != pj);
 		GPOS_ASSERT(0 == pj->UlpRefs());
@@ -405,9 +409,6 @@ CScheduler::PjRetrieve()
 		// update statistics
 		m_ulpStatsDequeued++;
 
-		// recycle job link
-		m_spjl.Recycle(pjl);
-
 #ifdef GPOS_DEBUG
 		// add job to running list
 		if (FTrackingJobs())
@@ -598,11 +599,11 @@ CScheduler::OsPrintActiveJobs(IOstream &os)
 
 	os << std::endl << "List of waiting jobs: " << std::endl;
 
-	SJobLink *pjl = m_listjlWaiting.PtFirst();
-	while (nullptr != pjl)
+	pj = m_listjWaiting.First();
+	while (nullptr != pj)
 	{
-		pjl->m_pj->OsPrint(os);
-		pjl = m_listjlWaiting.Next(pjl);
+		pj->OsPrint(os);
+		pj = m_listjWaiting.Next(pj);
 	}
 
 	os << std::endl << "List of suspended jobs: " << std::endl;
@@ -128,4 +128,37 @@ CSearchStage::PdrgpssDefault(CMemoryPool *mp)
 	return search_stage_array;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchStage::PdrgpssAnytime
+//
+//	@doc:
+//		Generate search strategy for optimization under a planning deadline;
+//		a first stage orders joins greedily only, so that a complete plan is
+//		found quickly, and a second stage with all xforms improves on it
+//		until the deadline expires
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *
+CSearchStage::PdrgpssAnytime(CMemoryPool *mp)
+{
+	CXformSet *pxfsGreedy = GPOS_NEW(mp) CXformSet(mp);
+	pxfsGreedy->Union(CXformFactory::Pxff()->PxfsExploration());
+	(void) pxfsGreedy->ExchangeClear(CXform::ExfExpandNAryJoinDP);
+	(void) pxfsGreedy->ExchangeClear(CXform::ExfExpandNAryJoinDPv2);
+	(void) pxfsGreedy->ExchangeClear(CXform::ExfExpandNAryJoinMinCard);
+	(void) pxfsGreedy->ExchangeClear(CXform::ExfJoinAssociativity);
+	(void) pxfsGreedy->ExchangeClear(CXform::ExfJoinCommutativity);
+
+	CXformSet *xform_set = GPOS_NEW(mp) CXformSet(mp);
+	xform_set->Union(CXformFactory::Pxff()->PxfsExploration());
+
+	CSearchStageArray *search_stage_array = GPOS_NEW(mp) CSearchStageArray(mp);
+	search_stage_array->Append(GPOS_NEW(mp) CSearchStage(pxfsGreedy));
+	search_stage_array->Append(GPOS_NEW(mp) CSearchStage(xform_set));
+
+	return search_stage_array;
+}
+
 // EOF
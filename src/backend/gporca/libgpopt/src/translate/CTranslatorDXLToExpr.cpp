@@ -606,15 +606,20 @@ CTranslatorDXLToExpr::PexprLogicalGet(const CDXLNode *dxlnode)
 		IMdIdArray *foreign_server_mdids = GPOS_NEW(m_mp) IMdIdArray(m_mp);
 		for (ULONG ul = 0; ul < partition_mdids->Size(); ++ul)
 		{
+			if (!pmdrel->HasForeignPartitions())
+			{
+				// no leaf partition is foreign, don't retrieve them here
+				foreign_server_mdids->Append(GPOS_NEW(m_mp) CMDIdGPDB(
+					CMDIdGPDB::m_mdid_invalid_key));
+				continue;
+			}
+
 			IMDId *part_mdid = (*partition_mdids)[ul];
 			const IMDRelation *partrel = m_pmda->RetrieveRel(part_mdid);
 
-			if (partrel->IsPartitioned())
-			{
-				// Multi-level partitioned tables are unsupported - fall back
-				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
-						   GPOS_WSZ_LIT("Multi-level partitioned tables"));
-			}
+			// partitions of multi-level partitioned tables are flattened
+			// into their leaves
+			GPOS_ASSERT(!partrel->IsPartitioned());
 
 			// store array of foreign partitions
 			IMDId *foreign_server_mdid = nullptr;
@@ -1504,26 +1509,6 @@ CTranslatorDXLToExpr::PexprLogicalUpdate(const CDXLNode *dxlnode)
 				   GPOS_WSZ_LIT("Update on replicated tables"));
 	}
 
-	const IMDRelation *pmdrel = m_pmda->RetrieveRel(ptabdesc->MDId());
-	if (pmdrel->IsPartitioned())
-	{
-		GPOS_ASSERT(EdxlopLogicalUpdate == pdxlopUpdate->GetDXLOperator());
-
-		IMdIdArray *partition_mdids = pmdrel->ChildPartitionMdids();
-		for (ULONG ul = 0; ul < partition_mdids->Size(); ++ul)
-		{
-			IMDId *part_mdid = (*partition_mdids)[ul];
-			const IMDRelation *partrel = m_pmda->RetrieveRel(part_mdid);
-
-			if (partrel->IsPartitioned())
-			{
-				// Multi-level partitioned tables are unsupported - fall back
-				GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDObjUnsupported,
-						   GPOS_WSZ_LIT("Multi-level partitioned tables"));
-			}
-		}
-	}
-
 	ULONG ctid_colid = pdxlopUpdate->GetCtIdColId();
 	ULONG segid_colid = pdxlopUpdate->GetSegmentIdColId();
 
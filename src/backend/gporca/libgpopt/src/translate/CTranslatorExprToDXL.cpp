@@ -50,6 +50,7 @@
 #include "gpopt/operators/CPhysicalInnerIndexNLJoin.h"
 #include "gpopt/operators/CPhysicalLeftOuterIndexNLJoin.h"
 #include "gpopt/operators/CPhysicalLimit.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpopt/operators/CPhysicalMotionGather.h"
 #include "gpopt/operators/CPhysicalMotionHashDistribute.h"
 #include "gpopt/operators/CPhysicalMotionRandom.h"
@@ -536,6 +537,8 @@ CTranslatorExprToDXL::CreateDXLNode(CExpression *pexpr,
 				pfDML);
 			break;
 		case COperator::EopPhysicalFullMergeJoin:
+		case COperator::EopPhysicalInnerMergeJoin:
+		case COperator::EopPhysicalLeftOuterMergeJoin:
 			dxlnode = CTranslatorExprToDXL::PdxlnMergeJoin(
 				pexpr, colref_array, pdrgpdsBaseTables, pulNonGatherMotions,
 				pfDML);
@@ -4456,6 +4459,14 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 			join_type = EdxljtFull;
 			break;
 
+		case COperator::EopPhysicalInnerMergeJoin:
+			join_type = EdxljtInner;
+			break;
+
+		case COperator::EopPhysicalLeftOuterMergeJoin:
+			join_type = EdxljtLeft;
+			break;
+
 		default:
 			GPOS_ASSERT(!"Invalid join type");
 	}
@@ -4473,13 +4484,23 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 
 	CExpressionArray *pdrgpexprPredicates =
 		CPredicateUtils::PdrgpexprConjuncts(m_mp, pexprScalar);
+	CExpressionArray *pdrgpexprRemainingPredicates =
+		GPOS_NEW(m_mp) CExpressionArray(m_mp);
 	const ULONG length = pdrgpexprPredicates->Size();
 	for (ULONG ul = 0; ul < length; ul++)
 	{
 		CExpression *pexprPred = (*pdrgpexprPredicates)[ul];
-		// At this point, they all better be merge joinable
-		GPOS_ASSERT(CPhysicalJoin::FMergeJoinCompatible(
-			pexprPred, pexprOuterChild, pexprInnerChild));
+		if (!CPhysicalJoin::FMergeJoinCompatible(pexprPred, pexprOuterChild,
+												 pexprInnerChild))
+		{
+			// only full merge joins require all predicates to be merge
+			// joinable, the others are evaluated as join filter
+			GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin != pop->Eopid());
+			pexprPred->AddRef();
+			pdrgpexprRemainingPredicates->Append(pexprPred);
+			continue;
+		}
+
 		CExpression *pexprPredOuter = (*pexprPred)[0];
 		CExpression *pexprPredInner = (*pexprPred)[1];
 
@@ -4517,6 +4538,23 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 		pexprPred->Release();
 	}
 	pdrgpexprPredicates->Release();
+	GPOS_ASSERT(
+		CPhysicalMergeJoin::PopConvert(pop)->PdrgpexprOuterKeys()->Size() ==
+		dxlnode_merge_conds->Arity());
+
+	CDXLNode *dxlnode_join_filter = GPOS_NEW(m_mp)
+		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarJoinFilter(m_mp));
+	if (0 < pdrgpexprRemainingPredicates->Size())
+	{
+		CExpression *pexprJoinCond = CPredicateUtils::PexprConjunction(
+			m_mp, pdrgpexprRemainingPredicates);
+		dxlnode_join_filter->AddChild(PdxlnScalar(pexprJoinCond));
+		pexprJoinCond->Release();
+	}
+	else
+	{
+		pdrgpexprRemainingPredicates->Release();
+	}
 
 	// construct a join node
 	CDXLPhysicalMergeJoin *pdxlopMJ = GPOS_NEW(m_mp)
@@ -4533,10 +4571,8 @@ CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ,
 	CDXLPhysicalProperties *dxl_properties = GetProperties(pexprMJ);
 	pdxlnMJ->SetProperties(dxl_properties);
 
-	// construct an empty plan filter and join filter
+	// construct an empty plan filter
 	CDXLNode *filter_dxlnode = PdxlnFilter(nullptr);
-	CDXLNode *dxlnode_join_filter = GPOS_NEW(m_mp)
-		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarJoinFilter(m_mp));
 
 	// add children
 	pdxlnMJ->AddChild(proj_list_dxlnode);
@@ -4698,9 +4734,18 @@ CTranslatorExprToDXL::PdxlnHashJoin(CExpression *pexprHJ,
 		pdrgpexprRemainingPredicates->Release();
 	}
 
+	// an inner hash join can hand a filter over its inner keys to a table
+	// scan that directly feeds its outer side, the scan then drops rows that
+	// cannot find a match before they reach the join
+	BOOL use_runtime_filter =
+		GPOS_FTRACE(EopttraceEnableRuntimeJoinFilter) &&
+		COperator::EopPhysicalInnerHashJoin == popHJ->Eopid() &&
+		EdxlopPhysicalTableScan ==
+			pdxlnOuterChild->GetOperator()->GetDXLOperator();
+
 	// construct a hash join node
-	CDXLPhysicalHashJoin *pdxlopHJ =
-		GPOS_NEW(m_mp) CDXLPhysicalHashJoin(m_mp, join_type);
+	CDXLPhysicalHashJoin *pdxlopHJ = GPOS_NEW(m_mp)
+		CDXLPhysicalHashJoin(m_mp, join_type, use_runtime_filter);
 
 	// construct projection list from required columns
 	GPOS_ASSERT(nullptr != pexprHJ->Prpp());
@@ -19,10 +19,13 @@
 
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CDrvdPropScalar.h"
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/operators/CLogicalInnerJoin.h"
 #include "gpopt/operators/CLogicalJoin.h"
 #include "gpopt/operators/CLogicalLeftOuterJoin.h"
 #include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/search/CGroup.h"
+#include "gpopt/search/CGroupExpression.h"
 
 
 using namespace gpopt;
@@ -605,6 +608,112 @@ CJoinOrder::DeriveStats(CExpression *pexpr)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::FJoinStatsKey
+//
+//	@doc:
+//		Fill in the ids of the memo groups of the given components and of
+//		the predicates covered by them; return false if any of these
+//		expressions was not extracted from the memo
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinOrder::FJoinStatsKey(CBitSet *pbsComps, CBitSet *pbsGroups,
+						  CBitSet *pbsPreds) const
+{
+	CBitSetIter bsi(*pbsComps);
+	while (bsi.Advance())
+	{
+		CGroupExpression *pgexpr = m_rgpcomp[bsi.Bit()]->m_pexpr->Pgexpr();
+		if (nullptr == pgexpr)
+		{
+			return false;
+		}
+		(void) pbsGroups->ExchangeSet(pgexpr->Pgroup()->Id());
+	}
+
+	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	{
+		SEdge *pedge = m_rgpedge[ul];
+		if (!pbsComps->ContainsAll(pedge->m_pbs))
+		{
+			continue;
+		}
+
+		CGroupExpression *pgexpr = pedge->m_pexpr->Pgexpr();
+		if (nullptr == pgexpr)
+		{
+			return false;
+		}
+		(void) pbsPreds->ExchangeSet(pgexpr->Pgroup()->Id());
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrder::DeriveJoinStats
+//
+//	@doc:
+//		Derive stats on an expression joining the given set of components.
+//		Different enumerators, and different xforms on the same NAry join,
+//		build different join trees over the same components; the stats of
+//		the first such tree are cached in the optimizer context and
+//		attached to the others instead of deriving them again
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrder::DeriveJoinStats(CExpression *pexpr, CBitSet *pbsComps)
+{
+	GPOS_ASSERT(nullptr != pexpr);
+	GPOS_ASSERT(nullptr != pbsComps);
+
+	if (nullptr != pexpr->Pstats())
+	{
+		return;
+	}
+
+	COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+	CJoinStatsCache *pjsc = poctxt->GetJoinStatsCache();
+	if (m_mp != poctxt->Pmp())
+	{
+		// cached stats must live as long as the optimizer context
+		DeriveStats(pexpr);
+		return;
+	}
+
+	CBitSet *pbsGroups = GPOS_NEW(m_mp) CBitSet(m_mp);
+	CBitSet *pbsPreds = GPOS_NEW(m_mp) CBitSet(m_mp);
+	if (!FJoinStatsKey(pbsComps, pbsGroups, pbsPreds))
+	{
+		pbsGroups->Release();
+		pbsPreds->Release();
+		DeriveStats(pexpr);
+		return;
+	}
+
+	const BOOL fBucketScaleFactor = FStatsFromHistogramBuckets();
+	IStatistics *stats = pjsc->Pstats(pbsGroups, pbsPreds, fBucketScaleFactor);
+	if (nullptr != stats)
+	{
+		stats->AddRef();
+		pexpr->AttachStats(stats);
+		pbsGroups->Release();
+		pbsPreds->Release();
+		return;
+	}
+
+	DeriveStats(pexpr);
+	stats = const_cast<IStatistics *>(pexpr->Pstats());
+	GPOS_ASSERT(nullptr != stats);
+	stats->AddRef();
+	pjsc->Insert(pbsGroups, pbsPreds, fBucketScaleFactor, stats);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrder::OsPrint
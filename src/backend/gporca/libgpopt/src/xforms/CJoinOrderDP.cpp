@@ -436,7 +436,7 @@ CJoinOrderDP::PexprJoin(CBitSet *pbs)
 	CExpression *pexprJoin = CUtils::PexprLogicalJoin<CLogicalInnerJoin>(
 		m_mp, pexprLeft, pexprRight, pexprScalar);
 
-	DeriveStats(pexprJoin);
+	DeriveJoinStats(pexprJoin, pbs);
 	// store solution in DP table
 	pbs->AddRef();
 	BOOL fInserted GPOS_ASSERTS_ONLY = m_phmbsexpr->Insert(pbs, pexprJoin);
@@ -521,7 +521,10 @@ CJoinOrderDP::PexprBestJoinOrderDP(CBitSet *pbs	 // set of elements to be joined
 		pexprResult = m_pexprDummy;
 	}
 
-	DeriveStats(pexprResult);
+	if (m_pexprDummy != pexprResult)
+	{
+		DeriveJoinStats(pexprResult, pbs);
+	}
 	pbs->AddRef();
 	BOOL fInserted GPOS_ASSERTS_ONLY = m_phmbsexpr->Insert(pbs, pexprResult);
 	GPOS_ASSERT(fInserted);
@@ -215,54 +215,81 @@ CJoinOrderDPv2::ComputeCost(SExpressionInfo *expr_info,
 //		CJoinOrderDPv2::PexprBuildInnerJoinPred
 //
 //	@doc:
-//		Build predicate connecting the two given sets
+//		Build predicate connecting the two given groups. Only the edges
+//		that reference an atom of each group are candidates, so we look
+//		at the intersection of the groups' edge sets instead of scanning
+//		all the edges for every pair of groups we try to join.
 //
 //---------------------------------------------------------------------------
 CExpression *
-CJoinOrderDPv2::PexprBuildInnerJoinPred(CBitSet *pbsFst, CBitSet *pbsSnd)
+CJoinOrderDPv2::PexprBuildInnerJoinPred(SGroupInfo *pgiFst, SGroupInfo *pgiSnd)
 {
+	CBitSet *pbsFst = pgiFst->m_atoms;
+	CBitSet *pbsSnd = pgiSnd->m_atoms;
 	GPOS_ASSERT(pbsFst->IsDisjoint(pbsSnd));
+
+	if (pgiFst->m_edges->IsDisjoint(pgiSnd->m_edges))
+	{
+		// no edge connects the two groups
+		return nullptr;
+	}
+
 	// collect edges connecting the given sets
-	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp);
+	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp, *pgiFst->m_edges);
+	pbsEdges->Intersection(pgiSnd->m_edges);
 	CBitSet *pbs = GPOS_NEW(m_mp) CBitSet(m_mp, *pbsFst);
 	pbs->Union(pbsSnd);
 
-	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+	CBitSetIter bsi(*pbsEdges);
+	while (bsi.Advance())
 	{
-		SEdge *pedge = m_rgpedge[ul];
+		SEdge *pedge = m_rgpedge[bsi.Bit()];
+		GPOS_ASSERT(!pbsFst->IsDisjoint(pedge->m_pbs) &&
+					!pbsSnd->IsDisjoint(pedge->m_pbs));
+
 		if (
 			// edge represents an inner join pred
 			0 == pedge->m_loj_num &&
 			// all columns referenced in the edge pred are provided
-			pbs->ContainsAll(pedge->m_pbs) &&
-			// the edge represents a true join predicate between the two components
-			!pbsFst->IsDisjoint(pedge->m_pbs) &&
-			!pbsSnd->IsDisjoint(pedge->m_pbs))
+			pbs->ContainsAll(pedge->m_pbs))
 		{
-			BOOL fSet GPOS_ASSERTS_ONLY = pbsEdges->ExchangeSet(ul);
-			GPOS_ASSERT(!fSet);
+			pedge->m_pexpr->AddRef();
+			pdrgpexpr->Append(pedge->m_pexpr);
 		}
 	}
 	pbs->Release();
+	pbsEdges->Release();
 
-	CExpression *pexprPred = nullptr;
-	if (0 < pbsEdges->Size())
+	if (0 == pdrgpexpr->Size())
 	{
-		CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
-		CBitSetIter bsi(*pbsEdges);
-		while (bsi.Advance())
-		{
-			ULONG ul = bsi.Bit();
-			SEdge *pedge = m_rgpedge[ul];
-			pedge->m_pexpr->AddRef();
-			pdrgpexpr->Append(pedge->m_pexpr);
-		}
+		pdrgpexpr->Release();
+		return nullptr;
+	}
+
+	return CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
+}
+
 
-		pexprPred = CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPv2::PbsEdgesOfAtoms
+//
+//	@doc:
+//		Collect the edges that reference any of the given atoms
+//
+//---------------------------------------------------------------------------
+CBitSet *
+CJoinOrderDPv2::PbsEdgesOfAtoms(CBitSet *atoms)
+{
+	CBitSet *pbsEdges = GPOS_NEW(m_mp) CBitSet(m_mp);
+	CBitSetIter bsi(*atoms);
+	while (bsi.Advance())
+	{
+		pbsEdges->Union(m_rgpcomp[bsi.Bit()]->m_edge_set);
 	}
 
-	pbsEdges->Release();
-	return pexprPred;
+	return pbsEdges;
 }
 
 void
@@ -348,8 +375,7 @@ CJoinOrderDPv2::GetJoinExpr(const SGroupAndExpression &left_child_expr,
 	{
 		// inner join, compute the predicate from the join graph
 		GPOS_ASSERT(nullptr == scalar_expr);
-		scalar_expr = PexprBuildInnerJoinPred(left_group_info->m_atoms,
-											  right_group_info->m_atoms);
+		scalar_expr = PexprBuildInnerJoinPred(left_group_info, right_group_info);
 	}
 	else
 	{
@@ -1297,7 +1323,8 @@ CJoinOrderDPv2::LookupOrCreateGroupInfo(SLevelInfo *levelInfo, CBitSet *atoms,
 	if (nullptr == group_info)
 	{
 		// this is a group we haven't seen yet, create a new group info and derive stats, if needed
-		group_info = GPOS_NEW(m_mp) SGroupInfo(m_mp, atoms);
+		group_info =
+			GPOS_NEW(m_mp) SGroupInfo(m_mp, atoms, PbsEdgesOfAtoms(atoms));
 		if (!stats_expr_info->m_properties.Satisfies(EJoinOrderStats))
 		{
 			SExpressionProperties stats_props(EJoinOrderStats);
@@ -1307,7 +1334,7 @@ CJoinOrderDPv2::LookupOrCreateGroupInfo(SLevelInfo *levelInfo, CBitSet *atoms,
 				stats_expr_info->m_left_child_expr.m_group_info,
 				stats_expr_info->m_right_child_expr.m_group_info, stats_props);
 
-			DeriveStats(real_expr_info_for_stats->m_expr);
+			DeriveJoinStats(real_expr_info_for_stats->m_expr, atoms);
 		}
 		else
 		{
@@ -94,7 +94,7 @@ CJoinOrderGreedy::GetStartingJoins()
 				compTemp->Release();
 				continue;
 			}
-			DeriveStats(compTemp->m_pexpr);
+			DeriveJoinStats(compTemp->m_pexpr, compTemp->m_pbs);
 			CDouble dRows = compTemp->m_pexpr->Pstats()->Rows();
 			if (dMinRows <= 0 || dRows < dMinRows)
 			{
@@ -237,7 +237,7 @@ CJoinOrderGreedy::PickBestJoin(CBitSet *candidate_comp_set)
 		}
 
 		SComponent *pcompTemp = PcompCombine(m_pcompResult, pcompCurrent);
-		DeriveStats(pcompTemp->m_pexpr);
+		DeriveJoinStats(pcompTemp->m_pexpr, pcompTemp->m_pbs);
 		CDouble dRows = pcompTemp->m_pexpr->Pstats()->Rows();
 
 		// pick the component which will give the lowest cardinality
@@ -104,7 +104,7 @@ CJoinOrderMinCard::PexprExpand()
 			// combine component with current result and derive stats
 			CJoinOrder::SComponent *pcompTemp =
 				PcompCombine(m_pcompResult, pcompCurrent);
-			DeriveStats(pcompTemp->m_pexpr);
+			DeriveJoinStats(pcompTemp->m_pexpr, pcompTemp->m_pbs);
 			CDouble rows = pcompTemp->m_pexpr->Pstats()->Rows();
 
 			if (nullptr == pcompBestResult || rows < dMinRows)
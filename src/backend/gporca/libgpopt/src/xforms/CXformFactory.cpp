@@ -300,6 +300,8 @@ CXformFactory::Instantiate()
 	Add(GPOS_NEW(m_mp) CXformSelect2IndexOnlyGet(m_mp));
 	Add(GPOS_NEW(m_mp) CXformSelect2DynamicIndexOnlyGet(m_mp));
 	Add(GPOS_NEW(m_mp) CXformLimit2IndexOnlyGet(m_mp));
+	Add(GPOS_NEW(m_mp) CXformInnerJoin2MergeJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformLeftOuterJoin2MergeJoin(m_mp));
 
 	GPOS_ASSERT(nullptr != m_rgpxf[CXform::ExfSentinel - 1] &&
 				"Not all xforms have been instantiated");
@@ -6,7 +6,7 @@
 //		CBitSet.h
 //
 //	@doc:
-//		Implementation of bitset as linked list of bitvectors
+//		Implementation of bitset as a flat array of words
 //---------------------------------------------------------------------------
 #ifndef GPOS_CBitSet_H
 #define GPOS_CBitSet_H
@@ -17,6 +17,9 @@
 #include "gpos/common/CList.h"
 #include "gpos/common/DbgPrintMixin.h"
 
+// number of words stored inside the bitset object
+#define GPOS_BITSET_INLINE_WORDS (4)
+
 
 namespace gpos
 {
@@ -25,7 +28,16 @@ namespace gpos
 //		CBitSet
 //
 //	@doc:
-//		Linked list of CBitSetLink's
+//		Bitset stored as a contiguous array of 64-bit words. Sets of up to
+//		GPOS_BITSET_INLINE_WORDS words (256 bits) live inside the object;
+//		larger sets move to a buffer allocated from the memory pool that
+//		doubles as needed. Set operations are simple word loops the
+//		compiler can vectorize, and the size is maintained with popcount.
+//
+//		The vector size passed to the ctor no longer affects the storage;
+//		it is kept as the granularity of HashValue(), which hashes the
+//		set in vector-sized chunks exactly like the former linked list of
+//		bitvectors did, so hash values do not change.
 //
 //---------------------------------------------------------------------------
 class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
@@ -34,80 +46,57 @@ class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
 	friend class CBitSetIter;
 
 protected:
-	//---------------------------------------------------------------------------
-	//	@class:
-	//		CBitSetLink
-	//
-	//	@doc:
-	//		bit vector + offset + link
-	//
-	//---------------------------------------------------------------------------
-	class CBitSetLink
-	{
-	private:
-		// offset
-		ULONG m_offset;
-
-		// bitvector
-		CBitVector *m_vec;
-
-	public:
-		CBitSetLink(const CBitSetLink &) = delete;
-
-		// ctor
-		explicit CBitSetLink(CMemoryPool *, ULONG offset, ULONG vector_size);
-
-		explicit CBitSetLink(CMemoryPool *, const CBitSetLink &);
-
-		// dtor
-		~CBitSetLink();
-
-		// accessor
-		ULONG
-		GetOffset() const
-		{
-			return m_offset;
-		}
-
-		// accessor
-		CBitVector *
-		GetVec() const
-		{
-			return m_vec;
-		}
-
-		// list link
-		SLink m_link;
-
-	};	// class CBitSetLink
-
-	// list of bit set links
-	CList<CBitSetLink> m_bsllist;
-
-	// pool to allocate links from
+	// pool to allocate the words from
 	CMemoryPool *m_mp;
 
-	// size of individual bitvectors
+	// size of the chunks the set is hashed in
 	ULONG m_vector_size;
 
 	// number of elements
 	ULONG m_size;
 
+	// number of words up to the last non-zero one; words beyond are zero
+	ULONG m_len;
+
+	// number of words allocated
+	ULONG m_capacity;
+
+	// words, pointing either to m_inline_vec or to a pool allocation
+	ULLONG *m_vec;
+
+	// inline storage for small sets
+	ULLONG m_inline_vec[GPOS_BITSET_INLINE_WORDS];
+
 	// private copy ctor
 	CBitSet(const CBitSet &);
 
-	// find link with offset less or equal to given value
-	CBitSetLink *FindLinkByOffset(ULONG, CBitSetLink * = nullptr) const;
+	// number of set bits in a word
+	static ULONG
+	PopCount(ULLONG word)
+	{
+		return (ULONG) __builtin_popcountll(word);
+	}
 
-	// reset set
-	void Clear();
+	// position of the lowest set bit of a non-zero word
+	static ULONG
+	LowestSetBit(ULLONG word)
+	{
+		GPOS_ASSERT(0 != word);
+		return (ULONG) __builtin_ctzll(word);
+	}
+
+	// make room for at least the given number of words
+	void EnsureCapacity(ULONG len);
 
-	// compute target offset
-	ULONG ComputeOffset(ULONG) const;
+	// drop trailing zero words from the used length
+	void Trim();
 
 	// re-compute size of set
 	void RecomputeSize();
 
+	// hash value of the chunk of m_vector_size bits at the given offset
+	BOOL HashChunk(ULONG offset, ULONG *chunk_hash) const;
+
 public:
 	// ctor
 	CBitSet(CMemoryPool *mp, ULONG vector_size = 256);
@@ -117,7 +106,12 @@ public:
 	~CBitSet() override;
 
 	// determine if bit is set
-	BOOL Get(ULONG pos) const;
+	BOOL
+	Get(ULONG pos) const
+	{
+		const ULONG idx = pos / 64;
+		return idx < m_len && 0 != (m_vec[idx] & (((ULLONG) 1) << (pos % 64)));
+	}
 
 	// set given bit; return previous value
 	BOOL ExchangeSet(ULONG pos);
@@ -0,0 +1,212 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashMap.h
+//
+//	@doc:
+//		Open-addressing hash map
+//		* same interface and ownership semantics as CHashMap
+//		* grows automatically, so the initial size is only a hint
+//		* iterates in insertion order (unless entries are deleted)
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashMap_H
+#define GPOS_COpenHashMap_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/COpenHashTable.h"
+#include "gpos/common/CRefCount.h"
+
+namespace gpos
+{
+// fwd declaration
+template <class K, class T, ULONG (*HashFn)(const K *),
+		  BOOL (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
+		  void (*DestroyTFn)(T *)>
+class COpenHashMapIter;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashMap
+//
+//	@doc:
+//		Hash map that keeps keys and values in dense insertion-ordered
+//		arrays, and finds them through a Robin Hood hashed index (see
+//		COpenHashTable). Lookups probe a small contiguous run of slots and
+//		compare stored hash values before calling EqFn, instead of walking
+//		a hash chain of separately allocated elements.
+//
+//---------------------------------------------------------------------------
+template <class K, class T, ULONG (*HashFn)(const K *),
+		  BOOL (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
+		  void (*DestroyTFn)(T *)>
+class COpenHashMap : public CRefCount
+{
+	// fwd declaration
+	friend class COpenHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>;
+
+private:
+	// array for keys
+	// We use CleanupNULL because the keys are owned by the hash table
+	using Keys = CDynamicPtrArray<K, CleanupNULL>;
+
+	// array for values, owned by the hash table as well
+	using Values = CDynamicPtrArray<T, CleanupNULL>;
+
+	// memory pool
+	CMemoryPool *const m_mp;
+
+	// keys in insertion order
+	Keys *const m_keys;
+
+	// values, at the same positions as their keys
+	Values *const m_values;
+
+	// index from hash values to positions in the arrays above
+	COpenHashTable m_index;
+
+	// does the entry at the given position of the map have the given key
+	static BOOL
+	FEqualKey(const void *map, ULONG pos, const void *key)
+	{
+		const Keys *keys = static_cast<const COpenHashMap *>(map)->m_keys;
+		return EqFn((*keys)[pos], static_cast<const K *>(key));
+	}
+
+	// position of the given key, or gpos::ulong_max if not present
+	ULONG
+	Lookup(const K *key, ULONG hash) const
+	{
+		return m_index.Find(hash, key, FEqualKey, this);
+	}
+
+public:
+	COpenHashMap(const COpenHashMap<K, T, HashFn, EqFn, DestroyKFn,
+									DestroyTFn> &) = delete;
+
+	// ctor
+	COpenHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>(
+		CMemoryPool *mp, ULONG num_chains = 127)
+		: m_mp(mp),
+		  m_keys(GPOS_NEW(mp) Keys(mp)),
+		  m_values(GPOS_NEW(mp) Values(mp)),
+		  m_index(mp, num_chains)
+	{
+		GPOS_ASSERT(num_chains > 0);
+	}
+
+	// dtor
+	~COpenHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>() override
+	{
+		for (ULONG ul = 0; ul < m_keys->Size(); ul++)
+		{
+			DestroyKFn((*m_keys)[ul]);
+			DestroyTFn((*m_values)[ul]);
+		}
+
+		m_keys->Release();
+		m_values->Release();
+	}
+
+	// insert an element if key is not yet present
+	BOOL
+	Insert(K *key, T *value)
+	{
+		GPOS_ASSERT(nullptr != key);
+
+		const ULONG hash = HashFn(key);
+		if (gpos::ulong_max != Lookup(key, hash))
+		{
+			return false;
+		}
+
+		m_index.Insert(hash, m_keys->Size());
+		m_keys->Append(key);
+		m_values->Append(value);
+
+		return true;
+	}
+
+	// lookup a value by its key
+	T *
+	Find(const K *key) const
+	{
+		const ULONG pos = Lookup(key, HashFn(key));
+		if (gpos::ulong_max != pos)
+		{
+			return (*m_values)[pos];
+		}
+
+		return nullptr;
+	}
+
+	// replace the value in a map entry with a new given value
+	BOOL
+	Replace(const K *key, T *ptNew)
+	{
+		GPOS_ASSERT(nullptr != key);
+
+		const ULONG pos = Lookup(key, HashFn(key));
+		if (gpos::ulong_max == pos)
+		{
+			return false;
+		}
+
+		DestroyTFn((*m_values)[pos]);
+		m_values->Replace(pos, ptNew);
+
+		return true;
+	}
+
+	// delete an entry; the last entry takes its place in iteration order
+	BOOL
+	Delete(const K *key)
+	{
+		const ULONG hash = HashFn(key);
+		const ULONG pos = Lookup(key, hash);
+		if (gpos::ulong_max == pos)
+		{
+			return false;
+		}
+
+		K *deleted_key = (*m_keys)[pos];
+		T *deleted_value = (*m_values)[pos];
+
+		const ULONG last = m_keys->Size() - 1;
+		m_index.Remove(hash, pos);
+		if (pos != last)
+		{
+			m_index.Move(HashFn((*m_keys)[last]), last, pos);
+			m_keys->Swap(pos, last);
+			m_values->Swap(pos, last);
+		}
+		(void) m_keys->RemoveLast();
+		(void) m_values->RemoveLast();
+
+		DestroyKFn(deleted_key);
+		DestroyTFn(deleted_value);
+
+		return true;
+	}
+
+	// return number of map entries
+	ULONG
+	Size() const
+	{
+		return m_keys->Size();
+	}
+
+	Keys *
+	GetKeys() const
+	{
+		return m_keys;
+	}
+};	// class COpenHashMap
+
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashMap_H
+
+// EOF
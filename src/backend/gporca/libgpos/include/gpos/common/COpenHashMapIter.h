@@ -0,0 +1,94 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashMapIter.h
+//
+//	@doc:
+//		Open-addressing hash map iterator
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashMapIter_H
+#define GPOS_COpenHashMapIter_H
+
+#include "gpos/base.h"
+#include "gpos/common/COpenHashMap.h"
+#include "gpos/common/CStackObject.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashMapIter
+//
+//	@doc:
+//		Iterator over the entries of a COpenHashMap in insertion order;
+//		same interface as CHashMapIter
+//
+//---------------------------------------------------------------------------
+template <class K, class T, ULONG (*HashFn)(const K *),
+		  BOOL (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
+		  void (*DestroyTFn)(T *)>
+class COpenHashMapIter : public CStackObject
+{
+	// short hand for hashmap type
+	using TMap = COpenHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>;
+
+private:
+	// map to iterate
+	const TMap *m_map;
+
+	// position after the current entry
+	ULONG m_pos;
+
+public:
+	COpenHashMapIter(const COpenHashMapIter<K, T, HashFn, EqFn, DestroyKFn,
+											DestroyTFn> &) = delete;
+
+	// ctor
+	COpenHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>(TMap *ptm)
+		: m_map(ptm), m_pos(0)
+	{
+		GPOS_ASSERT(nullptr != ptm);
+	}
+
+	// dtor
+	virtual ~COpenHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>() =
+		default;
+
+	// advance iterator to next element
+	BOOL
+	Advance()
+	{
+		if (m_pos < m_map->Size())
+		{
+			m_pos++;
+			return true;
+		}
+
+		return false;
+	}
+
+	// current key
+	const K *
+	Key() const
+	{
+		GPOS_ASSERT(0 < m_pos && "Advance() was not called");
+		return (*(m_map->m_keys))[m_pos - 1];
+	}
+
+	// current value
+	const T *
+	Value() const
+	{
+		GPOS_ASSERT(0 < m_pos && "Advance() was not called");
+		return (*(m_map->m_values))[m_pos - 1];
+	}
+
+};	// class COpenHashMapIter
+
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashMapIter_H
+
+// EOF
@@ -0,0 +1,136 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashSet.h
+//
+//	@doc:
+//		Open-addressing hash set
+//		* same interface and ownership semantics as CHashSet
+//		* grows automatically, so the initial size is only a hint
+//		* iterates in insertion order
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashSet_H
+#define GPOS_COpenHashSet_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/COpenHashTable.h"
+#include "gpos/common/CRefCount.h"
+
+namespace gpos
+{
+// fwd declaration
+template <class T, ULONG (*HashFn)(const T *),
+		  BOOL (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
+class COpenHashSetIter;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashSet
+//
+//	@doc:
+//		Hash set that keeps its elements in a dense insertion-ordered array
+//		and finds them through a Robin Hood hashed index (see
+//		COpenHashTable)
+//
+//---------------------------------------------------------------------------
+template <class T, ULONG (*HashFn)(const T *),
+		  BOOL (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
+class COpenHashSet : public CRefCount
+{
+	// fwd declaration
+	friend class COpenHashSetIter<T, HashFn, EqFn, CleanupFn>;
+
+private:
+	// array for elements
+	// We use CleanupNULL because the elements are owned by the hash set
+	using Elements = CDynamicPtrArray<T, CleanupNULL>;
+
+	// elements in insertion order
+	Elements *const m_elements;
+
+	// index from hash values to positions in the array above
+	COpenHashTable m_index;
+
+	// is the element at the given position of the set equal to the given one
+	static BOOL
+	FEqualElem(const void *set, ULONG pos, const void *value)
+	{
+		const Elements *elems = static_cast<const COpenHashSet *>(set)->m_elements;
+		return EqFn((*elems)[pos], static_cast<const T *>(value));
+	}
+
+public:
+	COpenHashSet(const COpenHashSet<T, HashFn, EqFn, CleanupFn> &) = delete;
+
+	// ctor
+	COpenHashSet<T, HashFn, EqFn, CleanupFn>(CMemoryPool *mp, ULONG size = 127)
+		: m_elements(GPOS_NEW(mp) Elements(mp)), m_index(mp, size)
+	{
+		GPOS_ASSERT(size > 0);
+	}
+
+	// dtor
+	~COpenHashSet<T, HashFn, EqFn, CleanupFn>() override
+	{
+		for (ULONG ul = 0; ul < m_elements->Size(); ul++)
+		{
+			CleanupFn((*m_elements)[ul]);
+		}
+
+		m_elements->Release();
+	}
+
+	// insert an element if not yet present
+	BOOL
+	Insert(T *value)
+	{
+		GPOS_ASSERT(nullptr != value);
+
+		const ULONG hash = HashFn(value);
+		if (gpos::ulong_max != m_index.Find(hash, value, FEqualElem, this))
+		{
+			return false;
+		}
+
+		m_index.Insert(hash, m_elements->Size());
+		m_elements->Append(value);
+
+		return true;
+	}
+
+	// lookup element
+	BOOL
+	Contains(const T *value) const
+	{
+		return gpos::ulong_max !=
+			   m_index.Find(HashFn(value), value, FEqualElem, this);
+	}
+
+	// return number of elements
+	ULONG
+	Size() const
+	{
+		return m_elements->Size();
+	}
+
+	// first inserted element
+	T *
+	First()
+	{
+		if (0 == m_elements->Size())
+		{
+			return nullptr;
+		}
+
+		return (*m_elements)[0];
+	}
+};	// class COpenHashSet
+
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashSet_H
+
+// EOF
@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashSetIter.h
+//
+//	@doc:
+//		Open-addressing hash set iterator
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashSetIter_H
+#define GPOS_COpenHashSetIter_H
+
+#include "gpos/base.h"
+#include "gpos/common/COpenHashSet.h"
+#include "gpos/common/CStackObject.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashSetIter
+//
+//	@doc:
+//		Iterator over the elements of a COpenHashSet in insertion order;
+//		same interface as CHashSetIter
+//
+//---------------------------------------------------------------------------
+template <class T, ULONG (*HashFn)(const T *),
+		  BOOL (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
+class COpenHashSetIter : public CStackObject
+{
+	// short hand for hashset type
+	using TSet = COpenHashSet<T, HashFn, EqFn, CleanupFn>;
+
+private:
+	// set to iterate
+	const TSet *m_set;
+
+	// position after the current element
+	ULONG m_pos;
+
+public:
+	COpenHashSetIter(const COpenHashSetIter<T, HashFn, EqFn, CleanupFn> &) =
+		delete;
+
+	// ctor
+	COpenHashSetIter<T, HashFn, EqFn, CleanupFn>(TSet *set)
+		: m_set(set), m_pos(0)
+	{
+		GPOS_ASSERT(nullptr != set);
+	}
+
+	// dtor
+	virtual ~COpenHashSetIter<T, HashFn, EqFn, CleanupFn>() = default;
+
+	// advance iterator to next element
+	BOOL
+	Advance()
+	{
+		if (m_pos < m_set->Size())
+		{
+			m_pos++;
+			return true;
+		}
+
+		return false;
+	}
+
+	// current element
+	const T *
+	Get() const
+	{
+		GPOS_ASSERT(0 < m_pos && "Advance() was not called");
+		return (*(m_set->m_elements))[m_pos - 1];
+	}
+
+};	// class COpenHashSetIter
+
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashSetIter_H
+
+// EOF
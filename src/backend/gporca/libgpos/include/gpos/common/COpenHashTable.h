@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashTable.h
+//
+//	@doc:
+//		Open-addressing index from hash values to positions of entries
+//		kept by a container
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashTable_H
+#define GPOS_COpenHashTable_H
+
+#include "gpos/base.h"
+
+// smallest number of slots of a non-empty index
+#define GPOS_OPEN_HASH_MIN_SLOTS (8)
+
+// largest number of slots allocated up front for a size hint
+#define GPOS_OPEN_HASH_MAX_INIT_SLOTS (1024)
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashTable
+//
+//	@doc:
+//		Robin Hood hash table of (hash value, position) slots.
+//
+//		The container (COpenHashMap, COpenHashSet) keeps its entries in a
+//		dense array; this index only maps a hash value to candidate
+//		positions. An entry is placed at the first free slot after its home
+//		slot, displacing entries that are closer to their own home, so
+//		probe sequences stay short and a lookup can stop as soon as it
+//		meets an entry closer to home than itself. Deleting shifts the
+//		following entries back, so there are no tombstones. The number of
+//		slots is a power of 2 and doubles whenever the table gets more
+//		than 7/8 full; slots are only allocated on the first insertion.
+//
+//---------------------------------------------------------------------------
+class COpenHashTable
+{
+public:
+	// equality of the key at a position of the container to a given key
+	using EqualFuncPtr = BOOL (*)(const void *container, ULONG pos,
+								  const void *key);
+
+private:
+	// a slot of the table; free slots have the position gpos::ulong_max
+	struct SSlot
+	{
+		ULONG m_hash{0};
+
+		ULONG m_pos{gpos::ulong_max};
+	};
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// slots, nullptr until the first insertion
+	SSlot *m_slots{nullptr};
+
+	// number of slots
+	ULONG m_num_slots{0};
+
+	// shift turning a scrambled hash value into a slot index
+	ULONG m_shift{0};
+
+	// number of used slots
+	ULONG m_size{0};
+
+	// number of slots to allocate on the first insertion
+	ULONG m_init_slots;
+
+	// home slot of a hash value; multiplicative hashing spreads hash
+	// values that only differ in their high bits, e.g. small integers
+	ULONG
+	Home(ULONG hash) const
+	{
+		return (ULONG)(hash * 0x9E3779B1U) >> m_shift;
+	}
+
+	// distance of the entry in the given slot from its home slot
+	ULONG
+	Distance(ULONG slot) const
+	{
+		return (slot - Home(m_slots[slot].m_hash)) & (m_num_slots - 1);
+	}
+
+	// slot holding the given position
+	ULONG FindSlot(ULONG hash, ULONG pos) const;
+
+	// place an entry, assuming there is a free slot
+	void InsertSlot(ULONG hash, ULONG pos);
+
+	// double the number of slots
+	void Grow();
+
+public:
+	COpenHashTable(const COpenHashTable &) = delete;
+
+	// ctor
+	COpenHashTable(CMemoryPool *mp, ULONG size_hint);
+
+	// dtor
+	~COpenHashTable();
+
+	// position of the entry with the given hash value and key, or
+	// gpos::ulong_max if there is none
+	ULONG
+	Find(ULONG hash, const void *key, EqualFuncPtr equal_func,
+		 const void *container) const
+	{
+		if (0 == m_size)
+		{
+			return gpos::ulong_max;
+		}
+
+		const ULONG mask = m_num_slots - 1;
+		ULONG slot = Home(hash);
+		for (ULONG dist = 0;; dist++, slot = (slot + 1) & mask)
+		{
+			const SSlot &s = m_slots[slot];
+			if (gpos::ulong_max == s.m_pos || Distance(slot) < dist)
+			{
+				return gpos::ulong_max;
+			}
+
+			if (s.m_hash == hash && equal_func(container, s.m_pos, key))
+			{
+				return s.m_pos;
+			}
+		}
+	}
+
+	// add an entry at the given position of the container
+	void Insert(ULONG hash, ULONG pos);
+
+	// remove the entry at the given position of the container
+	void Remove(ULONG hash, ULONG pos);
+
+	// the container moved an entry to a different position
+	void
+	Move(ULONG hash, ULONG old_pos, ULONG new_pos)
+	{
+		m_slots[FindSlot(hash, old_pos)].m_pos = new_pos;
+	}
+
+	// number of entries
+	ULONG
+	Size() const
+	{
+		return m_size;
+	}
+};	// class COpenHashTable
+
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashTable_H
+
+// EOF
@@ -61,7 +61,9 @@ public:
 	CAutoMemoryPool(const CAutoMemoryPool &) = delete;
 
 	// ctor
-	CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc);
+	CAutoMemoryPool(
+		ELeakCheck leak_check_type = ElcExc,
+		CMemoryPool::EAllocStrategy strategy = CMemoryPool::EasGeneral);
 
 	// FIXME: should mark this noexcept in non-assert builds
 	// dtor
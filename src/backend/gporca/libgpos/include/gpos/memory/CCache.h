@@ -77,6 +77,9 @@ public:
 	using HashFuncPtr = ULONG (*)(const K &);
 	using EqualFuncPtr = BOOL (*)(const K &, const K &);
 
+	// type definition of a predicate selecting entries to evict
+	using EvictFuncPtr = BOOL (*)(const K &, const T &, void *);
+
 private:
 	using CCacheHashTableEntry = CCacheEntry<T, K>;
 
@@ -257,6 +260,8 @@ private:
 
 		if (deleted)
 		{
+			m_cache_size -= entry->Pmp()->TotalAllocatedSize();
+
 			// delete cache entry
 			DestroyCacheEntry(entry);
 		}
@@ -507,6 +512,57 @@ public:
 		}
 	}
 
+	// evict all entries selected by the given predicate; entries that are
+	// in use are marked for deletion and removed once they are released;
+	// returns the number of evicted entries
+	ULONG
+	EvictEntries(EvictFuncPtr evict_func, void *context)
+	{
+		GPOS_ASSERT(nullptr != evict_func);
+
+		ULONG num_evicted = 0;
+		CCacheHashtableIter iter(m_hash_table);
+		BOOL has_next = iter.Advance();
+		while (has_next)
+		{
+			CCacheHashTableEntry *entry = nullptr;
+			BOOL deleted = false;
+			// Scope for CCacheHashtableIterAccessor
+			{
+				CCacheHashtableIterAccessor acc(iter);
+
+				entry = acc.Value();
+				if (nullptr != entry && !entry->IsMarkedForDeletion() &&
+					evict_func(entry->m_key, entry->Val(), context))
+				{
+					num_evicted++;
+					if (EXPECTED_REF_COUNT_FOR_DELETE == entry->RefCount())
+					{
+						// remove advances iterator automatically
+						acc.Remove(entry);
+						deleted = true;
+						m_cache_size -= entry->Pmp()->TotalAllocatedSize();
+					}
+					else
+					{
+						entry->MarkForDeletion();
+					}
+				}
+			}
+
+			if (deleted)
+			{
+				DestroyCacheEntry(entry);
+			}
+			else
+			{
+				has_next = iter.Advance();
+			}
+		}
+
+		return num_evicted;
+	}
+
 	// return eviction factor (what percentage of cache size to evict)
 	float
 	GetEvictionFactor()
@@ -149,8 +149,9 @@ public:
 	{
 		GPOS_ASSERT(nullptr == m_mp);
 
-		// construct a memory pool for cache entry
-		m_mp = CMemoryPoolManager::CreateMemoryPool();
+		// construct a memory pool for cache entry; most entries hold a single
+		// small object, and the pool's footprint counts against the cache quota
+		m_mp = CMemoryPoolManager::CreateMemoryPool(CMemoryPool::EasCompact);
 
 		return m_mp;
 	}
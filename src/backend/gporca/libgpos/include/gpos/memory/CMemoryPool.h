@@ -20,6 +20,9 @@
 //			To calculate this, we calculate the length by calling UserSizeOfAlloc(). This
 //			is only done for allocations of type EatArray and thus we do not store the
 //			allocation length for non-array allocations.
+//		3. Pools created by CMemoryPoolManager may use different allocation
+//			strategies (see EAllocStrategy). Their allocation headers end with an
+//			SAllocTag, so the manager can route a free to the right pool type.
 //
 //---------------------------------------------------------------------------
 #ifndef GPOS_CMemoryPool_H
@@ -93,10 +96,6 @@ private:
 	// link structure to manage pools
 	SLink m_link;
 
-protected:
-	// invalid memory pool key
-	static const ULONG_PTR m_invalid;
-
 public:
 	enum EAllocationType
 	{
@@ -105,6 +104,40 @@ public:
 		EatArray = 0x7e
 	};
 
+	// allocation strategy of a memory pool
+	enum EAllocStrategy
+	{
+		EasGeneral = 0,	 // objects are allocated and freed individually
+		EasArena,		 // bump allocation from large chunks, freed in bulk
+		EasCompact,		 // few small, long-lived objects; low per-pool overhead
+
+		EasSentinel
+	};
+
+protected:
+	// invalid memory pool key
+	static const ULONG_PTR m_invalid;
+
+	// trailer of the allocation header used by pools of CMemoryPoolManager;
+	// it immediately precedes the user data
+	struct SAllocTag
+	{
+		// user requested size
+		ULONG m_user_size;
+
+		// allocation strategy of the owning pool
+		ULONG m_strategy;
+	};
+
+	// tag preceding the given user data
+	static SAllocTag *
+	AllocTag(const void *ptr)
+	{
+		return static_cast<SAllocTag *>(const_cast<void *>(ptr)) - 1;
+	}
+
+public:
+
 	CMemoryPool()
 		// MAX LONG is invalid hash key, so skip that hash value.
 		: m_distribution(0, std::numeric_limits<ULONG>::max() - 1),
@@ -166,6 +199,14 @@ public:
 		return 0;
 	}
 
+	// return highest total allocated size over the lifetime of the pool
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
 	// requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 
@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMemoryPoolArena.h
+//
+//	@doc:
+//		Memory pool that bump-allocates from large chunks and releases
+//		all of its memory at once when the pool is destroyed
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArena_H
+#define GPOS_CMemoryPoolArena_H
+
+#include "gpos/assert.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolStatistics.h"
+#include "gpos/types.h"
+
+// size of the first chunk of an arena
+#define GPOS_MEM_ARENA_CHUNK_INIT_SIZE (64 * 1024)
+
+// chunk sizes double until they reach this limit
+#define GPOS_MEM_ARENA_CHUNK_MAX_SIZE (1024 * 1024)
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CMemoryPoolArena
+//
+//	@doc:
+//		Arena memory pool for objects that die together with the pool.
+//
+//		Allocations are carved out of malloc'ed chunks by advancing a cursor;
+//		each allocation only carries an SAllocTag, so that arrays can be
+//		destroyed element-wise and CMemoryPoolManager can tell arena memory
+//		apart from memory of other pools. Freeing an allocation does not
+//		reclaim its memory; all chunks are released in TearDown(). Only
+//		aggregate statistics are kept and live objects cannot be walked.
+//
+//---------------------------------------------------------------------------
+class CMemoryPoolArena : public CMemoryPool
+{
+private:
+	// header of a chunk of memory
+	struct SChunkHeader
+	{
+		// next chunk in the list of chunks owned by the pool
+		SChunkHeader *m_next;
+
+		// total size of the chunk (including header)
+		ULONG m_size;
+	};
+
+	// list of chunks, most recently allocated first
+	SChunkHeader *m_chunks{nullptr};
+
+	// next free byte in the current chunk
+	BYTE *m_cursor{nullptr};
+
+	// end of the current chunk
+	BYTE *m_limit{nullptr};
+
+	// size of the next regular chunk
+	ULONG m_next_chunk_size{GPOS_MEM_ARENA_CHUNK_INIT_SIZE};
+
+	// total size of all chunks
+	ULLONG m_total_chunk_size{0};
+
+	// aggregate allocation statistics
+	CMemoryPoolStatistics m_memory_pool_statistics;
+
+	// allocate a new chunk holding at least the given number of bytes
+	BYTE *AllocChunk(ULONG bytes, BOOL dedicated);
+
+protected:
+	// dtor
+	~CMemoryPoolArena() override;
+
+public:
+	CMemoryPoolArena(const CMemoryPoolArena &) = delete;
+
+	// ctor
+	CMemoryPoolArena();
+
+	// prepare the memory pool to be deleted
+	void TearDown() override;
+
+	// allocate memory
+	void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
+				  CMemoryPool::EAllocationType eat) override;
+
+	// free memory allocation; memory is only reclaimed with the pool
+	static void DeleteImpl(void *ptr, EAllocationType eat);
+
+	// get user requested size of allocation
+	static ULONG UserSizeOfAlloc(const void *ptr);
+
+	// check if the given user data was allocated by an arena pool
+	static BOOL
+	IsArenaAlloc(const void *ptr)
+	{
+		return EasArena == AllocTag(ptr)->m_strategy;
+	}
+
+	// return total size of chunks held by the pool
+	ULLONG
+	TotalAllocatedSize() const override
+	{
+		return m_total_chunk_size;
+	}
+
+	// chunks are only released with the pool, so the total is the peak
+	ULLONG
+	PeakAllocatedSize() const override
+	{
+		return m_total_chunk_size;
+	}
+
+	// number of allocations served by the pool
+	ULLONG
+	NumAllocations() const
+	{
+		return m_memory_pool_statistics.GetNumSuccessfulAllocations();
+	}
+
+	// total bytes requested from the pool
+	ULLONG
+	UserAllocatedSize() const
+	{
+		return m_memory_pool_statistics.LiveObjUserSize();
+	}
+};
+}  // namespace gpos
+
+#endif	// !GPOS_CMemoryPoolArena_H
+
+// EOF
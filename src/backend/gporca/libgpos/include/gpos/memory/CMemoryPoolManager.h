@@ -59,8 +59,8 @@ private:
 	// global instance
 	static CMemoryPoolManager *m_memory_pool_mgr;
 
-	// create new pool of given type
-	virtual CMemoryPool *NewMemoryPool();
+	// create new pool using the given allocation strategy
+	virtual CMemoryPool *NewMemoryPool(CMemoryPool::EAllocStrategy strategy);
 
 	// clean-up memory pools
 	static void Cleanup();
@@ -116,7 +116,8 @@ public:
 	CMemoryPoolManager(const CMemoryPoolManager &) = delete;
 
 	// create new memory pool
-	static CMemoryPool *CreateMemoryPool();
+	static CMemoryPool *CreateMemoryPool(
+		CMemoryPool::EAllocStrategy strategy = CMemoryPool::EasGeneral);
 
 	// release memory pool
 	static void Destroy(CMemoryPool *);
@@ -38,6 +38,8 @@ private:
 
 	ULLONG m_live_obj_total_size{0};
 
+	ULLONG m_live_obj_peak_size{0};
+
 public:
 	CMemoryPoolStatistics(CMemoryPoolStatistics &) = delete;
 
@@ -90,6 +92,13 @@ public:
 		return m_live_obj_total_size;
 	}
 
+	// get the highest total data size of live objects so far
+	ULLONG
+	LiveObjPeakSize() const
+	{
+		return m_live_obj_peak_size;
+	}
+
 	// record a successful allocation
 	void
 	RecordAllocation(ULONG user_data_size, ULONG total_data_size)
@@ -98,6 +107,10 @@ public:
 		++m_num_live_obj;
 		m_live_obj_user_size += user_data_size;
 		m_live_obj_total_size += total_data_size;
+		if (m_live_obj_total_size > m_live_obj_peak_size)
+		{
+			m_live_obj_peak_size = m_live_obj_total_size;
+		}
 	}
 
 	// record a successful free call (of a valid, non-NULL pointer)
@@ -42,8 +42,8 @@ private:
 		// total allocation size (including headers)
 		ULONG m_alloc_size;
 
-		// user requested size
-		ULONG m_user_size;
+		// line in file
+		ULONG m_line;
 
 		// sequence number
 		ULLONG m_serial;
@@ -51,9 +51,6 @@ private:
 		// file name
 		const CHAR *m_filename;
 
-		// line in file
-		ULONG m_line;
-
 #ifdef GPOS_DEBUG
 		// allocation stack
 		CStackDescriptor m_stack_desc;
@@ -61,6 +58,9 @@ private:
 
 		// link for allocation list
 		SLink m_link;
+
+		// user requested size and pool strategy; must be the last member
+		SAllocTag m_tag;
 	};
 
 	// statistics
@@ -108,6 +108,13 @@ public:
 		return m_memory_pool_statistics.TotalAllocatedSize();
 	}
 
+	// return highest total allocated size
+	ULLONG
+	PeakAllocatedSize() const override
+	{
+		return m_memory_pool_statistics.LiveObjPeakSize();
+	}
+
 #ifdef GPOS_DEBUG
 
 	// check if the memory pool keeps track of live objects
@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashMapTest.h
+//
+//	@doc:
+//		Test for COpenHashMap
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashMapTest_H
+#define GPOS_COpenHashMapTest_H
+
+#include "gpos/base.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashMapTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+class COpenHashMapTest
+{
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Basic();
+	static GPOS_RESULT EresUnittest_Ownership();
+	static GPOS_RESULT EresUnittest_Iterator();
+	static GPOS_RESULT EresUnittest_Delete();
+	static GPOS_RESULT EresUnittest_Benchmark();
+
+};	// class COpenHashMapTest
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashMapTest_H
+
+// EOF
@@ -0,0 +1,40 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashSetTest.h
+//
+//	@doc:
+//		Test for COpenHashSet
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashSetTest_H
+#define GPOS_COpenHashSetTest_H
+
+#include "gpos/base.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashSetTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+class COpenHashSetTest
+{
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Basic();
+	static GPOS_RESULT EresUnittest_Ownership();
+	static GPOS_RESULT EresUnittest_Iterator();
+
+};	// class COpenHashSetTest
+}  // namespace gpos
+
+#endif	// !GPOS_COpenHashSetTest_H
+
+// EOF
@@ -50,6 +50,13 @@ private:
 		//key equality function
 		static BOOL FMyEqual(ULONG *const &pvKey, ULONG *const &pvKeySecond);
 
+		// eviction predicate selecting objects with an even key
+		static BOOL
+		FEvenKey(ULONG *const &pvKey, SSimpleObject *const &, void *)
+		{
+			return 0 == *pvKey % 2;
+		}
+
 		// equality for object-based comparison
 		BOOL
 		operator==(const SSimpleObject &obj) const
@@ -157,6 +164,7 @@ public:
 	static GPOS_RESULT EresUnittest_DeepObject();
 	static GPOS_RESULT EresUnittest_Iteration();
 	static GPOS_RESULT EresUnittest_IterativeDeletion();
+	static GPOS_RESULT EresUnittest_SelectiveEviction();
 
 
 };	// class CCacheTest
@@ -45,7 +45,8 @@ public:
 	static GPOS_RESULT EresUnittest_Print();
 #endif	// GPOS_DEBUG
 	static GPOS_RESULT EresUnittest_TestTracker();
-	static GPOS_RESULT EresUnittest_TestSlab();
+	static GPOS_RESULT EresUnittest_TestArena();
+	static GPOS_RESULT EresUnittest_PeakSize();
 
 };	// class CMemoryPoolBasicTest
 }  // namespace gpos
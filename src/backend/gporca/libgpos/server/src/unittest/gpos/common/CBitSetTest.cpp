@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/string/CWStringDynamic.h"
@@ -35,6 +36,7 @@ CBitSetTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Basics),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Removal),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_SetOps),
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Growth),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Performance)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -221,6 +223,84 @@ CBitSetTest::EresUnittest_SetOps()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::EresUnittest_Growth
+//
+//	@doc:
+//		Sets growing beyond the inline words, and shrinking back
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBitSetTest::EresUnittest_Growth()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG vector_size = 256;
+	ULONG cInserts = 100;
+	ULONG ulStride = 37;
+
+	// insert in descending order, so that the set grows right away
+	CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, vector_size);
+	for (ULONG i = cInserts; i > 0; i--)
+	{
+		GPOS_UNITTEST_ASSERT(!pbs->ExchangeSet(i * ulStride));
+	}
+	GPOS_UNITTEST_ASSERT(cInserts == pbs->Size());
+
+	// insert in ascending order, growing one word at a time
+	CBitSet *pbsAsc = GPOS_NEW(mp) CBitSet(mp, vector_size);
+	for (ULONG i = 1; i <= cInserts; i++)
+	{
+		GPOS_UNITTEST_ASSERT(!pbsAsc->ExchangeSet(i * ulStride));
+	}
+	GPOS_UNITTEST_ASSERT(pbs->Equals(pbsAsc));
+	GPOS_UNITTEST_ASSERT(pbs->HashValue() == pbsAsc->HashValue());
+
+	// the iterator returns the elements in ascending order
+	CBitSetIter bsiter(*pbs);
+	for (ULONG i = 1; i <= cInserts; i++)
+	{
+		GPOS_UNITTEST_ASSERT(bsiter.Advance());
+		GPOS_UNITTEST_ASSERT(i * ulStride == bsiter.Bit());
+	}
+	GPOS_UNITTEST_ASSERT(!bsiter.Advance());
+
+	// a set within the inline words
+	CBitSet *pbsSmall = GPOS_NEW(mp) CBitSet(mp, vector_size);
+	for (ULONG i = 1; i * ulStride < 256; i++)
+	{
+		(void) pbsSmall->ExchangeSet(i * ulStride);
+	}
+	GPOS_UNITTEST_ASSERT(pbs->ContainsAll(pbsSmall));
+	GPOS_UNITTEST_ASSERT(!pbsSmall->ContainsAll(pbs));
+
+	// intersecting with the small set drops the high words
+	pbsAsc->Intersection(pbsSmall);
+	GPOS_UNITTEST_ASSERT(pbsAsc->Equals(pbsSmall));
+	GPOS_UNITTEST_ASSERT(pbsAsc->HashValue() == pbsSmall->HashValue());
+
+	// clearing the high bits one by one has the same effect
+	for (ULONG i = cInserts; i * ulStride >= 256; i--)
+	{
+		GPOS_UNITTEST_ASSERT(pbs->ExchangeClear(i * ulStride));
+	}
+	GPOS_UNITTEST_ASSERT(pbs->Equals(pbsSmall));
+
+	pbs->Difference(pbsSmall);
+	GPOS_UNITTEST_ASSERT(0 == pbs->Size());
+	GPOS_UNITTEST_ASSERT(pbs->IsDisjoint(pbsSmall));
+
+	pbsSmall->Release();
+	pbsAsc->Release();
+	pbs->Release();
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSetTest::EresUnittest_Performance
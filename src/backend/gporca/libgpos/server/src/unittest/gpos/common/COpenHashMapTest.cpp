@@ -0,0 +1,359 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashMapTest.cpp
+//
+//	@doc:
+//		Test for COpenHashMap
+//---------------------------------------------------------------------------
+
+#include "unittest/gpos/common/COpenHashMapTest.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/CHashMapIter.h"
+#include "gpos/common/COpenHashMap.h"
+#include "gpos/common/COpenHashMapIter.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+using namespace gpos;
+
+// number of keys in the benchmark
+#define GPOS_OPEN_HASH_BENCH_KEYS 20000
+
+// number of lookup rounds in the benchmark
+#define GPOS_OPEN_HASH_BENCH_ROUNDS 10
+
+namespace
+{
+using UlongToUlongOpenMap =
+	COpenHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+				 CleanupNULL<ULONG>, CleanupNULL<ULONG>>;
+
+using UlongToUlongOpenMapIter =
+	COpenHashMapIter<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+					 CleanupNULL<ULONG>, CleanupNULL<ULONG>>;
+
+using UlongToUlongChainedMap =
+	CHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+			 CleanupNULL<ULONG>, CleanupNULL<ULONG>>;
+
+using UlongToUlongChainedMapIter =
+	CHashMapIter<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+				 CleanupNULL<ULONG>, CleanupNULL<ULONG>>;
+
+// insert all keys, look every key and a missing key up repeatedly, then
+// iterate over the map; returns a checksum of the values found
+template <class TMap, class TMapIter>
+ULLONG
+UllRunBenchmark(CMemoryPool *mp, ULONG *keys, ULONG num_keys,
+				ULONG *elapsed_us)
+{
+	CWallClock clock;
+	ULLONG checksum = 0;
+
+	TMap *map = GPOS_NEW(mp) TMap(mp);
+	for (ULONG ul = 0; ul < num_keys; ul++)
+	{
+		(void) map->Insert(&keys[ul], &keys[ul]);
+	}
+
+	for (ULONG round = 0; round < GPOS_OPEN_HASH_BENCH_ROUNDS; round++)
+	{
+		for (ULONG ul = 0; ul < num_keys; ul++)
+		{
+			ULONG missing = keys[ul] + 1;
+			checksum += *map->Find(&keys[ul]);
+			checksum += (nullptr == map->Find(&missing)) ? 1 : 0;
+		}
+	}
+
+	TMapIter mi(map);
+	while (mi.Advance())
+	{
+		checksum += *mi.Value();
+	}
+
+	map->Release();
+	*elapsed_us = clock.ElapsedUS();
+
+	return checksum;
+}
+}  // namespace
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashMapTest::EresUnittest
+//
+//	@doc:
+//		Unittest for open-addressing hash map
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashMapTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(COpenHashMapTest::EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(COpenHashMapTest::EresUnittest_Ownership),
+		GPOS_UNITTEST_FUNC(COpenHashMapTest::EresUnittest_Iterator),
+		GPOS_UNITTEST_FUNC(COpenHashMapTest::EresUnittest_Delete),
+		GPOS_UNITTEST_FUNC(COpenHashMapTest::EresUnittest_Benchmark),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashMapTest::EresUnittest_Basic
+//
+//	@doc:
+//		Insertion/lookup/replacement, growing far beyond the size hint
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashMapTest::EresUnittest_Basic()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulCnt = 1000;
+	ULONG rgul[ulCnt];
+	ULONG rgulVal[ulCnt];
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		// keys that only differ in their high bits
+		rgul[i] = i << 20;
+		rgulVal[i] = i;
+	}
+
+	// start with a tiny index
+	UlongToUlongOpenMap *phm = GPOS_NEW(mp) UlongToUlongOpenMap(mp, 2);
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phm->Insert(&rgul[i], &rgulVal[i]);
+		GPOS_UNITTEST_ASSERT(fSuccess);
+		GPOS_UNITTEST_ASSERT(!phm->Insert(&rgul[i], &rgulVal[i]));
+	}
+	GPOS_UNITTEST_ASSERT(ulCnt == phm->Size());
+	GPOS_UNITTEST_ASSERT(ulCnt == phm->GetKeys()->Size());
+
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		GPOS_UNITTEST_ASSERT(&rgulVal[i] == phm->Find(&rgul[i]));
+
+		ULONG ulMissing = rgul[i] + 1;
+		GPOS_UNITTEST_ASSERT(nullptr == phm->Find(&ulMissing));
+	}
+
+	// test replacing entry values of existing keys
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY =
+			phm->Replace(&rgul[i], &rgulVal[ulCnt - i - 1]);
+		GPOS_UNITTEST_ASSERT(fSuccess);
+		GPOS_UNITTEST_ASSERT(&rgulVal[ulCnt - i - 1] == phm->Find(&rgul[i]));
+	}
+
+	// test replacing entry value of a non-existing key
+	ULONG ulMissing = 1;
+	GPOS_UNITTEST_ASSERT(!phm->Replace(&ulMissing, &rgulVal[0]));
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashMapTest::EresUnittest_Ownership
+//
+//	@doc:
+//		The map destroys its keys and values, including replaced values
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashMapTest::EresUnittest_Ownership()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	using UlongToUlongMap =
+		COpenHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+					 CleanupDelete<ULONG>, CleanupDelete<ULONG>>;
+
+	UlongToUlongMap *phm = GPOS_NEW(mp) UlongToUlongMap(mp);
+	for (ULONG i = 0; i < 256; ++i)
+	{
+		ULONG *pulKey = GPOS_NEW(mp) ULONG(i);
+		BOOL fSuccess GPOS_ASSERTS_ONLY =
+			phm->Insert(pulKey, GPOS_NEW(mp) ULONG(i));
+		GPOS_UNITTEST_ASSERT(fSuccess);
+
+		fSuccess = phm->Replace(pulKey, GPOS_NEW(mp) ULONG(i + 1));
+		GPOS_UNITTEST_ASSERT(fSuccess);
+		GPOS_UNITTEST_ASSERT(i + 1 == *phm->Find(pulKey));
+	}
+
+	// a leak would be reported by the memory pool
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashMapTest::EresUnittest_Iterator
+//
+//	@doc:
+//		Iteration follows insertion order
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashMapTest::EresUnittest_Iterator()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG rgul[] = {9, 3, 7, 1, 8, 2, 6, 4, 5};
+	const ULONG ulCnt = GPOS_ARRAY_SIZE(rgul);
+
+	UlongToUlongOpenMap *phm = GPOS_NEW(mp) UlongToUlongOpenMap(mp);
+
+	// iteration over empty map
+	{
+		UlongToUlongOpenMapIter mi(phm);
+		GPOS_UNITTEST_ASSERT(!mi.Advance());
+	}
+
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		(void) phm->Insert(&rgul[i], &rgul[i]);
+
+		UlongToUlongOpenMapIter mi(phm);
+		ULONG ulPos = 0;
+		while (mi.Advance())
+		{
+			GPOS_UNITTEST_ASSERT(&rgul[ulPos] == mi.Key());
+			GPOS_UNITTEST_ASSERT(&rgul[ulPos] == mi.Value());
+			ulPos++;
+		}
+		GPOS_UNITTEST_ASSERT(i + 1 == ulPos);
+	}
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashMapTest::EresUnittest_Delete
+//
+//	@doc:
+//		Deleting entries keeps the remaining entries reachable
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashMapTest::EresUnittest_Delete()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	using UlongToUlongMap =
+		COpenHashMap<ULONG, ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+					 CleanupDelete<ULONG>, CleanupDelete<ULONG>>;
+
+	const ULONG ulCnt = 500;
+	UlongToUlongMap *phm = GPOS_NEW(mp) UlongToUlongMap(mp, 16);
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		(void) phm->Insert(GPOS_NEW(mp) ULONG(i), GPOS_NEW(mp) ULONG(i));
+	}
+
+	// delete every third key
+	for (ULONG i = 0; i < ulCnt; i += 3)
+	{
+		GPOS_UNITTEST_ASSERT(phm->Delete(&i));
+		GPOS_UNITTEST_ASSERT(!phm->Delete(&i));
+	}
+	GPOS_UNITTEST_ASSERT(ulCnt - (ulCnt + 2) / 3 == phm->Size());
+
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		ULONG *pulVal = phm->Find(&i);
+		GPOS_UNITTEST_ASSERT((0 == i % 3) == (nullptr == pulVal));
+		GPOS_UNITTEST_ASSERT_IMP(nullptr != pulVal, i == *pulVal);
+	}
+
+	// deleted keys can be inserted again
+	for (ULONG i = 0; i < ulCnt; i += 3)
+	{
+		GPOS_UNITTEST_ASSERT(
+			phm->Insert(GPOS_NEW(mp) ULONG(i), GPOS_NEW(mp) ULONG(i)));
+	}
+	GPOS_UNITTEST_ASSERT(ulCnt == phm->Size());
+
+	phm->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashMapTest::EresUnittest_Benchmark
+//
+//	@doc:
+//		Micro benchmark against CHashMap with its default number of chains,
+//		for a map that grows far beyond that
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashMapTest::EresUnittest_Benchmark()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulCnt = GPOS_OPEN_HASH_BENCH_KEYS;
+	ULONG *rgul = GPOS_NEW_ARRAY(mp, ULONG, ulCnt);
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		// even keys, so that odd keys are missing
+		rgul[i] = 2 * i;
+	}
+
+	ULONG ulChainedUS = 0;
+	ULONG ulOpenUS = 0;
+	ULLONG ullChained =
+		UllRunBenchmark<UlongToUlongChainedMap, UlongToUlongChainedMapIter>(
+			mp, rgul, ulCnt, &ulChainedUS);
+	ULLONG ullOpen =
+		UllRunBenchmark<UlongToUlongOpenMap, UlongToUlongOpenMapIter>(
+			mp, rgul, ulCnt, &ulOpenUS);
+
+	GPOS_UNITTEST_ASSERT(ullChained == ullOpen);
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Hash map with " << ulCnt << " keys, "
+				<< GPOS_OPEN_HASH_BENCH_ROUNDS
+				<< " lookup rounds: CHashMap " << ulChainedUS
+				<< "us, COpenHashMap " << ulOpenUS << "us";
+	}
+
+	GPOS_DELETE_ARRAY(rgul);
+
+	return GPOS_OK;
+}
+
+// EOF
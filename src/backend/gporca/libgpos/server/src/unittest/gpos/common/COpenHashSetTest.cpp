@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashSetTest.cpp
+//
+//	@doc:
+//		Test for COpenHashSet
+//---------------------------------------------------------------------------
+
+#include "unittest/gpos/common/COpenHashSetTest.h"
+
+#include "gpos/base.h"
+#include "gpos/common/COpenHashSet.h"
+#include "gpos/common/COpenHashSetIter.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashSetTest::EresUnittest
+//
+//	@doc:
+//		Unittest for open-addressing hash set
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashSetTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(COpenHashSetTest::EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(COpenHashSetTest::EresUnittest_Ownership),
+		GPOS_UNITTEST_FUNC(COpenHashSetTest::EresUnittest_Iterator),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashSetTest::EresUnittest_Basic
+//
+//	@doc:
+//		Basic insertion/lookup, growing far beyond the size hint
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashSetTest::EresUnittest_Basic()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	using UlongHashSet = COpenHashSet<ULONG, HashValue<ULONG>,
+									  gpos::Equals<ULONG>, CleanupNULL<ULONG>>;
+
+	const ULONG ulCnt = 1000;
+	ULONG rgul[ulCnt];
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		rgul[i] = i * 3;
+	}
+
+	UlongHashSet *phs = GPOS_NEW(mp) UlongHashSet(mp, 1);
+	GPOS_UNITTEST_ASSERT(nullptr == phs->First());
+
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phs->Insert(&rgul[i]);
+		GPOS_UNITTEST_ASSERT(fSuccess);
+		GPOS_UNITTEST_ASSERT(!phs->Insert(&rgul[i]));
+	}
+	GPOS_UNITTEST_ASSERT(ulCnt == phs->Size());
+	GPOS_UNITTEST_ASSERT(&rgul[0] == phs->First());
+
+	for (ULONG i = 0; i < 3 * ulCnt; ++i)
+	{
+		GPOS_UNITTEST_ASSERT((0 == i % 3) == phs->Contains(&i));
+	}
+
+	phs->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashSetTest::EresUnittest_Ownership
+//
+//	@doc:
+//		The set destroys its elements
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashSetTest::EresUnittest_Ownership()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	using UlongHashSet = COpenHashSet<ULONG, HashValue<ULONG>,
+									  gpos::Equals<ULONG>, CleanupDelete<ULONG>>;
+
+	UlongHashSet *phs = GPOS_NEW(mp) UlongHashSet(mp, 32);
+	for (ULONG i = 0; i < 256; ++i)
+	{
+		ULONG *pul = GPOS_NEW(mp) ULONG(i);
+		BOOL fSuccess GPOS_ASSERTS_ONLY = phs->Insert(pul);
+		GPOS_UNITTEST_ASSERT(fSuccess);
+		GPOS_UNITTEST_ASSERT(phs->Contains(pul));
+	}
+
+	phs->Release();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COpenHashSetTest::EresUnittest_Iterator
+//
+//	@doc:
+//		Iteration follows insertion order
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+COpenHashSetTest::EresUnittest_Iterator()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	using UlongHashSet = COpenHashSet<ULONG, HashValue<ULONG>,
+									  gpos::Equals<ULONG>, CleanupNULL<ULONG>>;
+	using UlongHashSetIter =
+		COpenHashSetIter<ULONG, HashValue<ULONG>, gpos::Equals<ULONG>,
+						 CleanupNULL<ULONG>>;
+
+	ULONG rgul[] = {9, 3, 7, 1, 8, 2, 6, 4, 5};
+	const ULONG ulCnt = GPOS_ARRAY_SIZE(rgul);
+
+	UlongHashSet *phs = GPOS_NEW(mp) UlongHashSet(mp);
+
+	// iteration over empty set
+	{
+		UlongHashSetIter si(phs);
+		GPOS_UNITTEST_ASSERT(!si.Advance());
+	}
+
+	for (ULONG i = 0; i < ulCnt; ++i)
+	{
+		(void) phs->Insert(&rgul[i]);
+
+		UlongHashSetIter si(phs);
+		ULONG ulPos = 0;
+		while (si.Advance())
+		{
+			GPOS_UNITTEST_ASSERT(&rgul[ulPos] == si.Get());
+			ulPos++;
+		}
+		GPOS_UNITTEST_ASSERT(i + 1 == ulPos);
+	}
+
+	phs->Release();
+
+	return GPOS_OK;
+}
+
+// EOF
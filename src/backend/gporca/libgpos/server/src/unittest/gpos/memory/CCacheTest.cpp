@@ -47,7 +47,8 @@ CCacheTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Eviction),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Iteration),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_DeepObject),
-		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion)};
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion),
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_SelectiveEviction)};
 
 	fUnique = true;
 	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -974,4 +975,64 @@ CCacheTest::EresUnittest_IterativeDeletion()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::EresUnittest_SelectiveEviction
+//
+//	@doc:
+//		Evict the entries selected by a predicate; a pinned entry is only
+//		removed once it is released
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCacheTest::EresUnittest_SelectiveEviction()
+{
+	CAutoP<CCache<SSimpleObject *, ULONG *> > apcache;
+	apcache = CCacheFactory::CreateCache<SSimpleObject *, ULONG *>(
+		fUnique, UNLIMITED_CACHE_QUOTA, SSimpleObject::UlMyHash,
+		SSimpleObject::FMyEqual);
+
+	CCache<SSimpleObject *, ULONG *> *pcache = apcache.Value();
+
+	for (ULONG ul = 0; ul < GPOS_CACHE_ELEMENTS; ul++)
+	{
+		InsertOneElement(pcache, ul);
+	}
+	ULLONG ullSizeBefore = pcache->TotalAllocatedSize();
+
+	// scope for the accessor pinning an entry selected for eviction
+	{
+		CSimpleObjectCacheAccessor ca(pcache);
+		ULONG ulPinned = 0;
+		ca.Lookup(&ulPinned);
+		GPOS_UNITTEST_ASSERT(nullptr != ca.Val());
+		ca.Val()->Release();
+
+		ULONG ulEvicted =
+			pcache->EvictEntries(SSimpleObject::FEvenKey, nullptr /*context*/);
+		GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 == ulEvicted);
+
+		// pinned entry stays in the hash table until released
+		GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 + 1 == pcache->Size());
+	}
+
+	GPOS_UNITTEST_ASSERT(GPOS_CACHE_ELEMENTS / 2 == pcache->Size());
+	GPOS_UNITTEST_ASSERT(pcache->TotalAllocatedSize() < ullSizeBefore);
+
+	for (ULONG ul = 0; ul < GPOS_CACHE_ELEMENTS; ul++)
+	{
+		CSimpleObjectCacheAccessor ca(pcache);
+		ca.Lookup(&ul);
+		SSimpleObject *pso = ca.Val();
+		if (nullptr != pso)
+		{
+			pso->Release();
+		}
+
+		GPOS_UNITTEST_ASSERT((0 == ul % 2) == (nullptr == pso));
+	}
+
+	return GPOS_OK;
+}
+
 // EOF
@@ -45,7 +45,9 @@ CMemoryPoolBasicTest::EresUnittest()
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_Print),
 #endif	// GPOS_DEBUG
-		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker)};
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestTracker),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_TestArena),
+		GPOS_UNITTEST_FUNC(CMemoryPoolBasicTest::EresUnittest_PeakSize)};
 
 	CAutoTraceFlag atf(EtraceTestMemoryPools, true /*value*/);
 
@@ -97,6 +99,96 @@ CMemoryPoolBasicTest::EresUnittest_TestTracker()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_TestArena
+//
+//	@doc:
+//		Run tests for arena pool; mixes small allocations served from shared
+//		chunks with large ones that get dedicated chunks
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_TestArena()
+{
+	CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, CMemoryPool::EasArena);
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG ulAllocs = 1024;
+	ULONG *rgrgul[ulAllocs];
+	ULLONG ullUserBytes = 0;
+
+	for (ULONG i = 0; i < ulAllocs; i++)
+	{
+		// every 64th allocation exceeds the size of the first chunk
+		const ULONG ulElems =
+			(0 == i % 64) ? 32 * 1024 : Size(i) / GPOS_SIZEOF(ULONG);
+
+		rgrgul[i] = GPOS_NEW_ARRAY(mp, ULONG, ulElems);
+		ullUserBytes += ulElems * GPOS_SIZEOF(ULONG);
+
+		rgrgul[i][0] = i;
+		rgrgul[i][ulElems - 1] = i;
+	}
+
+	for (ULONG i = 0; i < ulAllocs; i++)
+	{
+		const ULONG ulElems =
+			CMemoryPool::UserSizeOfAlloc(rgrgul[i]) / GPOS_SIZEOF(ULONG);
+
+		GPOS_RTL_ASSERT(0 == i % 64 ? 32 * 1024 == ulElems
+									: Size(i) / GPOS_SIZEOF(ULONG) == ulElems);
+		GPOS_RTL_ASSERT(i == rgrgul[i][0] && i == rgrgul[i][ulElems - 1]);
+
+		// memory is not reclaimed, but freeing must be safe
+		if (0 == i % 2)
+		{
+			GPOS_DELETE_ARRAY(rgrgul[i]);
+		}
+	}
+
+	// remaining allocations are released together with the pool
+	GPOS_RTL_ASSERT(ullUserBytes <= mp->TotalAllocatedSize());
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolBasicTest::EresUnittest_PeakSize
+//
+//	@doc:
+//		The peak size of a tracker pool survives freeing its allocations
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolBasicTest::EresUnittest_PeakSize()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULLONG ullInitial = mp->TotalAllocatedSize();
+
+	BYTE *rgbFst = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_LARGE);
+	BYTE *rgbSnd = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_LARGE);
+	const ULLONG ullPeak = mp->TotalAllocatedSize();
+	GPOS_RTL_ASSERT(ullPeak == mp->PeakAllocatedSize());
+
+	GPOS_DELETE_ARRAY(rgbFst);
+	GPOS_DELETE_ARRAY(rgbSnd);
+	GPOS_RTL_ASSERT(ullInitial == mp->TotalAllocatedSize());
+	GPOS_RTL_ASSERT(ullPeak == mp->PeakAllocatedSize());
+
+	// a smaller allocation leaves the peak unchanged
+	BYTE *rgb = GPOS_NEW_ARRAY(mp, BYTE, GPOS_MEM_TEST_ALLOC_SMALL);
+	GPOS_RTL_ASSERT(ullPeak == mp->PeakAllocatedSize());
+	GPOS_DELETE_ARRAY(rgb);
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemoryPoolBasicTest::EresTestType
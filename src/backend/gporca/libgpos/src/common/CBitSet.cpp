@@ -7,16 +7,13 @@
 //
 //	@doc:
 //		Implementation of bit sets
-//
-//		Underlying assumption: a set contains only a few links of bitvectors
-//		hence, keeping them in a linked list is efficient;
 //---------------------------------------------------------------------------
 
 #include "gpos/common/CBitSet.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 #include "gpos/common/CBitSetIter.h"
+#include "gpos/common/clibwrapper.h"
 
 #ifdef GPOS_DEBUG
 #include "gpos/error/CAutoTrace.h"
@@ -28,160 +25,77 @@ FORCE_GENERATE_DBGSTR(CBitSet);
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSetLink
-//
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, ULONG offset,
-								  ULONG vector_size)
-	: m_offset(offset)
-{
-	m_vec = GPOS_NEW(mp) CBitVector(mp, vector_size);
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSetLink
+//		CBitSet::EnsureCapacity
 //
 //	@doc:
-//		copy ctor
+//		Grow the word array to hold at least the given number of words;
+//		the capacity at least doubles so repeated growth stays cheap
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, const CBitSetLink &bsl)
-	: m_offset(bsl.m_offset)
-{
-	m_vec = GPOS_NEW(mp) CBitVector(mp, *bsl.GetVec());
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		~CBitSetLink
-//
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::~CBitSetLink()
-{
-	GPOS_DELETE(m_vec);
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::FindLinkByOffset
-//
-//	@doc:
-//		Find bit set link for a given offset; if non-existent return previous
-//		link (may be NULL);
-//		By providing a starting link we can implement a number of operations
-//		in one sweep, ie O(N)
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink *
-CBitSet::FindLinkByOffset(ULONG offset, CBitSetLink *bsl) const
+void
+CBitSet::EnsureCapacity(ULONG len)
 {
-	CBitSetLink *found = nullptr;
-	CBitSetLink *cursor = bsl;
-
-	if (nullptr == bsl)
+	if (len <= m_capacity)
 	{
-		// if no cursor provided start with first element
-		cursor = m_bsllist.First();
-	}
-	else
-	{
-		GPOS_ASSERT(bsl->GetOffset() <= offset && "invalid start cursor");
-		found = bsl;
+		return;
 	}
 
-	GPOS_ASSERT_IMP(nullptr != cursor,
-					GPOS_OK == m_bsllist.Find(cursor) && "cursor not in list");
+	ULONG capacity = std::max(len, 2 * m_capacity);
+	ULLONG *vec = GPOS_NEW_ARRAY(m_mp, ULLONG, capacity);
 
-	while (true)
+	if (0 < m_len)
 	{
-		// no more links or we've overshot the target
-		if (nullptr == cursor || cursor->GetOffset() > offset)
-		{
-			break;
-		}
+		clib::Memcpy(vec, m_vec, m_len * GPOS_SIZEOF(ULLONG));
+	}
+	clib::Memset(vec + m_len, 0, (capacity - m_len) * GPOS_SIZEOF(ULLONG));
 
-		found = cursor;
-		cursor = m_bsllist.Next(cursor);
+	if (m_vec != m_inline_vec)
+	{
+		GPOS_DELETE_ARRAY(m_vec);
 	}
 
-	GPOS_ASSERT_IMP(found, found->GetOffset() <= offset);
-	return found;
+	m_vec = vec;
+	m_capacity = capacity;
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::RecomputeSize
+//		CBitSet::Trim
 //
 //	@doc:
-//		Compute size of set by adding up sizes of links
+//		Drop trailing zero words, so that equal sets have equal lengths
 //
 //---------------------------------------------------------------------------
 void
-CBitSet::RecomputeSize()
+CBitSet::Trim()
 {
-	m_size = 0;
-	CBitSetLink *bsl = nullptr;
-
-	for (bsl = m_bsllist.First(); bsl != nullptr; bsl = m_bsllist.Next(bsl))
+	while (0 < m_len && 0 == m_vec[m_len - 1])
 	{
-		m_size += bsl->GetVec()->CountSetBits();
+		m_len--;
 	}
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::Clear
+//		CBitSet::RecomputeSize
 //
 //	@doc:
-//		release all links
+//		Compute size of set by counting the bits of all words
 //
 //---------------------------------------------------------------------------
 void
-CBitSet::Clear()
+CBitSet::RecomputeSize()
 {
-	CBitSetLink *bsl = nullptr;
-
-	while (nullptr != (bsl = m_bsllist.First()))
+	m_size = 0;
+	for (ULONG ul = 0; ul < m_len; ul++)
 	{
-		CBitSetLink *bsl_to_remove = bsl;
-		bsl = m_bsllist.Next(bsl);
-
-		m_bsllist.Remove(bsl_to_remove);
-		GPOS_DELETE(bsl_to_remove);
+		m_size += PopCount(m_vec[ul]);
 	}
-
-	RecomputeSize();
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::GetOffset
-//
-//	@doc:
-//		Compute offset
-//
-//---------------------------------------------------------------------------
-ULONG
-CBitSet::ComputeOffset(ULONG ul) const
-{
-	return (ul / m_vector_size) * m_vector_size;
 }
 
 
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSet::CBitSet
@@ -191,9 +105,16 @@ CBitSet::ComputeOffset(ULONG ul) const
 //
 //---------------------------------------------------------------------------
 CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
-	: m_mp(mp), m_vector_size(vector_size), m_size(0)
+	: m_mp(mp),
+	  m_vector_size(vector_size),
+	  m_size(0),
+	  m_len(0),
+	  m_capacity(GPOS_BITSET_INLINE_WORDS),
+	  m_vec(m_inline_vec)
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+	GPOS_ASSERT(0 < vector_size);
+
+	clib::Memset(m_inline_vec, 0, GPOS_SIZEOF(m_inline_vec));
 }
 
 
@@ -206,10 +127,21 @@ CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
 //
 //---------------------------------------------------------------------------
 CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
-	: m_mp(mp), m_vector_size(bs.m_vector_size), m_size(0)
+	: m_mp(mp),
+	  m_vector_size(bs.m_vector_size),
+	  m_size(bs.m_size),
+	  m_len(0),
+	  m_capacity(GPOS_BITSET_INLINE_WORDS),
+	  m_vec(m_inline_vec)
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
-	Union(&bs);
+	clib::Memset(m_inline_vec, 0, GPOS_SIZEOF(m_inline_vec));
+
+	if (0 < bs.m_len)
+	{
+		EnsureCapacity(bs.m_len);
+		clib::Memcpy(m_vec, bs.m_vec, bs.m_len * GPOS_SIZEOF(ULLONG));
+		m_len = bs.m_len;
+	}
 }
 
 
@@ -223,30 +155,10 @@ CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
 //---------------------------------------------------------------------------
 CBitSet::~CBitSet()
 {
-	Clear();
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::Get
-//
-//	@doc:
-//		Check if given bit is set
-//
-//---------------------------------------------------------------------------
-BOOL
-CBitSet::Get(ULONG pos) const
-{
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr != bsl && bsl->GetOffset() == offset)
+	if (m_vec != m_inline_vec)
 	{
-		return bsl->GetVec()->Get(pos - offset);
+		GPOS_DELETE_ARRAY(m_vec);
 	}
-
-	return false;
 }
 
 
@@ -255,37 +167,26 @@ CBitSet::Get(ULONG pos) const
 //		CBitSet::ExchangeSet
 //
 //	@doc:
-//		Set given bit; return previous value; allocate new link if necessary
+//		Set given bit; return previous value; grow the array if necessary
 //
 //---------------------------------------------------------------------------
 BOOL
 CBitSet::ExchangeSet(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
+	const ULONG idx = pos / 64;
+	const ULLONG mask = ((ULLONG) 1) << (pos % 64);
 
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr == bsl || bsl->GetOffset() != offset)
+	if (idx >= m_len)
 	{
-		CBitSetLink *pbsl_new =
-			GPOS_NEW(m_mp) CBitSetLink(m_mp, offset, m_vector_size);
-		if (nullptr == bsl)
-		{
-			m_bsllist.Prepend(pbsl_new);
-		}
-		else
-		{
-			// insert after found link
-			m_bsllist.Append(pbsl_new, bsl);
-		}
-
-		bsl = pbsl_new;
+		// words between the old and the new length are already zero
+		EnsureCapacity(idx + 1);
+		m_len = idx + 1;
 	}
 
-	GPOS_ASSERT(bsl->GetOffset() == offset);
-
-	BOOL bit = bsl->GetVec()->ExchangeSet(pos - offset);
+	BOOL bit = (0 != (m_vec[idx] & mask));
 	if (!bit)
 	{
+		m_vec[idx] |= mask;
 		m_size++;
 	}
 
@@ -304,29 +205,16 @@ CBitSet::ExchangeSet(ULONG pos)
 BOOL
 CBitSet::ExchangeClear(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (nullptr != bsl && bsl->GetOffset() == offset)
+	if (!Get(pos))
 	{
-		BOOL bit = bsl->GetVec()->ExchangeClear(pos - offset);
-
-		// remove empty link
-		if (bsl->GetVec()->IsEmpty())
-		{
-			m_bsllist.Remove(bsl);
-			GPOS_DELETE(bsl);
-		}
-
-		if (bit)
-		{
-			m_size--;
-		}
-
-		return bit;
+		return false;
 	}
 
-	return false;
+	m_vec[pos / 64] &= ~(((ULLONG) 1) << (pos % 64));
+	m_size--;
+	Trim();
+
+	return true;
 }
 
 
@@ -335,76 +223,23 @@ CBitSet::ExchangeClear(ULONG pos)
 //		CBitSet::Union
 //
 //	@doc:
-//		Union with given other set;
-//		(1) determine which links need to be allocated before(!) modifying
-//			the set allocate and copy missing links aside
-//		(2) insert the new links into the list
-//		(3) union all links, old and new, on a per-bitvector basis
-//
-//		For clarity step (2) and (3) are separated;
+//		Union with given other set
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Union(const CBitSet *pbsOther)
 {
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// dynamic array of CBitSetLink
-	using CBitSetLinkArray = CDynamicPtrArray<CBitSetLink, CleanupNULL>;
-
-	CAutoRef<CBitSetLinkArray> a_drgpbsl;
-	a_drgpbsl = GPOS_NEW(m_mp) CBitSetLinkArray(m_mp);
-
-	// iterate through other's links and copy missing links to array
-	for (bsl_other = pbsOther->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = pbsOther->m_bsllist.Next(bsl_other))
-	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-		if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset())
-		{
-			// need to copy this link
-			CAutoP<CBitSetLink> a_pbsl;
-			a_pbsl = GPOS_NEW(m_mp) CBitSetLink(m_mp, *bsl_other);
-			a_drgpbsl->Append(a_pbsl.Value());
-
-			a_pbsl.Reset();
-		}
-	}
+	const ULONG len = pbsOther->m_len;
+	EnsureCapacity(len);
 
-	// insert all new links
-	bsl = nullptr;
-	for (ULONG i = 0; i < a_drgpbsl->Size(); i++)
+	ULLONG *vec = m_vec;
+	const ULLONG *vec_other = pbsOther->m_vec;
+	for (ULONG ul = 0; ul < len; ul++)
 	{
-		CBitSetLink *pbslInsert = (*a_drgpbsl)[i];
-		bsl = FindLinkByOffset(pbslInsert->GetOffset(), bsl);
-
-		GPOS_ASSERT_IMP(nullptr != bsl,
-						bsl->GetOffset() < pbslInsert->GetOffset());
-		if (nullptr == bsl)
-		{
-			m_bsllist.Prepend(pbslInsert);
-		}
-		else
-		{
-			m_bsllist.Append(pbslInsert, bsl);
-		}
-	}
-
-	// iterate through all links and union them up
-	bsl_other = nullptr;
-	bsl = m_bsllist.First();
-	while (nullptr != bsl)
-	{
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->Or(bsl_other->GetVec());
-		}
-
-		bsl = m_bsllist.Next(bsl);
+		vec[ul] |= vec_other[ul];
 	}
 
+	m_len = std::max(m_len, len);
 	RecomputeSize();
 }
 
@@ -414,7 +249,8 @@ CBitSet::Union(const CBitSet *pbsOther)
 //		CBitSet::Intersection
 //
 //	@doc:
-//		Iterate through all links and intersect them; release unused links
+//		Intersect with given other set; words beyond the other set's length
+//		become zero
 //
 //---------------------------------------------------------------------------
 void
@@ -425,39 +261,21 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 		return;
 	}
 
-	CBitSetLink *bsl_other = nullptr;
-	CBitSetLink *bsl = m_bsllist.First();
+	const ULONG len = std::min(m_len, pbsOther->m_len);
 
-	while (nullptr != bsl)
+	ULLONG *vec = m_vec;
+	const ULLONG *vec_other = pbsOther->m_vec;
+	for (ULONG ul = 0; ul < len; ul++)
 	{
-		CBitSetLink *bsl_to_remove = nullptr;
-
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->And(bsl_other->GetVec());
-			CBitSetLink *bsl_prev = bsl;
-
-			bsl = m_bsllist.Next(bsl);
-			// If vector is empty after "ANDing", remove the vector, otherwise
-			// we can get into a situation where an empty vector exists
-			// and causes wrong results for equals/contains operations later
-			if (bsl_prev->GetVec()->IsEmpty())
-			{
-				m_bsllist.Remove(bsl_prev);
-				GPOS_DELETE(bsl_prev);
-			}
-		}
-		else
-		{
-			bsl_to_remove = bsl;
-			bsl = m_bsllist.Next(bsl);
-
-			m_bsllist.Remove(bsl_to_remove);
-			GPOS_DELETE(bsl_to_remove);
-		}
+		vec[ul] &= vec_other[ul];
+	}
+	for (ULONG ul = len; ul < m_len; ul++)
+	{
+		vec[ul] = 0;
 	}
 
+	m_len = len;
+	Trim();
 	RecomputeSize();
 }
 
@@ -467,23 +285,23 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 //		CBitSet::Difference
 //
 //	@doc:
-//		Substract other set from this by iterating through other set and
-//		explicit removal of elements;
+//		Substract other set from this
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Difference(const CBitSet *pbs)
 {
-	if (IsDisjoint(pbs))
-	{
-		return;
-	}
+	const ULONG len = std::min(m_len, pbs->m_len);
 
-	CBitSetIter bsiter(*pbs);
-	while (bsiter.Advance())
+	ULLONG *vec = m_vec;
+	const ULLONG *vec_other = pbs->m_vec;
+	for (ULONG ul = 0; ul < len; ul++)
 	{
-		(void) ExchangeClear(bsiter.Bit());
+		vec[ul] &= ~vec_other[ul];
 	}
+
+	Trim();
+	RecomputeSize();
 }
 
 
@@ -499,28 +317,20 @@ BOOL
 CBitSet::ContainsAll(const CBitSet *bs) const
 {
 	// skip iterating if we can already tell by the sizes
-	if (Size() < bs->Size())
+	if (Size() < bs->Size() || m_len < bs->m_len)
 	{
 		return false;
 	}
 
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
-
-	// iterate through other's links and check for subsets
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	const ULLONG *vec = m_vec;
+	const ULLONG *vec_other = bs->m_vec;
+	ULLONG missing = 0;
+	for (ULONG ul = 0; ul < bs->m_len; ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-
-		if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->ContainsAll(bsl_other->GetVec()))
-		{
-			return false;
-		}
+		missing |= vec_other[ul] & ~vec[ul];
 	}
 
-	return true;
+	return 0 == missing;
 }
 
 
@@ -541,30 +351,21 @@ CBitSet::Equals(const CBitSet *bs) const
 		return true;
 	}
 
-	// skip iterating if we can already tell by the sizes
-	if (Size() != bs->Size())
+	// skip comparing words if we can already tell by the sizes
+	if (Size() != bs->Size() || m_len != bs->m_len)
 	{
 		return false;
 	}
 
-	CBitSetLink *bsl = m_bsllist.First();
-	CBitSetLink *bsl_other = bs->m_bsllist.First();
-
-	while (nullptr != bsl)
+	for (ULONG ul = 0; ul < m_len; ul++)
 	{
-		if (nullptr == bsl_other ||
-			bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->Equals(bsl_other->GetVec()))
+		if (m_vec[ul] != bs->m_vec[ul])
 		{
 			return false;
 		}
-
-		bsl = m_bsllist.Next(bsl);
-		bsl_other = bs->m_bsllist.Next(bsl_other);
 	}
 
-	// same length implies bsl_other must have reached end as well
-	return bsl_other == nullptr;
+	return true;
 }
 
 
@@ -580,23 +381,71 @@ CBitSet::Equals(const CBitSet *bs) const
 BOOL
 CBitSet::IsDisjoint(const CBitSet *bs) const
 {
-	CBitSetLink *bsl = nullptr;
-	CBitSetLink *bsl_other = nullptr;
+	const ULONG len = std::min(m_len, bs->m_len);
+
+	const ULLONG *vec = m_vec;
+	const ULLONG *vec_other = bs->m_vec;
+	ULLONG common = 0;
+	for (ULONG ul = 0; ul < len; ul++)
+	{
+		common |= vec[ul] & vec_other[ul];
+	}
+
+	return 0 == common;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSet::HashChunk
+//
+//	@doc:
+//		Hash the m_vector_size bits starting at the given offset as if they
+//		were stored in a separate vector of 64-bit words, which is how the
+//		bitset used to be stored; returns false for an empty chunk
+//
+//---------------------------------------------------------------------------
+BOOL
+CBitSet::HashChunk(ULONG offset, ULONG *chunk_hash) const
+{
+	const ULONG num_words = (m_vector_size + 63) / 64;
+	const ULONG size = num_words * GPOS_SIZEOF(ULLONG);
 
-	// iterate through other's links an check if disjoint
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	BOOL empty = true;
+	ULONG hash = size;
+	for (ULONG ul = 0; ul < num_words; ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
+		// gather the next 64 bits of the chunk
+		const ULONG pos = offset + ul * 64;
+		const ULONG idx = pos / 64;
+		const ULONG shift = pos % 64;
 
-		if (nullptr != bsl && bsl->GetOffset() == bsl_other->GetOffset() &&
-			!bsl->GetVec()->IsDisjoint(bsl_other->GetVec()))
+		ULLONG word = 0;
+		if (idx < m_len)
 		{
-			return false;
+			word = m_vec[idx] >> shift;
+		}
+		if (0 != shift && idx + 1 < m_len)
+		{
+			word |= m_vec[idx + 1] << (64 - shift);
+		}
+		if (ul == num_words - 1 && 0 != m_vector_size % 64)
+		{
+			word &= (((ULLONG) 1) << (m_vector_size % 64)) - 1;
+		}
+
+		empty = empty && (0 == word);
+
+		// same as gpos::HashByteArray over the bytes of the word
+		const BYTE *bytes = (const BYTE *) &word;
+		for (ULONG i = 0; i < GPOS_SIZEOF(ULLONG); i++)
+		{
+			hash = ((hash << 5) ^ (hash >> 27)) ^ bytes[i];
 		}
 	}
 
-	return true;
+	*chunk_hash = hash;
+	return !empty;
 }
 
 
@@ -605,7 +454,8 @@ CBitSet::IsDisjoint(const CBitSet *bs) const
 //		CBitSet::HashValue
 //
 //	@doc:
-//		Compute hash value for set
+//		Compute hash value for set by combining the hash values of its
+//		non-empty chunks
 //
 //---------------------------------------------------------------------------
 ULONG
@@ -613,11 +463,14 @@ CBitSet::HashValue() const
 {
 	ULONG ulHash = 0;
 
-	CBitSetLink *bsl = m_bsllist.First();
-	while (nullptr != bsl)
+	const ULONG num_bits = m_len * 64;
+	for (ULONG offset = 0; offset < num_bits; offset += m_vector_size)
 	{
-		ulHash = gpos::CombineHashes(ulHash, bsl->GetVec()->HashValue());
-		bsl = m_bsllist.Next(bsl);
+		ULONG ulChunkHash = 0;
+		if (HashChunk(offset, &ulChunkHash))
+		{
+			ulHash = gpos::CombineHashes(ulHash, ulChunkHash);
+		}
 	}
 
 	return ulHash;
@@ -12,7 +12,6 @@
 #include "gpos/common/CBitSetIter.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 
 using namespace gpos;
 
@@ -26,7 +25,7 @@ using namespace gpos;
 //
 //---------------------------------------------------------------------------
 CBitSetIter::CBitSetIter(const CBitSet &bs)
-	: m_bs(bs), m_cursor((ULONG) -1), m_bsl(nullptr), m_active(true)
+	: m_bs(bs), m_cursor((ULONG) -1), m_active(true)
 {
 }
 
@@ -44,24 +43,27 @@ CBitSetIter::Advance()
 {
 	GPOS_ASSERT(m_active && "called advance on exhausted iterator");
 
-	if (nullptr == m_bsl)
+	// look for the next set bit, starting with the word of the position
+	// after the cursor and masking out the bits before it
+	const ULONG pos = m_cursor + 1;
+	ULONG idx = pos / 64;
+	ULLONG word = 0;
+	if (idx < m_bs.m_len)
 	{
-		m_bsl = m_bs.m_bsllist.First();
+		word = m_bs.m_vec[idx] & (~((ULLONG) 0) << (pos % 64));
 	}
 
-	while (nullptr != m_bsl)
+	while (0 == word && ++idx < m_bs.m_len)
 	{
-		if (m_cursor + 1 <= m_bs.m_vector_size &&
-			m_bsl->GetVec()->GetNextSetBit(m_cursor + 1, m_cursor))
-		{
-			break;
-		}
+		word = m_bs.m_vec[idx];
+	}
 
-		m_bsl = m_bs.m_bsllist.Next(m_bsl);
-		m_cursor = (ULONG) -1;
+	if (0 != word)
+	{
+		m_cursor = idx * 64 + CBitSet::LowestSetBit(word);
 	}
 
-	m_active = (nullptr != m_bsl);
+	m_active = (0 != word);
 	return m_active;
 }
 
@@ -77,10 +79,10 @@ CBitSetIter::Advance()
 ULONG
 CBitSetIter::Bit() const
 {
-	GPOS_ASSERT(m_active && nullptr != m_bsl && "iterator uninitialized");
-	GPOS_ASSERT(m_bsl->GetVec()->Get(m_cursor));
+	GPOS_ASSERT(m_active && (ULONG) -1 != m_cursor && "iterator uninitialized");
+	GPOS_ASSERT(m_bs.Get(m_cursor));
 
-	return m_bsl->GetOffset() + m_cursor;
+	return m_cursor;
 }
 
 // EOF
@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		COpenHashTable.cpp
+//
+//	@doc:
+//		Implementation of the open-addressing hash index
+//---------------------------------------------------------------------------
+
+#include "gpos/common/COpenHashTable.h"
+
+#include "gpos/base.h"
+
+using namespace gpos;
+
+// ctor
+COpenHashTable::COpenHashTable(CMemoryPool *mp, ULONG size_hint)
+	: m_mp(mp), m_init_slots(GPOS_OPEN_HASH_MIN_SLOTS)
+{
+	GPOS_ASSERT(nullptr != mp);
+
+	while (m_init_slots < size_hint &&
+		   m_init_slots < GPOS_OPEN_HASH_MAX_INIT_SLOTS)
+	{
+		m_init_slots *= 2;
+	}
+}
+
+
+// dtor
+COpenHashTable::~COpenHashTable()
+{
+	GPOS_DELETE_ARRAY(m_slots);
+}
+
+
+// slot holding the given position
+ULONG
+COpenHashTable::FindSlot(ULONG hash, ULONG pos) const
+{
+	GPOS_ASSERT(0 < m_size);
+
+	const ULONG mask = m_num_slots - 1;
+	ULONG slot = Home(hash);
+	while (m_slots[slot].m_pos != pos)
+	{
+		GPOS_ASSERT(gpos::ulong_max != m_slots[slot].m_pos);
+		slot = (slot + 1) & mask;
+	}
+
+	return slot;
+}
+
+
+// place an entry, assuming there is a free slot; an entry that is further
+// away from its home slot takes the slot of an entry that is closer to home
+void
+COpenHashTable::InsertSlot(ULONG hash, ULONG pos)
+{
+	const ULONG mask = m_num_slots - 1;
+	SSlot entry;
+	entry.m_hash = hash;
+	entry.m_pos = pos;
+
+	ULONG slot = Home(hash);
+	for (ULONG dist = 0;; dist++, slot = (slot + 1) & mask)
+	{
+		if (gpos::ulong_max == m_slots[slot].m_pos)
+		{
+			m_slots[slot] = entry;
+			m_size++;
+			return;
+		}
+
+		ULONG slot_dist = Distance(slot);
+		if (slot_dist < dist)
+		{
+			std::swap(entry, m_slots[slot]);
+			dist = slot_dist;
+		}
+	}
+}
+
+
+// double the number of slots and re-place all entries
+void
+COpenHashTable::Grow()
+{
+	SSlot *old_slots = m_slots;
+	ULONG old_num_slots = m_num_slots;
+
+	m_num_slots = (0 == old_num_slots) ? m_init_slots : old_num_slots * 2;
+	m_slots = GPOS_NEW_ARRAY(m_mp, SSlot, m_num_slots);
+	m_size = 0;
+
+	m_shift = 32;
+	for (ULONG ul = m_num_slots; 1 < ul; ul /= 2)
+	{
+		m_shift--;
+	}
+
+	for (ULONG slot = 0; slot < old_num_slots; slot++)
+	{
+		if (gpos::ulong_max != old_slots[slot].m_pos)
+		{
+			InsertSlot(old_slots[slot].m_hash, old_slots[slot].m_pos);
+		}
+	}
+
+	GPOS_DELETE_ARRAY(old_slots);
+}
+
+
+// add an entry at the given position of the container
+void
+COpenHashTable::Insert(ULONG hash, ULONG pos)
+{
+	GPOS_ASSERT(gpos::ulong_max != pos);
+
+	if (8 * (m_size + 1) > 7 * m_num_slots)
+	{
+		Grow();
+	}
+
+	InsertSlot(hash, pos);
+}
+
+
+// remove the entry at the given position of the container; entries that
+// follow it in the same run move one slot closer to their home
+void
+COpenHashTable::Remove(ULONG hash, ULONG pos)
+{
+	const ULONG mask = m_num_slots - 1;
+	ULONG slot = FindSlot(hash, pos);
+	ULONG next = (slot + 1) & mask;
+	while (gpos::ulong_max != m_slots[next].m_pos && 0 < Distance(next))
+	{
+		m_slots[slot] = m_slots[next];
+		slot = next;
+		next = (next + 1) & mask;
+	}
+
+	m_slots[slot] = SSlot();
+	m_size--;
+}
+
+// EOF
@@ -39,12 +39,13 @@ using namespace gpos;
 //  	the CMemoryPoolManager global instance
 //
 //---------------------------------------------------------------------------
-CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY)
+CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY,
+								 CMemoryPool::EAllocStrategy strategy)
 #ifdef GPOS_DEBUG
 	: m_leak_check_type(leak_check_type)
 #endif
 {
-	m_mp = CMemoryPoolManager::CreateMemoryPool();
+	m_mp = CMemoryPoolManager::CreateMemoryPool(strategy);
 }
 
 
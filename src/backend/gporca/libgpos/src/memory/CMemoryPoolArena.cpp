@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMemoryPoolArena.cpp
+//
+//	@doc:
+//		Implementation of memory pool that bump-allocates from large chunks
+//---------------------------------------------------------------------------
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+#include "gpos/assert.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+
+using namespace gpos;
+
+#define GPOS_MEM_ARENA_CHUNK_HEADER_SIZE \
+	GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunkHeader)
+
+// tag, user data and the trailing allocation type byte
+#define GPOS_MEM_ARENA_BYTES_TOTAL(ulNumBytes) \
+	(GPOS_SIZEOF(SAllocTag) + GPOS_MEM_ALIGNED_SIZE((ulNumBytes) + 1))
+
+// ctor
+CMemoryPoolArena::CMemoryPoolArena() : CMemoryPool()
+{
+	// the tag must keep user data aligned
+	GPOS_ASSERT(GPOS_MEM_ALIGNED_STRUCT_SIZE(SAllocTag) == GPOS_SIZEOF(SAllocTag));
+}
+
+
+// dtor
+CMemoryPoolArena::~CMemoryPoolArena()
+{
+	GPOS_ASSERT(nullptr == m_chunks);
+}
+
+
+// allocate a new chunk holding at least the given number of bytes;
+// a dedicated chunk holds a single large allocation and leaves the
+// current chunk in place, so that its remaining space is not wasted
+BYTE *
+CMemoryPoolArena::AllocChunk(ULONG bytes, BOOL dedicated)
+{
+	ULONG chunk_size = GPOS_MEM_ARENA_CHUNK_HEADER_SIZE + bytes;
+	if (!dedicated)
+	{
+		chunk_size = std::max(chunk_size, m_next_chunk_size);
+		m_next_chunk_size = std::min(m_next_chunk_size * 2,
+									 (ULONG) GPOS_MEM_ARENA_CHUNK_MAX_SIZE);
+	}
+
+	void *ptr = clib::Malloc(chunk_size);
+
+	GPOS_OOM_CHECK(ptr);
+
+	SChunkHeader *chunk = static_cast<SChunkHeader *>(ptr);
+	chunk->m_size = chunk_size;
+	m_total_chunk_size += chunk_size;
+
+	BYTE *data = static_cast<BYTE *>(ptr) + GPOS_MEM_ARENA_CHUNK_HEADER_SIZE;
+
+	if (dedicated && nullptr != m_chunks)
+	{
+		chunk->m_next = m_chunks->m_next;
+		m_chunks->m_next = chunk;
+	}
+	else
+	{
+		chunk->m_next = m_chunks;
+		m_chunks = chunk;
+	}
+
+	if (!dedicated)
+	{
+		m_cursor = data;
+		m_limit = static_cast<BYTE *>(ptr) + chunk_size;
+	}
+
+	return data;
+}
+
+
+void *
+CMemoryPoolArena::NewImpl(const ULONG bytes, const CHAR *, const ULONG,
+						  CMemoryPool::EAllocationType eat)
+{
+	GPOS_ASSERT(bytes <= GPOS_MEM_ALLOC_MAX);
+
+	const ULONG alloc_size = GPOS_MEM_ARENA_BYTES_TOTAL(bytes);
+
+	BYTE *ptr = nullptr;
+	if (alloc_size <= (ULONG_PTR)(m_limit - m_cursor))
+	{
+		ptr = m_cursor;
+		m_cursor += alloc_size;
+	}
+	else if (alloc_size > m_next_chunk_size / 4)
+	{
+		ptr = AllocChunk(alloc_size, true /*dedicated*/);
+	}
+	else
+	{
+		ptr = AllocChunk(alloc_size, false /*dedicated*/);
+		m_cursor += alloc_size;
+	}
+
+	m_memory_pool_statistics.RecordAllocation(bytes, alloc_size);
+
+	SAllocTag *tag = reinterpret_cast<SAllocTag *>(ptr);
+	tag->m_user_size = bytes;
+	tag->m_strategy = EasArena;
+
+	void *ptr_result = tag + 1;
+
+#ifdef GPOS_DEBUG
+	clib::Memset(ptr_result, GPOS_MEM_INIT_PATTERN_CHAR, bytes);
+#endif	// GPOS_DEBUG
+
+	// add a footer with the allocation type (singleton/array)
+	BYTE *alloc_type = reinterpret_cast<BYTE *>(ptr_result) + bytes;
+	*alloc_type = eat;
+
+	return ptr_result;
+}
+
+
+// free memory allocation; the memory stays with the pool until TearDown()
+void
+CMemoryPoolArena::DeleteImpl(void *ptr, EAllocationType eat)
+{
+	const SAllocTag *tag = AllocTag(ptr);
+	GPOS_ASSERT(EasArena == tag->m_strategy);
+
+	ULONG user_size = tag->m_user_size;
+	BYTE *alloc_type = static_cast<BYTE *>(ptr) + user_size;
+
+	// this assert ensures we aren't writing past allocated memory
+	GPOS_RTL_ASSERT(eat == EatUnknown || *alloc_type == eat);
+
+#ifdef GPOS_DEBUG
+	// mark user memory as unused in debug mode
+	clib::Memset(ptr, GPOS_MEM_FREED_PATTERN_CHAR, user_size);
+#endif	// GPOS_DEBUG
+}
+
+
+// get user requested size of allocation
+ULONG
+CMemoryPoolArena::UserSizeOfAlloc(const void *ptr)
+{
+	return AllocTag(ptr)->m_user_size;
+}
+
+
+// release all chunks at once
+void
+CMemoryPoolArena::TearDown()
+{
+	while (nullptr != m_chunks)
+	{
+		SChunkHeader *next = m_chunks->m_next;
+		clib::Free(m_chunks);
+		m_chunks = next;
+	}
+
+	m_cursor = nullptr;
+	m_limit = nullptr;
+	m_total_chunk_size = 0;
+}
+
+// EOF
@@ -18,6 +18,7 @@
 #include "gpos/common/clibwrapper.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
 #include "gpos/task/CAutoSuspendAbort.h"
@@ -75,10 +76,10 @@ CMemoryPoolManager::Init()
 
 
 CMemoryPool *
-CMemoryPoolManager::CreateMemoryPool()
+CMemoryPoolManager::CreateMemoryPool(CMemoryPool::EAllocStrategy strategy)
 {
 	GPOS_ASSERT(nullptr != m_memory_pool_mgr);
-	CMemoryPool *mp = m_memory_pool_mgr->NewMemoryPool();
+	CMemoryPool *mp = m_memory_pool_mgr->NewMemoryPool(strategy);
 
 	// accessor scope
 	{
@@ -95,8 +96,15 @@ CMemoryPoolManager::CreateMemoryPool()
 
 // Allocate a new NewMemoryPool
 CMemoryPool *
-CMemoryPoolManager::NewMemoryPool()
+CMemoryPoolManager::NewMemoryPool(CMemoryPool::EAllocStrategy strategy)
 {
+	if (CMemoryPool::EasArena == strategy)
+	{
+		return GPOS_NEW(m_internal_memory_pool) CMemoryPoolArena();
+	}
+
+	// a tracker has no per-pool memory overhead, so it also serves as a
+	// compact pool
 	return GPOS_NEW(m_internal_memory_pool) CMemoryPoolTracker();
 }
 
@@ -142,10 +150,17 @@ CMemoryPoolManager::TotalAllocatedSize()
 	return total_size;
 }
 
-// free memory allocation
+// free memory allocation; the allocation tag tells whether it belongs to
+// an arena or a tracker pool
 void
 CMemoryPoolManager::DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		CMemoryPoolArena::DeleteImpl(ptr, eat);
+		return;
+	}
+
 	CMemoryPoolTracker::DeleteImpl(ptr, eat);
 }
 
@@ -153,6 +168,11 @@ CMemoryPoolManager::DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat)
 ULONG
 CMemoryPoolManager::UserSizeOfAlloc(const void *ptr)
 {
+	if (CMemoryPoolArena::IsArenaAlloc(ptr))
+	{
+		return CMemoryPoolArena::UserSizeOfAlloc(ptr);
+	}
+
 	return CMemoryPoolTracker::UserSizeOfAlloc(ptr);
 }
 
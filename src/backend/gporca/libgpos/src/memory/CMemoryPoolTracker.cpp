@@ -37,6 +37,10 @@ using namespace gpos;
 // ctor
 CMemoryPoolTracker::CMemoryPoolTracker() : CMemoryPool()
 {
+	// CMemoryPoolManager locates the tag right before the user data
+	GPOS_ASSERT(GPOS_OFFSET(SAllocHeader, m_tag) + GPOS_SIZEOF(SAllocTag) ==
+				GPOS_SIZEOF(SAllocHeader));
+
 	m_allocations_list.Init(GPOS_OFFSET(SAllocHeader, m_link));
 }
 
@@ -50,7 +54,7 @@ CMemoryPoolTracker::~CMemoryPoolTracker()
 void
 CMemoryPoolTracker::RecordAllocation(SAllocHeader *header)
 {
-	m_memory_pool_statistics.RecordAllocation(header->m_user_size,
+	m_memory_pool_statistics.RecordAllocation(header->m_tag.m_user_size,
 											  header->m_alloc_size);
 	m_allocations_list.Prepend(header);
 }
@@ -58,7 +62,7 @@ CMemoryPoolTracker::RecordAllocation(SAllocHeader *header)
 void
 CMemoryPoolTracker::RecordFree(SAllocHeader *header)
 {
-	m_memory_pool_statistics.RecordFree(header->m_user_size,
+	m_memory_pool_statistics.RecordFree(header->m_tag.m_user_size,
 										header->m_alloc_size);
 	m_allocations_list.Remove(header);
 }
@@ -86,7 +90,8 @@ CMemoryPoolTracker::NewImpl(const ULONG bytes, const CHAR *file,
 	header->m_mp = this;
 	header->m_filename = file;
 	header->m_line = line;
-	header->m_user_size = bytes;
+	header->m_tag.m_user_size = bytes;
+	header->m_tag.m_strategy = EasGeneral;
 
 	RecordAllocation(header);
 
@@ -111,7 +116,7 @@ CMemoryPoolTracker::DeleteImpl(void *ptr, EAllocationType eat)
 {
 	SAllocHeader *header = static_cast<SAllocHeader *>(ptr) - 1;
 
-	ULONG user_size = header->m_user_size;
+	ULONG user_size = header->m_tag.m_user_size;
 	BYTE *alloc_type = static_cast<BYTE *>(ptr) + user_size;
 
 	// this assert ensures we aren't writing past allocated memory
@@ -134,7 +139,7 @@ ULONG
 CMemoryPoolTracker::UserSizeOfAlloc(const void *ptr)
 {
 	const SAllocHeader *header = static_cast<const SAllocHeader *>(ptr) - 1;
-	return header->m_user_size;
+	return header->m_tag.m_user_size;
 }
 
 
@@ -164,7 +169,7 @@ CMemoryPoolTracker::WalkLiveObjects(gpos::IMemoryVisitor *visitor)
 	{
 		void *user = header + 1;
 
-		visitor->Visit(user, header->m_user_size, header, header->m_alloc_size,
+		visitor->Visit(user, header->m_tag.m_user_size, header, header->m_alloc_size,
 					   header->m_filename, header->m_line, header->m_serial,
 #ifdef GPOS_DEBUG
 					   &header->m_stack_desc
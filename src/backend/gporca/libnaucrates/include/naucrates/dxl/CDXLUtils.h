@@ -83,10 +83,25 @@ public:
 	static CParseHandlerDXL *GetParseHandlerForDXLString(
 		CMemoryPool *, const CHAR *dxl_string, const CHAR *xsd_file_path);
 
-	// same as above but with DXL file name specified instead of the file contents
+	// same as above but with DXL file name specified instead of the file
+	// contents; the file may hold XML or binary DXL
 	static CParseHandlerDXL *GetParseHandlerForDXLFile(
 		CMemoryPool *, const CHAR *dxl_filename, const CHAR *xsd_file_path);
 
+	// same as above but for a binary DXL document held in the given buffer
+	static CParseHandlerDXL *GetParseHandlerForBinaryDXL(CMemoryPool *,
+														 const BYTE *pb,
+														 ULONG_PTR size);
+
+	// encode the given XML DXL file in binary DXL
+	static BYTE *EncodeBinaryDXL(CMemoryPool *mp, const CHAR *dxl_filename,
+								 ULONG_PTR *size);
+
+	// serialize a binary DXL document as XML
+	static void SerializeBinaryDXL(CMemoryPool *mp, const BYTE *pb,
+								   ULONG_PTR size, IOstream &os,
+								   BOOL indentation);
+
 	// parse a DXL document containing a DXL plan
 	static CDXLNode *GetPlanDXLNode(CMemoryPool *, const CHAR *dxl_string,
 									const CHAR *xsd_file_path, ULLONG *plan_id,
@@ -277,6 +292,10 @@ public:
 
 	static CHAR *Read(CMemoryPool *mp, const CHAR *filename);
 
+	// read a given file in a byte buffer
+	static BYTE *ReadBytes(CMemoryPool *mp, const CHAR *filename,
+						   ULONG_PTR *size);
+
 	// create a multi-byte character string from a wide character string
 	static CHAR *CreateMultiByteCharStringFromWCString(CMemoryPool *mp,
 													   const WCHAR *wc_string);
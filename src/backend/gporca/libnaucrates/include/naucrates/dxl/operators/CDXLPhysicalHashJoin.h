@@ -43,16 +43,27 @@ enum Edxlhj
 class CDXLPhysicalHashJoin : public CDXLPhysicalJoin
 {
 private:
+	// should the hash table build a runtime filter for the outer scan
+	BOOL m_use_runtime_filter;
+
 public:
 	CDXLPhysicalHashJoin(const CDXLPhysicalHashJoin &) = delete;
 
 	// ctor/dtor
-	CDXLPhysicalHashJoin(CMemoryPool *mp, EdxlJoinType join_type);
+	CDXLPhysicalHashJoin(CMemoryPool *mp, EdxlJoinType join_type,
+						 BOOL use_runtime_filter);
 
 	// accessors
 	Edxlopid GetDXLOperator() const override;
 	const CWStringConst *GetOpNameStr() const override;
 
+	// should the hash table build a runtime filter for the outer scan
+	BOOL
+	UseRuntimeFilter() const
+	{
+		return m_use_runtime_filter;
+	}
+
 	// serialize operator in DXL format
 	void SerializeToDXL(CXMLSerializer *xml_serializer,
 						const CDXLNode *dxlnode) const override;
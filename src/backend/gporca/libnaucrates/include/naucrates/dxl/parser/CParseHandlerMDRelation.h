@@ -69,6 +69,12 @@ protected:
 	// partition types
 	CharPtrArray *m_str_part_types_array;
 
+	// does any leaf partition have foreign storage
+	BOOL m_has_foreign_partitions;
+
+	// do all leaf partitions have the columns of the root
+	BOOL m_partitions_match_root_cols;
+
 	// key sets
 	ULongPtr2dArray *m_key_sets_arrays;
 
@@ -48,7 +48,8 @@ private:
 	// the memory manager used for parsing the current document
 	CDXLMemoryManager *m_dxl_memory_manager;
 
-	// parser object responsible for parsing the current XML document
+	// parser object responsible for parsing the current XML document;
+	// nullptr when the events come from a binary DXL document
 	SAX2XMLReader *m_xml_reader;
 
 	// current parse handler
@@ -63,6 +64,9 @@ private:
 	// check for aborts at regular intervals
 	void CheckForAborts();
 
+	// direct the events of the XML reader to the current handler
+	void SetXMLReaderHandler();
+
 
 public:
 	CParseHandlerManager(const CParseHandlerManager &) = delete;
@@ -97,6 +101,13 @@ public:
 
 	// Returns the current parse handler if one exists; used for debugging purposes
 	const CParseHandlerBase *GetCurrentParseHandler();
+
+	// Returns the handler receiving the next parsing event, if one exists
+	CParseHandlerBase *
+	GetContentHandler()
+	{
+		return m_curr_parse_handler;
+	}
 };
 }  // namespace gpdxl
 #endif	// !GPDXL_CParseHandlerManager_H
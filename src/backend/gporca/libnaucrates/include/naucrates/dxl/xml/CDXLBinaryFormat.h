@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryFormat.h
+//
+//	@doc:
+//		Layout of binary DXL documents
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryFormat_H
+#define GPDXL_CDXLBinaryFormat_H
+
+#include <xercesc/util/XercesDefs.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/clibwrapper.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryFormat
+//
+//	@doc:
+//		Binary DXL is a lossless encoding of the element and attribute
+//		structure of an XML DXL document; DXL documents carry no character
+//		data. A document consists of
+//
+//		- a header (SHeader),
+//		- a string table holding every distinct element name, attribute
+//		  name, attribute value and namespace once; each entry is a ULONG
+//		  length followed by the zero-terminated UTF-16 characters, padded
+//		  to a multiple of four bytes,
+//		- a stream of ULONG words encoding the SAX events of the document,
+//		  where strings are referenced by their position in the table:
+//
+//		  EevStartElement uri local-name qname #attrs
+//		                  (local-name qname value)*
+//		  EevEndElement
+//		  EevPrefixMapping prefix uri
+//
+//		The document contains no pointers, so a reader can use a file
+//		mapped into memory as is: strings are handed to the parse handlers
+//		without being copied or transcoded.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryFormat
+{
+public:
+	// events of the event stream
+	enum EEvent
+	{
+		EevStartElement = 1,
+		EevEndElement,
+		EevPrefixMapping,
+
+		EevSentinel
+	};
+
+	// document header
+	struct SHeader
+	{
+		// magic bytes, see szMagic
+		CHAR m_rgchMagic[4];
+
+		// format version
+		USINT m_usVersion;
+
+		// byte order mark written in the byte order of the writer
+		USINT m_usByteOrder;
+
+		// number of strings in the string table
+		ULONG m_ulStrings;
+
+		// size of the string table in bytes
+		ULONG m_ulStringBytes;
+
+		// number of words in the event stream
+		ULONG m_ulEventWords;
+	};
+
+	// magic bytes at the start of every document
+	static constexpr const CHAR *szMagic = "DXLB";
+
+	// current format version
+	static const USINT usVersion = 1;
+
+	// byte order mark
+	static const USINT usByteOrder = 0xFEFF;
+
+	// does the given buffer start with a binary DXL header
+	static BOOL
+	FBinaryDXL(const BYTE *pb, ULONG_PTR size)
+	{
+		return GPOS_SIZEOF(SHeader) <= size &&
+			   0 == clib::Memcmp(pb, szMagic,
+								 GPOS_SIZEOF(SHeader::m_rgchMagic));
+	}
+
+	// size of a string table entry holding a string of the given length
+	static ULONG
+	UlStringEntryBytes(ULONG ulLength)
+	{
+		ULONG ulBytes =
+			GPOS_SIZEOF(ULONG) + (ulLength + 1) * GPOS_SIZEOF(XMLCh);
+		return (ulBytes + GPOS_SIZEOF(ULONG) - 1) & ~(GPOS_SIZEOF(ULONG) - 1);
+	}
+};
+
+GPOS_CPL_ASSERT(2 == sizeof(XMLCh),
+				"binary DXL stores strings as UTF-16 code units");
+GPOS_CPL_ASSERT(20 == sizeof(CDXLBinaryFormat::SHeader),
+				"binary DXL header must not contain padding");
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryFormat_H
+
+// EOF
@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryReader.h
+//
+//	@doc:
+//		Reader of binary DXL documents
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryReader_H
+#define GPDXL_CDXLBinaryReader_H
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+// fwd decl
+class CParseHandlerManager;
+class CXMLSerializer;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryReader
+//
+//	@doc:
+//		Replays the SAX events of a binary DXL document, see
+//		CDXLBinaryFormat, either into the DXL parse handlers or into an XML
+//		serializer.
+//
+//		The reader does not copy the document; strings handed out point into
+//		the given buffer, which therefore has to stay valid while the
+//		document is replayed. Malformed documents raise
+//		ExmiDXLBinaryParseError.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryReader
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// document
+	const BYTE *m_pb;
+
+	// size of the document in bytes
+	ULONG_PTR m_size;
+
+	// strings of the string table
+	const XMLCh **m_rgxmlstr;
+
+	// number of strings
+	ULONG m_ulStrings;
+
+	// event stream
+	const ULONG *m_rgulEvents;
+
+	// number of words in the event stream
+	ULONG m_ulEventWords;
+
+	// string at the given position of the string table
+	const XMLCh *Xmlstr(ULONG ulPos) const;
+
+	// replay the events into the given parse handler manager or, if that is
+	// nullptr, into the given handler
+	void Replay(CParseHandlerManager *parse_handler_mgr,
+				DefaultHandler *handler);
+
+public:
+	CDXLBinaryReader(const CDXLBinaryReader &) = delete;
+
+	// ctor; validates the header and the string table
+	CDXLBinaryReader(CMemoryPool *mp, const BYTE *pb, ULONG_PTR size);
+
+	// dtor
+	~CDXLBinaryReader();
+
+	// replay the document into the parse handlers of the given manager
+	void Parse(CParseHandlerManager *parse_handler_mgr);
+
+	// write the document as XML
+	void Serialize(CXMLSerializer *xml_serializer);
+
+};	// class CDXLBinaryReader
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryReader_H
+
+// EOF
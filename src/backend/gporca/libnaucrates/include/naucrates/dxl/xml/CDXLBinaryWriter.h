@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryWriter.h
+//
+//	@doc:
+//		SAX handler encoding the parsed XML DXL document in binary DXL
+//---------------------------------------------------------------------------
+#ifndef GPDXL_CDXLBinaryWriter_H
+#define GPDXL_CDXLBinaryWriter_H
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/COpenHashMap.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryWriter
+//
+//	@doc:
+//		Collects the SAX events of an XML DXL document and produces the
+//		equivalent binary DXL document, see CDXLBinaryFormat
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryWriter : public DefaultHandler
+{
+private:
+	// hash function for strings
+	static ULONG HashValue(const XMLCh *xmlstr);
+
+	// equality function for strings
+	static BOOL Equals(const XMLCh *xmlstrFst, const XMLCh *xmlstrSnd);
+
+	// map of interned strings to their position in the string table
+	using StringToPosMap =
+		COpenHashMap<XMLCh, ULONG, HashValue, Equals, CleanupDeleteArray<XMLCh>,
+					 CleanupDelete<ULONG>>;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// interned strings
+	StringToPosMap *m_phmstrpos;
+
+	// size of the string table in bytes
+	ULONG m_ulStringBytes;
+
+	// event stream
+	ULONG *m_rgulEvents;
+
+	// number of words in the event stream
+	ULONG m_ulEventWords;
+
+	// capacity of the event stream
+	ULONG m_ulEventCapacity;
+
+	// position of the given string in the string table
+	ULONG UlIntern(const XMLCh *xmlstr);
+
+	// append a word to the event stream
+	void AppendEvent(ULONG ul);
+
+public:
+	CDXLBinaryWriter(const CDXLBinaryWriter &) = delete;
+
+	// ctor
+	explicit CDXLBinaryWriter(CMemoryPool *mp);
+
+	// dtor
+	~CDXLBinaryWriter() override;
+
+	// SAX handler interface
+	void startElement(const XMLCh *const element_uri,
+					  const XMLCh *const element_local_name,
+					  const XMLCh *const element_qname,
+					  const Attributes &attr) override;
+
+	void endElement(const XMLCh *const element_uri,
+					const XMLCh *const element_local_name,
+					const XMLCh *const element_qname) override;
+
+	void startPrefixMapping(const XMLCh *const prefix,
+							const XMLCh *const uri) override;
+
+	// size of the binary document in bytes
+	ULONG_PTR Size() const;
+
+	// write the binary document into the given buffer of Size() bytes
+	void Serialize(BYTE *pb) const;
+
+};	// class CDXLBinaryWriter
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryWriter_H
+
+// EOF
@@ -71,6 +71,7 @@ enum Edxltoken
 	EdxltokenPushGroupByBelowSetopThreshold,
 	EdxltokenXformBindThreshold,
 	EdxltokenSkewFactor,
+	EdxltokenPlanningDeadline,
 	EdxltokenMaxStatsBuckets,
 	EdxltokenWindowOids,
 	EdxltokenOidRowNumber,
@@ -302,6 +303,8 @@ enum Edxltoken
 
 	EdxltokenMergeJoinUniqueOuter,
 
+	EdxltokenHashJoinRuntimeFilter,
+
 	EdxltokenAggStrategy,
 	EdxltokenAggStrategyPlain,
 	EdxltokenAggStrategySorted,
@@ -516,6 +519,8 @@ enum Edxltoken
 	EdxltokenRelDistrOpclass,
 
 	EdxltokenRelForeignServer,
+	EdxltokenRelForeignPartitions,
+	EdxltokenRelPartitionsMatchRootCols,
 
 	EdxltokenMetadataColumns,
 	EdxltokenMetadataColumn,
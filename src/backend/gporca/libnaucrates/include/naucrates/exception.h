@@ -40,6 +40,7 @@ enum ExMinor
 	ExmiDXLUnrecognizedCompOperator,
 	ExmiDXLValidationError,
 	ExmiDXLXercesParseError,
+	ExmiDXLBinaryParseError,
 	ExmiDXLIncorrectNumberOfChildren,
 	ExmiDXL2PlStmtConversion,
 	ExmiQuery2DXLAttributeNotFound,
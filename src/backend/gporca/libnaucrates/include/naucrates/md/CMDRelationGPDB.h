@@ -82,15 +82,22 @@ private:
 	// do we need to consider a hash distributed table as random distributed
 	BOOL m_convert_hash_to_random;
 
-	// indices of partition columns
+	// indices of partition columns, one per level of the partition hierarchy
 	ULongPtrArray *m_partition_cols_array;
 
-	// partition types
+	// partition types, one per level of the partition hierarchy
 	CharPtrArray *m_str_part_types_array;
 
-	// Child partition oids
+	// leaf partition oids; the leaves of a multi-level partitioned table are
+	// flattened into a single list
 	IMdIdArray *m_partition_oids;
 
+	// does any leaf partition have foreign storage
+	BOOL m_has_foreign_partitions;
+
+	// do all leaf partitions have the columns of the root, in the same order
+	BOOL m_partitions_match_root_cols;
+
 	// array of key sets
 	ULongPtr2dArray *m_keyset_array;
 
@@ -135,7 +142,8 @@ public:
 		Ereldistrpolicy rel_distr_policy, CMDColumnArray *mdcol_array,
 		ULongPtrArray *distr_col_array, IMdIdArray *distr_opfamilies,
 		ULongPtrArray *partition_cols_array, CharPtrArray *str_part_types_array,
-		IMdIdArray *partition_oids, BOOL convert_hash_to_random,
+		IMdIdArray *partition_oids, BOOL has_foreign_partitions,
+		BOOL partitions_match_root_cols, BOOL convert_hash_to_random,
 		ULongPtr2dArray *keyset_array, CMDIndexInfoArray *md_index_info_array,
 		IMdIdArray *mdid_check_constraint_array, CDXLNode *mdpart_constraint,
 		IMDId *foreign_server, CDouble rows);
@@ -244,6 +252,12 @@ public:
 	// child partition oids
 	IMdIdArray *ChildPartitionMdids() const override;
 
+	// does any leaf partition have foreign storage
+	BOOL HasForeignPartitions() const override;
+
+	// do all leaf partitions have the columns of the root
+	BOOL PartitionsMatchRootColumns() const override;
+
 	IMDId *ForeignServer() const override;
 
 	CDouble Rows() const override;
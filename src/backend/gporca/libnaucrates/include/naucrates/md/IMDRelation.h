@@ -195,13 +195,30 @@ public:
 	// part constraint
 	virtual CDXLNode *MDPartConstraint() const = 0;
 
-	// child partition oids
+	// leaf partition oids, of all levels of the partition hierarchy
 	virtual IMdIdArray *
 	ChildPartitionMdids() const
 	{
 		return nullptr;
 	}
 
+	// does any leaf partition have foreign storage; when false, the leaf
+	// partitions need not be retrieved to find their foreign servers
+	virtual BOOL
+	HasForeignPartitions() const
+	{
+		return true;
+	}
+
+	// do all leaf partitions have the columns of the root, including
+	// dropped ones, in the same order; when true, the leaf partitions need
+	// not be retrieved to map their columns to those of the root
+	virtual BOOL
+	PartitionsMatchRootColumns() const
+	{
+		return false;
+	}
+
 	// relation distribution policy as a string value
 	static const CWStringConst *GetDistrPolicyStr(
 		Ereldistrpolicy rel_distr_policy);
@@ -0,0 +1,167 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDoubleHistogram.h
+//
+//	@doc:
+//		Flat representation of histogram bounds that map to doubles
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CDoubleHistogram_H
+#define GPNAUCRATES_CDoubleHistogram_H
+
+#include "gpos/base.h"
+#include "gpos/common/CRefCount.h"
+
+#include "naucrates/statistics/CBucket.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDoubleHistogram
+//
+//	@doc:
+//		Bounds of the buckets of a histogram stored as contiguous arrays of
+//		doubles, one entry per bucket. Comparing two bounds of a CBucket
+//		goes through their IDatums; the arrays allow the same comparisons
+//		without chasing pointers or making virtual calls, and the scans
+//		over them are written so that the compiler can vectorize them.
+//
+//		A flat histogram exists only if every bound maps to a double that
+//		compares exactly the way the datums compare in statistics (see
+//		IDatum::StatsAreLessThan), and if both lower and upper bounds are
+//		sorted. The predicates below therefore return the same results as
+//		their counterparts in CBucket.
+//
+//---------------------------------------------------------------------------
+class CDoubleHistogram : public CRefCount
+{
+public:
+	// bounds of a single bucket
+	struct SBucket
+	{
+		DOUBLE m_lower;
+		DOUBLE m_upper;
+		BOOL m_is_lower_closed;
+		BOOL m_is_upper_closed;
+	};
+
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of buckets
+	ULONG m_num_buckets;
+
+	// lower bounds of the buckets
+	DOUBLE *m_lower;
+
+	// upper bounds of the buckets
+	DOUBLE *m_upper;
+
+	// is the lower bound of the bucket closed
+	BOOL *m_is_lower_closed;
+
+	// is the upper bound of the bucket closed
+	BOOL *m_is_upper_closed;
+
+	// private ctor, use Create
+	CDoubleHistogram(CMemoryPool *mp, ULONG num_buckets);
+
+	// compare two lower or two upper bounds, return 0 if they match, 1 if
+	// the first one is greater and -1 otherwise; equal points that differ
+	// in being closed compare as closed_first if the first one is closed
+	static INT CompareBounds(DOUBLE bound1, BOOL is_closed1, DOUBLE bound2,
+							 BOOL is_closed2, INT closed_first);
+
+	// compare the lower bound of the first bucket to the upper bound of the
+	// second one, see CBucket::CompareLowerBoundToUpperBound
+	static INT CompareLowerBoundToUpperBound(const SBucket &bucket1,
+											 const SBucket &bucket2);
+
+	// does the first bucket subsume the second one
+	static BOOL Subsumes(const SBucket &bucket1, const SBucket &bucket2);
+
+public:
+	CDoubleHistogram(const CDoubleHistogram &) = delete;
+
+	// dtor
+	~CDoubleHistogram() override;
+
+	// flat histogram of the given buckets, nullptr if the bounds cannot be
+	// represented as doubles
+	static CDoubleHistogram *Create(CMemoryPool *mp,
+									const CBucketArray *buckets);
+
+	// map the given point to a double that compares the way the point
+	// does; returns false if there is no such double
+	static BOOL FMapPoint(const CPoint *point, DOUBLE *value);
+
+	// number of buckets
+	ULONG
+	Size() const
+	{
+		return m_num_buckets;
+	}
+
+	// bounds of the given bucket
+	SBucket
+	GetBucket(ULONG pos) const
+	{
+		GPOS_ASSERT(pos < m_num_buckets);
+
+		return SBucket{m_lower[pos], m_upper[pos], m_is_lower_closed[pos],
+					   m_is_upper_closed[pos]};
+	}
+
+	// equality of two mapped points, see IDatum::StatsAreEqual
+	static BOOL Equals(DOUBLE value1, DOUBLE value2);
+
+	// less than of two mapped points, see IDatum::StatsAreLessThan
+	static BOOL IsLessThan(DOUBLE value1, DOUBLE value2);
+
+	// is the bucket a singleton
+	static BOOL IsSingleton(const SBucket &bucket);
+
+	// does the bucket contain the point
+	static BOOL Contains(const SBucket &bucket, DOUBLE value);
+
+	// compare the lower bounds of two buckets, see
+	// CBucket::CompareLowerBounds
+	static INT CompareLowerBounds(const SBucket &bucket1,
+								  const SBucket &bucket2);
+
+	// compare the upper bounds of two buckets, see
+	// CBucket::CompareUpperBounds
+	static INT CompareUpperBounds(const SBucket &bucket1,
+								  const SBucket &bucket2);
+
+	// do the buckets intersect
+	static BOOL Intersects(const SBucket &bucket1, const SBucket &bucket2);
+
+	// does the first bucket occur before the second one
+	static BOOL IsBefore(const SBucket &bucket1, const SBucket &bucket2);
+
+	// number of consecutive buckets, starting at the given one, whose
+	// upper bound is less than the given point
+	ULONG CountBucketsBefore(ULONG begin, DOUBLE value) const;
+
+	// position of the first bucket whose upper bound is not less than the
+	// given point, the number of buckets if there is none
+	ULONG FindFirstUpperNotLess(DOUBLE value) const;
+
+	// position of the first bucket whose lower bound is greater than the
+	// given point, the number of buckets if there is none
+	ULONG FindFirstLowerGreater(DOUBLE value) const;
+
+};	// class CDoubleHistogram
+
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CDoubleHistogram_H
+
+// EOF
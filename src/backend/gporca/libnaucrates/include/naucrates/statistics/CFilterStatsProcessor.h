@@ -81,6 +81,13 @@ private:
 		CStatsPredDisj *pred_stats, CDouble *scale_factor,
 		const CStatistics *input_stats);
 
+	// position of the first of the given sorted points, starting at the
+	// given position, that is not before the bucket; or, if is_after is
+	// set, that is after the bucket
+	static ULONG FindFirstPoint(const CBucket *bucket,
+								const CPointArray *points, ULONG start,
+								BOOL is_after);
+
 	// check if the column is a new column for statistic calculation
 	static BOOL IsNewStatsColumn(ULONG colid, ULONG last_colid);
 
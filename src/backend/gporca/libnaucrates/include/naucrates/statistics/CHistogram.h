@@ -16,6 +16,7 @@
 
 #include "gpopt/base/CKHeap.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CDoubleHistogram.h"
 #include "naucrates/statistics/CStatsPred.h"
 
 namespace gpopt
@@ -95,6 +96,25 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// flat representation of the bucket bounds, built on first use and
+	// shared with copies of the histogram; nullptr if the bounds do not
+	// map to doubles
+	mutable CDoubleHistogram *m_double_histogram;
+
+	// has m_double_histogram been built
+	mutable BOOL m_double_histogram_built;
+
+	// flat representation of the bucket bounds, nullptr if there is none
+	const CDoubleHistogram *GetDoubleHistogram() const;
+
+	// range of buckets that may contain the given point
+	void GetCandidateBuckets(const CPoint *point, ULONG *begin,
+							 ULONG *end) const;
+
+	// number of consecutive buckets, starting at the given one, that end
+	// before the lower bound of the given bucket; 0 if this is unknown
+	ULONG CountBucketsBefore(ULONG begin, const CBucket *bucket) const;
+
 	// return an array buckets after applying equality filter on the histogram buckets
 	CBucketArray *MakeBucketsWithEqualityFilter(CPoint *point) const;
 
@@ -363,6 +383,7 @@ public:
 	virtual ~CHistogram()
 	{
 		m_histogram_buckets->Release();
+		CRefCount::SafeRelease(m_double_histogram);
 	}
 
 	// normalize histogram and return scaling factor
@@ -77,6 +77,9 @@ enum EOptTraceFlag
 	// print equivalent distribution specs
 	EopttracePrintEquivDistrSpecs = 101017,
 
+	// collect a profile of time and memory per xform, job type and stage
+	EopttraceProfileOptimization = 101018,
+
 	///////////////////////////////////////////////////////
 	////////////////// transformations flags //////////////
 	///////////////////////////////////////////////////////
@@ -223,6 +226,12 @@ enum EOptTraceFlag
 	// Ordered Agg
 	EopttraceDisableOrderedAgg = 103047,
 
+	// push runtime filters of inner hash joins into outer table scans
+	EopttraceEnableRuntimeJoinFilter = 103048,
+
+	// enable merge join alternatives of inner and left outer joins
+	EopttraceEnableInnerLeftMergeJoin = 103049,
+
 	///////////////////////////////////////////////////////
 	///////////////////// statistics flags ////////////////
 	//////////////////////////////////////////////////////
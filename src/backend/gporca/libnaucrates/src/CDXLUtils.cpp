@@ -22,6 +22,7 @@
 #include "gpos/common/CAutoRg.h"
 #include "gpos/common/CAutoTimer.h"
 #include "gpos/io/CFileReader.h"
+#include "gpos/io/CFileWriter.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/io/ioutils.h"
 #include "gpos/task/CAutoTraceFlag.h"
@@ -39,6 +40,8 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerPlan.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/md/CDXLStatsDerivedRelation.h"
@@ -140,6 +143,26 @@ CDXLUtils::GetParseHandlerForDXLString(CMemoryPool *mp, const CHAR *dxl_string,
 	return parse_handler_dxl;
 }
 
+// does the given file hold a binary DXL document
+static BOOL
+FBinaryDXLFile(const CHAR *file_name)
+{
+	if (!ioutils::PathExists(file_name) || !ioutils::IsFile(file_name))
+	{
+		// let the XML parser report the error
+		return false;
+	}
+
+	CFileReader fr;
+	fr.Open(file_name);
+
+	BYTE rgbHeader[GPOS_SIZEOF(CDXLBinaryFormat::SHeader)];
+	ULONG_PTR ulpRead = fr.ReadBytesToBuffer(rgbHeader, GPOS_SIZEOF(rgbHeader));
+	fr.Close();
+
+	return CDXLBinaryFormat::FBinaryDXL(rgbHeader, ulpRead);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetParseHandlerForDXLFile
@@ -156,6 +179,15 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 {
 	GPOS_ASSERT(nullptr != mp);
 
+	if (FBinaryDXLFile(dxl_filename))
+	{
+		// binary DXL is replayed into the parse handlers without Xerces
+		ULONG_PTR size = 0;
+		CAutoRg<BYTE> a_pb(ReadBytes(mp, dxl_filename, &size));
+
+		return GetParseHandlerForBinaryDXL(mp, a_pb.Rgt(), size);
+	}
+
 	// setup own memory manager
 	CDXLMemoryManager mm(mp);
 	SAX2XMLReader *sax_2_xml_reader = nullptr;
@@ -232,6 +264,120 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForBinaryDXL
+//
+//	@doc:
+//		Replay the given binary DXL document into the parse handlers and
+//		return the top-level parser
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForBinaryDXL(CMemoryPool *mp, const BYTE *pb,
+									   ULONG_PTR size)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != pb);
+
+	CDXLBinaryReader reader(mp, pb, size);
+
+	CDXLMemoryManager mm(mp);
+	CParseHandlerManager parse_handler_mgr(&mm, nullptr /*xml_reader*/);
+	CParseHandlerDXL *parse_handler_dxl =
+		CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr);
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl);
+
+	GPOS_TRY
+	{
+		reader.Parse(&parse_handler_mgr);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		GPOS_DELETE(parse_handler_dxl);
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	GPOS_CHECK_ABORT;
+
+	return parse_handler_dxl;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::EncodeBinaryDXL
+//
+//	@doc:
+//		Encode the given XML DXL file in binary DXL; the returned buffer is
+//		allocated from the given memory pool
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::EncodeBinaryDXL(CMemoryPool *mp, const CHAR *dxl_filename,
+						   ULONG_PTR *size)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != size);
+
+	CDXLMemoryManager mm(mp);
+	CDXLBinaryWriter writer(mp);
+
+	SAX2XMLReader *sax_2_xml_reader = XMLReaderFactory::createXMLReader(&mm);
+
+	// keep the namespace declarations, so that the document serialized back
+	// as XML binds its prefixes
+	sax_2_xml_reader->setFeature(XMLUni::fgSAX2CoreNameSpacePrefixes, true);
+	sax_2_xml_reader->setContentHandler(&writer);
+	sax_2_xml_reader->setErrorHandler(&writer);
+
+	try
+	{
+		sax_2_xml_reader->parse(dxl_filename);
+	}
+	catch (const XMLException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+	catch (const SAXException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+
+	delete sax_2_xml_reader;
+
+	*size = writer.Size();
+	BYTE *pb = GPOS_NEW_ARRAY(mp, BYTE, *size);
+	writer.Serialize(pb);
+
+	return pb;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeBinaryDXL
+//
+//	@doc:
+//		Serialize a binary DXL document as XML
+//
+//---------------------------------------------------------------------------
+void
+CDXLUtils::SerializeBinaryDXL(CMemoryPool *mp, const BYTE *pb, ULONG_PTR size,
+							  IOstream &os, BOOL indentation)
+{
+	GPOS_ASSERT(nullptr != mp);
+	GPOS_ASSERT(nullptr != pb);
+
+	CDXLBinaryReader reader(mp, pb, size);
+	CXMLSerializer xml_serializer(mp, os, indentation);
+	reader.Serialize(&xml_serializer);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetParseHandlerForDXLString
@@ -1793,6 +1939,40 @@ CDXLUtils::Read(CMemoryPool *mp, const CHAR *filename)
 	return read_buffer.RgtReset();
 }
 
+//---------------------------------------------------------------------------
+//		CDXLUtils::ReadBytes
+//
+//	@doc:
+//		Read a given file in a byte buffer.
+//		The function allocates memory from the provided memory pool, and it is
+//		the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::ReadBytes(CMemoryPool *mp, const CHAR *filename, ULONG_PTR *size)
+{
+	GPOS_ASSERT(nullptr != size);
+
+	CFileReader fr;
+	fr.Open(filename);
+
+	ULONG_PTR file_size = (ULONG_PTR) fr.FileSize();
+	CAutoRg<BYTE> read_buffer(GPOS_NEW_ARRAY(mp, BYTE, file_size + 1));
+
+	ULONG_PTR read_bytes = 0;
+	if (0 < file_size)
+	{
+		read_bytes = fr.ReadBytesToBuffer(read_buffer.Rgt(), file_size);
+	}
+	fr.Close();
+
+	GPOS_ASSERT(read_bytes == file_size);
+
+	*size = read_bytes;
+
+	return read_buffer.RgtReset();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::SerializeBooleanArray
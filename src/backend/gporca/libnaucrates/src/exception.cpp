@@ -87,6 +87,12 @@ gpdxl::EresExceptionInit(CMemoryPool *mp)
 				 0,	 //
 				 GPOS_WSZ_WSZLEN("Xerces parse exception")),
 
+		CMessage(CException(gpdxl::ExmaDXL, gpdxl::ExmiDXLBinaryParseError),
+				 CException::ExsevError,
+				 GPOS_WSZ_WSZLEN("Malformed binary DXL document: %s"),
+				 1,	 // error details
+				 GPOS_WSZ_WSZLEN("Malformed binary DXL document")),
+
 		CMessage(
 			CException(gpdxl::ExmaDXL, gpdxl::ExmiDXLIncorrectNumberOfChildren),
 			CException::ExsevError,
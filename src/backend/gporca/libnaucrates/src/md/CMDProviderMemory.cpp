@@ -21,6 +21,7 @@
 
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerDXL.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CDXLColStats.h"
 #include "naucrates/md/CDXLExtStatsInfo.h"
@@ -46,15 +47,13 @@ CMDProviderMemory::CMDProviderMemory(CMemoryPool *mp, const CHAR *file_name)
 {
 	GPOS_ASSERT(nullptr != file_name);
 
-	// read DXL file
-	CAutoRg<CHAR> dxl_file;
-	dxl_file = CDXLUtils::Read(mp, file_name);
+	// parse DXL file, which may hold XML or binary DXL
+	CAutoP<CParseHandlerDXL> parse_handler_dxl(
+		CDXLUtils::GetParseHandlerForDXLFile(mp, file_name,
+											 nullptr /*xsd_file_path*/));
 
-	CAutoRef<IMDCacheObjectArray> mdcache_obj_array;
-	mdcache_obj_array = CDXLUtils::ParseDXLToIMDObjectArray(
-		mp, dxl_file.Rgt(), nullptr /*xsd_file_path*/);
-
-	LoadMetadataObjectsFromArray(mp, mdcache_obj_array.Value());
+	LoadMetadataObjectsFromArray(mp,
+								 parse_handler_dxl->GetMdIdCachedObjArray());
 }
 
 //---------------------------------------------------------------------------
@@ -35,7 +35,8 @@ CMDRelationGPDB::CMDRelationGPDB(
 	Ereldistrpolicy rel_distr_policy, CMDColumnArray *mdcol_array,
 	ULongPtrArray *distr_col_array, IMdIdArray *distr_opfamilies,
 	ULongPtrArray *partition_cols_array, CharPtrArray *str_part_types_array,
-	IMdIdArray *partition_oids, BOOL convert_hash_to_random,
+	IMdIdArray *partition_oids, BOOL has_foreign_partitions,
+	BOOL partitions_match_root_cols, BOOL convert_hash_to_random,
 	ULongPtr2dArray *keyset_array, CMDIndexInfoArray *md_index_info_array,
 	IMdIdArray *mdid_check_constraint_array, CDXLNode *mdpart_constraint,
 	IMDId *foreign_server, CDouble rows)
@@ -54,6 +55,8 @@ CMDRelationGPDB::CMDRelationGPDB(
 	  m_partition_cols_array(partition_cols_array),
 	  m_str_part_types_array(str_part_types_array),
 	  m_partition_oids(partition_oids),
+	  m_has_foreign_partitions(has_foreign_partitions),
+	  m_partitions_match_root_cols(partitions_match_root_cols),
 	  m_keyset_array(keyset_array),
 	  m_mdindex_info_array(md_index_info_array),
 	  m_mdid_check_constraint_array(mdid_check_constraint_array),
@@ -681,6 +684,13 @@ CMDRelationGPDB::Serialize(CXMLSerializer *xml_serializer) const
 		xml_serializer->AddAttribute(
 			CDXLTokens::GetDXLTokenStr(EdxltokenPartKeys), part_keys_str_array);
 		GPOS_DELETE(part_keys_str_array);
+
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenRelForeignPartitions),
+			m_has_foreign_partitions);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenRelPartitionsMatchRootCols),
+			m_partitions_match_root_cols);
 	}
 
 	if (m_str_part_types_array)
@@ -796,6 +806,18 @@ CMDRelationGPDB::ChildPartitionMdids() const
 	return m_partition_oids;
 }
 
+BOOL
+CMDRelationGPDB::HasForeignPartitions() const
+{
+	return m_has_foreign_partitions;
+}
+
+BOOL
+CMDRelationGPDB::PartitionsMatchRootColumns() const
+{
+	return m_partitions_match_root_cols;
+}
+
 #ifdef GPOS_DEBUG
 //---------------------------------------------------------------------------
 //	@function:
@@ -132,7 +132,18 @@ CDXLOperatorFactory::MakeDXLHashJoin(CDXLMemoryManager *dxl_memory_manager,
 	EdxlJoinType join_type = ParseJoinType(
 		join_type_xml, CDXLTokens::GetDXLTokenStr(EdxltokenPhysicalHashJoin));
 
-	return GPOS_NEW(mp) CDXLPhysicalHashJoin(mp, join_type);
+	BOOL use_runtime_filter = false;
+
+	const XMLCh *runtime_filter_xml =
+		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenHashJoinRuntimeFilter));
+	if (nullptr != runtime_filter_xml)
+	{
+		use_runtime_filter = ConvertAttrValueToBool(
+			dxl_memory_manager, runtime_filter_xml,
+			EdxltokenHashJoinRuntimeFilter, EdxltokenPhysicalHashJoin);
+	}
+
+	return GPOS_NEW(mp) CDXLPhysicalHashJoin(mp, join_type, use_runtime_filter);
 }
 
 //---------------------------------------------------------------------------
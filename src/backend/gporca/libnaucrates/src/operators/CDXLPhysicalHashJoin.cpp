@@ -27,8 +27,9 @@ using namespace gpdxl;
 //
 //---------------------------------------------------------------------------
 CDXLPhysicalHashJoin::CDXLPhysicalHashJoin(CMemoryPool *mp,
-										   EdxlJoinType join_type)
-	: CDXLPhysicalJoin(mp, join_type)
+										   EdxlJoinType join_type,
+										   BOOL use_runtime_filter)
+	: CDXLPhysicalJoin(mp, join_type), m_use_runtime_filter(use_runtime_filter)
 {
 }
 
@@ -81,6 +82,14 @@ CDXLPhysicalHashJoin::SerializeToDXL(CXMLSerializer *xml_serializer,
 	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenJoinType),
 								 GetJoinTypeNameStr());
 
+	// only serialized when set, the attribute is optional
+	if (m_use_runtime_filter)
+	{
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenHashJoinRuntimeFilter),
+			m_use_runtime_filter);
+	}
+
 	// serialize properties
 	node->SerializePropertiesToDXL(xml_serializer);
 
@@ -47,6 +47,8 @@ CParseHandlerMDRelation::CParseHandlerMDRelation(
 	  m_convert_hash_to_random(false),
 	  m_partition_cols_array(nullptr),
 	  m_str_part_types_array(nullptr),
+	  m_has_foreign_partitions(true),
+	  m_partitions_match_root_cols(false),
 	  m_key_sets_arrays(nullptr),
 	  m_part_constraint(nullptr),
 	  m_opfamilies_parse_handler(nullptr),
@@ -195,6 +197,19 @@ CParseHandlerMDRelation::StartElement(const XMLCh *const element_uri,
 				EdxltokenPartTypes, EdxltokenRelation);
 	}
 
+	// properties of the leaf partitions; minidumps that predate them
+	// default to retrieving the leaf partitions
+	m_has_foreign_partitions =
+		CDXLOperatorFactory::ExtractConvertAttrValueToBool(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenRelForeignPartitions, EdxltokenRelation,
+			true /* is_optional */, true /* default_value */);
+	m_partitions_match_root_cols =
+		CDXLOperatorFactory::ExtractConvertAttrValueToBool(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenRelPartitionsMatchRootCols, EdxltokenRelation,
+			true /* is_optional */, false /* default_value */);
+
 	// parse whether a hash distributed relation needs to be considered as random distributed
 	const XMLCh *xmlszConvertHashToRandom =
 		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenConvertHashToRandom));
@@ -291,9 +306,10 @@ CParseHandlerMDRelation::EndElement(const XMLCh *const,	 // element_uri,
 		m_mp, m_mdid, m_mdname, m_is_temp_table, m_rel_storage_type,
 		m_rel_ao_version, m_rel_distr_policy, md_col_array, m_distr_col_array,
 		distr_opfamilies, m_partition_cols_array, m_str_part_types_array,
-		child_partitions, m_convert_hash_to_random, m_key_sets_arrays,
-		md_index_info_array, mdid_check_constraint_array, m_part_constraint,
-		m_foreign_server, m_rows);
+		child_partitions, m_has_foreign_partitions,
+		m_partitions_match_root_cols, m_convert_hash_to_random,
+		m_key_sets_arrays, md_index_info_array, mdid_check_constraint_array,
+		m_part_constraint, m_foreign_server, m_rows);
 
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
@@ -75,8 +75,7 @@ CParseHandlerManager::ActivateParseHandler(
 	GPOS_ASSERT(nullptr != parse_handler_base);
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetXMLReaderHandler();
 }
 
 //---------------------------------------------------------------------------
@@ -103,8 +102,7 @@ CParseHandlerManager::ReplaceHandler(CParseHandlerBase *parse_handler_base,
 	}
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	SetXMLReaderHandler();
 }
 
 
@@ -133,8 +131,7 @@ CParseHandlerManager::DeactivateHandler()
 		m_curr_parse_handler = nullptr;
 	}
 
-	m_xml_reader->setContentHandler(m_curr_parse_handler);
-	m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	SetXMLReaderHandler();
 }
 
 //---------------------------------------------------------------------------
@@ -151,6 +148,24 @@ CParseHandlerManager::GetCurrentParseHandler()
 	return m_curr_parse_handler;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerManager::SetXMLReaderHandler
+//
+//	@doc:
+//		Direct the events of the XML reader, if any, to the current handler
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerManager::SetXMLReaderHandler()
+{
+	if (nullptr != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(m_curr_parse_handler);
+		m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CParseHandlerManager::CheckForAborts
@@ -0,0 +1,508 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDoubleHistogram.cpp
+//
+//	@doc:
+//		Implementation of the flat representation of histogram bounds
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CDoubleHistogram.h"
+
+#include "naucrates/statistics/CStatistics.h"
+
+using namespace gpnaucrates;
+
+// number of buckets compared at a time when counting buckets
+#define GPNAUCRATES_DOUBLE_HISTOGRAM_BLOCK 8
+
+// largest magnitude up to which every LINT has an exact double
+#define GPNAUCRATES_DOUBLE_HISTOGRAM_MAX_LINT (LINT(1) << 53)
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::CDoubleHistogram
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDoubleHistogram::CDoubleHistogram(CMemoryPool *mp, ULONG num_buckets)
+	: m_mp(mp),
+	  m_num_buckets(num_buckets),
+	  m_lower(nullptr),
+	  m_upper(nullptr),
+	  m_is_lower_closed(nullptr),
+	  m_is_upper_closed(nullptr)
+{
+	GPOS_ASSERT(0 < num_buckets);
+
+	m_lower = GPOS_NEW_ARRAY(m_mp, DOUBLE, num_buckets);
+	m_upper = GPOS_NEW_ARRAY(m_mp, DOUBLE, num_buckets);
+	m_is_lower_closed = GPOS_NEW_ARRAY(m_mp, BOOL, num_buckets);
+	m_is_upper_closed = GPOS_NEW_ARRAY(m_mp, BOOL, num_buckets);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::~CDoubleHistogram
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDoubleHistogram::~CDoubleHistogram()
+{
+	GPOS_DELETE_ARRAY(m_lower);
+	GPOS_DELETE_ARRAY(m_upper);
+	GPOS_DELETE_ARRAY(m_is_lower_closed);
+	GPOS_DELETE_ARRAY(m_is_upper_closed);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::FMapPoint
+//
+//	@doc:
+//		Map the given point to a double. Two datums that both map to LINTs
+//		are compared as LINTs, all others as doubles, so a datum that maps
+//		to both can only be represented if the double is its exact LINT.
+//		Distinct LINTs are then at least 1 apart, which is more than the
+//		epsilon used to compare doubles.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::FMapPoint(const CPoint *point, DOUBLE *value)
+{
+	GPOS_ASSERT(nullptr != point);
+	GPOS_ASSERT(nullptr != value);
+
+	IDatum *datum = point->GetDatum();
+	if (datum->IsNull() || !datum->IsDatumMappableToDouble())
+	{
+		return false;
+	}
+
+	DOUBLE mapped = datum->GetDoubleMapping().Get();
+	if (datum->IsDatumMappableToLINT())
+	{
+		LINT lint = datum->GetLINTMapping();
+		if (GPNAUCRATES_DOUBLE_HISTOGRAM_MAX_LINT < lint ||
+			-GPNAUCRATES_DOUBLE_HISTOGRAM_MAX_LINT > lint ||
+			CDouble(lint).Get() != mapped)
+		{
+			return false;
+		}
+	}
+
+	*value = mapped;
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::Create
+//
+//	@doc:
+//		Flat histogram of the given buckets. Scanning the arrays relies on
+//		the bounds being sorted, histograms that are not are left to the
+//		generic code.
+//
+//---------------------------------------------------------------------------
+CDoubleHistogram *
+CDoubleHistogram::Create(CMemoryPool *mp, const CBucketArray *buckets)
+{
+	GPOS_ASSERT(nullptr != buckets);
+
+	const ULONG num_buckets = buckets->Size();
+	if (0 == num_buckets)
+	{
+		return nullptr;
+	}
+
+	CDoubleHistogram *histogram =
+		GPOS_NEW(mp) CDoubleHistogram(mp, num_buckets);
+	for (ULONG ul = 0; ul < num_buckets; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul];
+		DOUBLE *lower = &histogram->m_lower[ul];
+		DOUBLE *upper = &histogram->m_upper[ul];
+
+		if (!FMapPoint(bucket->GetLowerBound(), lower) ||
+			!FMapPoint(bucket->GetUpperBound(), upper) || *lower > *upper ||
+			(0 < ul && (*lower < histogram->m_lower[ul - 1] ||
+						*upper < histogram->m_upper[ul - 1])))
+		{
+			histogram->Release();
+			return nullptr;
+		}
+
+		histogram->m_is_lower_closed[ul] = bucket->IsLowerClosed();
+		histogram->m_is_upper_closed[ul] = bucket->IsUpperClosed();
+	}
+
+	return histogram;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::Equals
+//
+//	@doc:
+//		Equality of two mapped points
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::Equals(DOUBLE value1, DOUBLE value2)
+{
+	return fabs(value1 - value2) <= CStatistics::Epsilon.Get();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::IsLessThan
+//
+//	@doc:
+//		Less than of two mapped points
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::IsLessThan(DOUBLE value1, DOUBLE value2)
+{
+	return value2 - value1 > CStatistics::Epsilon.Get();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::IsSingleton
+//
+//	@doc:
+//		Is the bucket a singleton
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::IsSingleton(const SBucket &bucket)
+{
+	return Equals(bucket.m_lower, bucket.m_upper);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::Contains
+//
+//	@doc:
+//		Does the bucket contain the point
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::Contains(const SBucket &bucket, DOUBLE value)
+{
+	if (IsSingleton(bucket))
+	{
+		return Equals(bucket.m_lower, value);
+	}
+
+	if (bucket.m_is_lower_closed && Equals(bucket.m_lower, value))
+	{
+		return true;
+	}
+
+	if (bucket.m_is_upper_closed && Equals(bucket.m_upper, value))
+	{
+		return true;
+	}
+
+	return IsLessThan(bucket.m_lower, value) &&
+		   IsLessThan(value, bucket.m_upper);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::CompareBounds
+//
+//	@doc:
+//		Compare two lower or two upper bounds
+//
+//---------------------------------------------------------------------------
+INT
+CDoubleHistogram::CompareBounds(DOUBLE bound1, BOOL is_closed1, DOUBLE bound2,
+								BOOL is_closed2, INT closed_first)
+{
+	if (Equals(bound1, bound2))
+	{
+		if (is_closed1 == is_closed2)
+		{
+			return 0;
+		}
+
+		return is_closed1 ? closed_first : -closed_first;
+	}
+
+	if (IsLessThan(bound1, bound2))
+	{
+		return -1;
+	}
+
+	return 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::CompareLowerBounds
+//
+//	@doc:
+//		Compare the lower bounds of two buckets; a closed lower bound is
+//		less than an open one at the same point
+//
+//---------------------------------------------------------------------------
+INT
+CDoubleHistogram::CompareLowerBounds(const SBucket &bucket1,
+									 const SBucket &bucket2)
+{
+	return CompareBounds(bucket1.m_lower, bucket1.m_is_lower_closed,
+						 bucket2.m_lower, bucket2.m_is_lower_closed,
+						 -1 /*closed_first*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::CompareUpperBounds
+//
+//	@doc:
+//		Compare the upper bounds of two buckets; a closed upper bound is
+//		greater than an open one at the same point
+//
+//---------------------------------------------------------------------------
+INT
+CDoubleHistogram::CompareUpperBounds(const SBucket &bucket1,
+									 const SBucket &bucket2)
+{
+	return CompareBounds(bucket1.m_upper, bucket1.m_is_upper_closed,
+						 bucket2.m_upper, bucket2.m_is_upper_closed,
+						 1 /*closed_first*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::CompareLowerBoundToUpperBound
+//
+//	@doc:
+//		Compare the lower bound of the first bucket to the upper bound of
+//		the second one
+//
+//---------------------------------------------------------------------------
+INT
+CDoubleHistogram::CompareLowerBoundToUpperBound(const SBucket &bucket1,
+												const SBucket &bucket2)
+{
+	if (IsLessThan(bucket2.m_upper, bucket1.m_lower))
+	{
+		return 1;
+	}
+
+	if (IsLessThan(bucket1.m_lower, bucket2.m_upper))
+	{
+		return -1;
+	}
+
+	if (bucket1.m_is_lower_closed && bucket2.m_is_upper_closed)
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::Subsumes
+//
+//	@doc:
+//		Does the first bucket subsume the second one
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::Subsumes(const SBucket &bucket1, const SBucket &bucket2)
+{
+	if (IsSingleton(bucket2))
+	{
+		if (IsSingleton(bucket1))
+		{
+			return Equals(bucket1.m_lower, bucket2.m_lower);
+		}
+
+		return Contains(bucket1, bucket2.m_lower);
+	}
+
+	return 0 >= CompareLowerBounds(bucket1, bucket2) &&
+		   0 <= CompareUpperBounds(bucket1, bucket2);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::Intersects
+//
+//	@doc:
+//		Do the buckets intersect
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::Intersects(const SBucket &bucket1, const SBucket &bucket2)
+{
+	if (IsSingleton(bucket1) && IsSingleton(bucket2))
+	{
+		return Equals(bucket1.m_lower, bucket2.m_lower);
+	}
+
+	if (IsSingleton(bucket1))
+	{
+		return Contains(bucket2, bucket1.m_lower);
+	}
+
+	if (IsSingleton(bucket2))
+	{
+		return Contains(bucket1, bucket2.m_lower);
+	}
+
+	if (Subsumes(bucket1, bucket2) || Subsumes(bucket2, bucket1))
+	{
+		return true;
+	}
+
+	if (0 >= CompareLowerBounds(bucket1, bucket2))
+	{
+		// the first bucket starts before the second one
+		return 0 >= CompareLowerBoundToUpperBound(bucket2, bucket1);
+	}
+
+	return 0 >= CompareLowerBoundToUpperBound(bucket1, bucket2);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::IsBefore
+//
+//	@doc:
+//		Does the first bucket occur before the second one
+//
+//---------------------------------------------------------------------------
+BOOL
+CDoubleHistogram::IsBefore(const SBucket &bucket1, const SBucket &bucket2)
+{
+	if (Intersects(bucket1, bucket2))
+	{
+		return false;
+	}
+
+	return IsLessThan(bucket1.m_upper, bucket2.m_lower) ||
+		   Equals(bucket1.m_upper, bucket2.m_lower);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::CountBucketsBefore
+//
+//	@doc:
+//		Number of consecutive buckets, starting at the given one, whose
+//		upper bound is less than the given point. Since upper bounds are
+//		sorted, these are all buckets of a block that satisfy the
+//		predicate; blocks are counted without branches, so that the
+//		compiler can vectorize the comparisons.
+//
+//---------------------------------------------------------------------------
+ULONG
+CDoubleHistogram::CountBucketsBefore(ULONG begin, DOUBLE value) const
+{
+	GPOS_ASSERT(begin <= m_num_buckets);
+
+	const DOUBLE epsilon = CStatistics::Epsilon.Get();
+	const DOUBLE *upper = m_upper;
+	ULONG pos = begin;
+
+	while (pos + GPNAUCRATES_DOUBLE_HISTOGRAM_BLOCK <= m_num_buckets)
+	{
+		ULONG count = 0;
+		for (ULONG ul = 0; ul < GPNAUCRATES_DOUBLE_HISTOGRAM_BLOCK; ul++)
+		{
+			count += (value - upper[pos + ul] > epsilon);
+		}
+
+		pos += count;
+		if (GPNAUCRATES_DOUBLE_HISTOGRAM_BLOCK > count)
+		{
+			return pos - begin;
+		}
+	}
+
+	while (pos < m_num_buckets && value - upper[pos] > epsilon)
+	{
+		pos++;
+	}
+
+	return pos - begin;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::FindFirstUpperNotLess
+//
+//	@doc:
+//		Binary search for the first bucket whose upper bound is not less
+//		than the given point; buckets before it cannot contain the point
+//
+//---------------------------------------------------------------------------
+ULONG
+CDoubleHistogram::FindFirstUpperNotLess(DOUBLE value) const
+{
+	ULONG low = 0;
+	ULONG high = m_num_buckets;
+	while (low < high)
+	{
+		ULONG mid = low + (high - low) / 2;
+		if (IsLessThan(m_upper[mid], value))
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDoubleHistogram::FindFirstLowerGreater
+//
+//	@doc:
+//		Binary search for the first bucket whose lower bound is greater
+//		than the given point; neither it nor any bucket after it can
+//		contain the point
+//
+//---------------------------------------------------------------------------
+ULONG
+CDoubleHistogram::FindFirstLowerGreater(DOUBLE value) const
+{
+	ULONG low = 0;
+	ULONG high = m_num_buckets;
+	while (low < high)
+	{
+		ULONG mid = low + (high - low) / 2;
+		if (IsLessThan(value, m_lower[mid]))
+		{
+			high = mid;
+		}
+		else
+		{
+			low = mid + 1;
+		}
+	}
+
+	return low;
+}
+
+// EOF
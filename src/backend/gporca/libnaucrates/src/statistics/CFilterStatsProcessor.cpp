@@ -823,7 +823,12 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 
 	// First, de-duplicate the constants in the array list
 	CPointArray *points = pred_stats->GetPoints();
-	if (points->Size() > 1)
+	BOOL is_sorted = true;
+	for (ULONG ul = 1; ul < points->Size() && is_sorted; ++ul)
+	{
+		is_sorted = (*points)[ul - 1]->IsLessThan((*points)[ul]);
+	}
+	if (!is_sorted)
 	{
 		points->Sort(&CUtils::CPointCmp);
 	}
@@ -862,15 +867,15 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 		CBucket *bucket = (*dummy_histogram_buckets)[bucket_iter];
 		bucket->SetFrequency(CDouble(0.0));
 		bucket->SetDistinct(CDouble(0.0));
-		ULONG ndv = 0;
 
-		// ignore datums that are before the bucket, add it to ndv_remain
-		while (point_iter < deduped_points->Size() &&
-			   bucket->IsBefore((*deduped_points)[point_iter]))
-		{
-			ndv_remain++;
-			point_iter++;
-		}
+		// ignore datums that are before the bucket, add them to ndv_remain;
+		// with long IN lists, most points are skipped, so they are searched
+		// for rather than visited one by one
+		ULONG first_point =
+			FindFirstPoint(bucket, deduped_points, point_iter, false);
+		ndv_remain += first_point - point_iter;
+		point_iter = first_point;
+
 		// if the point is after the bucket, move to the next bucket
 		if (point_iter >= deduped_points->Size() ||
 			bucket->IsAfter((*deduped_points)[point_iter]))
@@ -879,12 +884,10 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 		}
 
 		// count the number of points that map to the current bucket
-		while (point_iter < deduped_points->Size() &&
-			   bucket->Contains((*deduped_points)[point_iter]))
-		{
-			ndv++;
-			point_iter++;
-		}
+		ULONG end_point =
+			FindFirstPoint(bucket, deduped_points, point_iter, true);
+		ULONG ndv = end_point - point_iter;
+		point_iter = end_point;
 
 		// set frequency based on matched points
 		bucket->SetFrequency(CDouble(ndv) / dummy_rows);
@@ -939,6 +942,38 @@ CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp,
 	return result_histogram;
 }
 
+// position of the first of the given sorted points, starting at the given
+// position, that is not before the bucket, or that is after it
+ULONG
+CFilterStatsProcessor::FindFirstPoint(const CBucket *bucket,
+									  const CPointArray *points, ULONG start,
+									  BOOL is_after)
+{
+	GPOS_ASSERT(nullptr != bucket);
+	GPOS_ASSERT(nullptr != points);
+
+	// points before the bucket, or not after it, form a prefix
+	ULONG low = start;
+	ULONG high = points->Size();
+	while (low < high)
+	{
+		ULONG mid = low + (high - low) / 2;
+		const CPoint *point = (*points)[mid];
+		BOOL is_prefix =
+			is_after ? !bucket->IsAfter(point) : bucket->IsBefore(point);
+		if (is_prefix)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
 // check if the column is a new column for statistic calculation
 BOOL
 CFilterStatsProcessor::IsNewStatsColumn(ULONG colid, ULONG last_colid)
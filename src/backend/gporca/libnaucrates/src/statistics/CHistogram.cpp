@@ -62,7 +62,9 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_double_histogram(nullptr),
+	  m_double_histogram_built(false)
 {
 	GPOS_ASSERT(nullptr != histogram_buckets);
 }
@@ -78,7 +80,9 @@ CHistogram::CHistogram(CMemoryPool *mp, BOOL is_well_defined)
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_double_histogram(nullptr),
+	  m_double_histogram_built(false)
 {
 	m_histogram_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 }
@@ -97,7 +101,9 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_double_histogram(nullptr),
+	  m_double_histogram_built(false)
 {
 	GPOS_ASSERT(m_histogram_buckets);
 	// FIXME: These assertions are sometimes hit and is indicitive of a bug, but
@@ -302,10 +308,11 @@ CHistogram::MakeBucketsWithEqualityFilter(CPoint *point) const
 		return histogram_buckets;
 	}
 
-	const ULONG num_buckets = m_histogram_buckets->Size();
-	ULONG bucket_index = 0;
+	ULONG begin = 0;
+	ULONG end = 0;
+	GetCandidateBuckets(point, &begin, &end);
 
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	for (ULONG bucket_index = begin; bucket_index < end; bucket_index++)
 	{
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 
@@ -405,9 +412,12 @@ CHistogram::MakeHistogramGreaterThanOrGreaterThanEqualFilter(
 	CBucketArray *new_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	const ULONG num_buckets = m_histogram_buckets->Size();
 
-	// find first bucket that contains point
+	// find first bucket that contains point, buckets before the candidate
+	// buckets neither contain it nor lie after it
 	ULONG bucket_index = 0;
-	for (bucket_index = 0; bucket_index < num_buckets; bucket_index++)
+	ULONG end = 0;
+	GetCandidateBuckets(point, &bucket_index, &end);
+	for (; bucket_index < num_buckets; bucket_index++)
 	{
 		CBucket *bucket = (*m_histogram_buckets)[bucket_index];
 		if (bucket->IsBefore(point))
@@ -1026,6 +1036,14 @@ CHistogram::CopyHistogram() const
 		histogram_copy->SetNDVScaled();
 	}
 
+	// the copy shares the buckets and therefore their bounds
+	if (nullptr != m_double_histogram)
+	{
+		m_double_histogram->AddRef();
+	}
+	histogram_copy->m_double_histogram = m_double_histogram;
+	histogram_copy->m_double_histogram_built = m_double_histogram_built;
+
 	return histogram_copy;
 }
 
@@ -1110,13 +1128,37 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 		return MakeNDVBasedJoinHistogramEqualityFilter(histogram);
 	}
 
+	// if both histograms have flat bounds, walk them instead of the buckets
+	// and skip runs of buckets that end before the other side's bucket
+	const CDoubleHistogram *double_histogram1 = GetDoubleHistogram();
+	const CDoubleHistogram *double_histogram2 =
+		histogram->GetDoubleHistogram();
+	const BOOL is_flat =
+		nullptr != double_histogram1 && nullptr != double_histogram2;
+
 	CBucketArray *join_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
 		CBucket *bucket1 = (*m_histogram_buckets)[idx1];
 		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
 
-		if (bucket1->Intersects(bucket2))
+		CDoubleHistogram::SBucket flat_bucket1{};
+		CDoubleHistogram::SBucket flat_bucket2{};
+		BOOL intersects = false;
+		if (is_flat)
+		{
+			flat_bucket1 = double_histogram1->GetBucket(idx1);
+			flat_bucket2 = double_histogram2->GetBucket(idx2);
+			intersects =
+				CDoubleHistogram::Intersects(flat_bucket1, flat_bucket2);
+			GPOS_ASSERT(intersects == bucket1->Intersects(bucket2));
+		}
+		else
+		{
+			intersects = bucket1->Intersects(bucket2);
+		}
+
+		if (intersects)
 		{
 			CDouble freq_intersect1(0.0);
 			CDouble freq_intersect2(0.0);
@@ -1128,7 +1170,10 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 			hist1_buckets_freq = hist1_buckets_freq + freq_intersect1;
 			hist2_buckets_freq = hist2_buckets_freq + freq_intersect2;
 
-			INT res = CBucket::CompareUpperBounds(bucket1, bucket2);
+			INT res = is_flat ? CDoubleHistogram::CompareUpperBounds(
+									flat_bucket1, flat_bucket2)
+							  : CBucket::CompareUpperBounds(bucket1, bucket2);
+			GPOS_ASSERT(res == CBucket::CompareUpperBounds(bucket1, bucket2));
 			if (0 == res)
 			{
 				// both ubs are equal
@@ -1145,15 +1190,29 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 				idx2++;
 			}
 		}
-		else if (bucket1->IsBefore(bucket2))
+		else if (is_flat
+					 ? CDoubleHistogram::IsBefore(flat_bucket1, flat_bucket2)
+					 : bucket1->IsBefore(bucket2))
 		{
-			// buckets do not intersect there one bucket is before the other
+			// buckets do not intersect there one bucket is before the other,
+			// and so may be the buckets following it
+			GPOS_ASSERT(bucket1->IsBefore(bucket2));
 			idx1++;
+			if (is_flat)
+			{
+				idx1 += double_histogram1->CountBucketsBefore(
+					idx1, flat_bucket2.m_lower);
+			}
 		}
 		else
 		{
 			GPOS_ASSERT(bucket2->IsBefore(bucket1));
 			idx2++;
+			if (is_flat)
+			{
+				idx2 += double_histogram2->CountBucketsBefore(
+					idx2, flat_bucket1.m_lower);
+			}
 		}
 	}
 
@@ -1454,6 +1513,12 @@ CHistogram::MakeUnionAllHistogramNormalize(CDouble rows,
 				bucket1->MakeBucketUpdateFrequency(m_mp, rows, rows_new));
 			CleanupResidualBucket(bucket1, bucket1_is_residual);
 			idx1++;
+
+			// add the following buckets that end before bucket2 as well
+			ULONG end = idx1 + CountBucketsBefore(idx1, bucket2);
+			AddBuckets(m_mp, m_histogram_buckets, new_buckets, rows, rows_new,
+					   idx1, end);
+			idx1 = end;
 			bucket1 = (*this)[idx1];
 			bucket1_is_residual = false;
 		}
@@ -1463,6 +1528,12 @@ CHistogram::MakeUnionAllHistogramNormalize(CDouble rows,
 				bucket2->MakeBucketUpdateFrequency(m_mp, rows_other, rows_new));
 			CleanupResidualBucket(bucket2, bucket2_is_residual);
 			idx2++;
+
+			// add the following buckets that end before bucket1 as well
+			ULONG end = idx2 + histogram->CountBucketsBefore(idx2, bucket1);
+			AddBuckets(m_mp, histogram->m_histogram_buckets, new_buckets,
+					   rows_other, rows_new, idx2, end);
+			idx2 = end;
 			bucket2 = (*histogram)[idx2];
 			bucket2_is_residual = false;
 		}
@@ -1845,6 +1916,12 @@ CHistogram::MakeUnionHistogramNormalize(CDouble rows,
 				GPOS_NEW(m_mp) CDouble(bucket1->GetFrequency() * rows));
 			CleanupResidualBucket(bucket1, bucket1_is_residual);
 			idx1++;
+
+			// add the following buckets that end before bucket2 as well
+			ULONG end = idx1 + CountBucketsBefore(idx1, bucket2);
+			AddBuckets(m_mp, m_histogram_buckets, histogram_buckets, rows,
+					   num_tuples_per_bucket, idx1, end);
+			idx1 = end;
 			bucket1 = (*this)[idx1];
 			bucket1_is_residual = false;
 		}
@@ -1855,6 +1932,14 @@ CHistogram::MakeUnionHistogramNormalize(CDouble rows,
 				GPOS_NEW(m_mp) CDouble(bucket2->GetFrequency() * rows_other));
 			CleanupResidualBucket(bucket2, bucket2_is_residual);
 			idx2++;
+
+			// add the following buckets that end before bucket1 as well
+			ULONG end =
+				idx2 + other_histogram->CountBucketsBefore(idx2, bucket1);
+			AddBuckets(m_mp, other_histogram->m_histogram_buckets,
+					   histogram_buckets, rows_other, num_tuples_per_bucket,
+					   idx2, end);
+			idx2 = end;
 			bucket2 = (*other_histogram)[idx2];
 			bucket2_is_residual = false;
 		}
@@ -2010,6 +2095,60 @@ CHistogram::AddBuckets(CMemoryPool *mp, const CBucketArray *src_buckets,
 	}
 }
 
+// flat representation of the bucket bounds, nullptr if the bounds do not
+// map to doubles; the bounds of the buckets never change, so it is built
+// only once
+const CDoubleHistogram *
+CHistogram::GetDoubleHistogram() const
+{
+	if (!m_double_histogram_built)
+	{
+		m_double_histogram =
+			CDoubleHistogram::Create(m_mp, m_histogram_buckets);
+		m_double_histogram_built = true;
+	}
+
+	return m_double_histogram;
+}
+
+// range [begin, end) of buckets that may contain the given point, found by
+// binary search over the flat bounds; all buckets if there are none
+void
+CHistogram::GetCandidateBuckets(const CPoint *point, ULONG *begin,
+								ULONG *end) const
+{
+	*begin = 0;
+	*end = GetNumBuckets();
+
+	const CDoubleHistogram *double_histogram = GetDoubleHistogram();
+	DOUBLE value = 0.0;
+	if (nullptr != double_histogram &&
+		CDoubleHistogram::FMapPoint(point, &value))
+	{
+		*begin = double_histogram->FindFirstUpperNotLess(value);
+		*end = double_histogram->FindFirstLowerGreater(value);
+	}
+
+	GPOS_ASSERT(*begin <= *end);
+}
+
+// number of consecutive buckets, starting at the given one, that end before
+// the lower bound of the given bucket; each of them is before the bucket as
+// per CBucket::IsBefore
+ULONG
+CHistogram::CountBucketsBefore(ULONG begin, const CBucket *bucket) const
+{
+	const CDoubleHistogram *double_histogram = GetDoubleHistogram();
+	DOUBLE value = 0.0;
+	if (nullptr == double_histogram ||
+		!CDoubleHistogram::FMapPoint(bucket->GetLowerBound(), &value))
+	{
+		return 0;
+	}
+
+	return double_histogram->CountBucketsBefore(begin, value);
+}
+
 // accessor for n-th bucket. Returns NULL if outside bounds
 CBucket *
 CHistogram::operator[](ULONG pos) const
@@ -0,0 +1,573 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryReader.cpp
+//
+//	@doc:
+//		Implementation of the binary DXL reader
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/util/XMLString.hpp>
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/CStack.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/xml/CDXLMemoryManager.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/exception.h"
+
+using namespace gpdxl;
+
+// raise an error about a malformed document
+#define GPDXL_RAISE_BINARY(szDetail) \
+	GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLBinaryParseError, szDetail)
+
+// empty string
+static const XMLCh xmlstrEmpty[] = {0};
+
+// attribute type reported for all attributes
+static const XMLCh xmlstrCDATA[] = {'C', 'D', 'A', 'T', 'A', 0};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryAttributes
+//
+//	@doc:
+//		Attributes of an element of a binary DXL document; attribute i is
+//		described by the words 3i (local name), 3i+1 (qname) and 3i+2 (value)
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryAttributes : public Attributes
+{
+private:
+	// string table
+	const XMLCh *const *m_rgxmlstr;
+
+	// attribute words
+	const ULONG *m_rgulAttrs;
+
+	// number of attributes
+	ULONG m_ulAttrs;
+
+	// string at the given word of the given attribute
+	const XMLCh *
+	Xmlstr(XMLSize_t index, ULONG ulWord) const
+	{
+		if (index >= m_ulAttrs)
+		{
+			return nullptr;
+		}
+
+		return m_rgxmlstr[m_rgulAttrs[3 * index + ulWord]];
+	}
+
+public:
+	CDXLBinaryAttributes(const CDXLBinaryAttributes &) = delete;
+
+	// ctor
+	CDXLBinaryAttributes(const XMLCh *const *rgxmlstr, const ULONG *rgulAttrs,
+						 ULONG ulAttrs)
+		: m_rgxmlstr(rgxmlstr), m_rgulAttrs(rgulAttrs), m_ulAttrs(ulAttrs)
+	{
+	}
+
+	XMLSize_t
+	getLength() const override
+	{
+		return m_ulAttrs;
+	}
+
+	const XMLCh *
+	getURI(const XMLSize_t index) const override
+	{
+		return index < m_ulAttrs ? xmlstrEmpty : nullptr;
+	}
+
+	const XMLCh *
+	getLocalName(const XMLSize_t index) const override
+	{
+		return Xmlstr(index, 0);
+	}
+
+	const XMLCh *
+	getQName(const XMLSize_t index) const override
+	{
+		return Xmlstr(index, 1);
+	}
+
+	const XMLCh *
+	getType(const XMLSize_t index) const override
+	{
+		return index < m_ulAttrs ? xmlstrCDATA : nullptr;
+	}
+
+	const XMLCh *
+	getValue(const XMLSize_t index) const override
+	{
+		return Xmlstr(index, 2);
+	}
+
+	bool
+	getIndex(const XMLCh *const,  // uri
+			 const XMLCh *const localPart, XMLSize_t &index) const override
+	{
+		for (index = 0; index < m_ulAttrs; index++)
+		{
+			if (XMLString::equals(localPart, getLocalName(index)))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	int
+	getIndex(const XMLCh *const uri,
+			 const XMLCh *const localPart) const override
+	{
+		XMLSize_t index;
+		return getIndex(uri, localPart, index) ? (int) index : -1;
+	}
+
+	bool
+	getIndex(const XMLCh *const qName, XMLSize_t &index) const override
+	{
+		for (index = 0; index < m_ulAttrs; index++)
+		{
+			if (XMLString::equals(qName, getQName(index)))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	int
+	getIndex(const XMLCh *const qName) const override
+	{
+		XMLSize_t index;
+		return getIndex(qName, index) ? (int) index : -1;
+	}
+
+	const XMLCh *
+	getType(const XMLCh *const uri,
+			const XMLCh *const localPart) const override
+	{
+		XMLSize_t index;
+		return getIndex(uri, localPart, index) ? getType(index) : nullptr;
+	}
+
+	const XMLCh *
+	getType(const XMLCh *const qName) const override
+	{
+		XMLSize_t index;
+		return getIndex(qName, index) ? getType(index) : nullptr;
+	}
+
+	const XMLCh *
+	getValue(const XMLCh *const uri,
+			 const XMLCh *const localPart) const override
+	{
+		XMLSize_t index;
+		return getIndex(uri, localPart, index) ? getValue(index) : nullptr;
+	}
+
+	const XMLCh *
+	getValue(const XMLCh *const qName) const override
+	{
+		XMLSize_t index;
+		return getIndex(qName, index) ? getValue(index) : nullptr;
+	}
+};	// class CDXLBinaryAttributes
+
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryXMLHandler
+//
+//	@doc:
+//		SAX handler writing the events it receives as XML
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryXMLHandler : public DefaultHandler
+{
+private:
+	// memory manager used for transcoding
+	CDXLMemoryManager *m_memory_manager;
+
+	// serializer
+	CXMLSerializer *m_xml_serializer;
+
+	// qnames of open elements
+	CStack<CWStringDynamic> m_strstackElems;
+
+	// attribute names and values of the namespace declarations of the next
+	// element
+	StringPtrArray *m_pdrgpstrNamespaces;
+
+	// transcode the given string
+	CWStringDynamic *
+	Pstr(const XMLCh *xmlstr) const
+	{
+		return CDXLUtils::CreateDynamicStringFromXMLChArray(m_memory_manager,
+															xmlstr);
+	}
+
+public:
+	CDXLBinaryXMLHandler(const CDXLBinaryXMLHandler &) = delete;
+
+	// ctor
+	CDXLBinaryXMLHandler(CDXLMemoryManager *memory_manager,
+						 CXMLSerializer *xml_serializer)
+		: m_memory_manager(memory_manager),
+		  m_xml_serializer(xml_serializer),
+		  m_strstackElems(memory_manager->Pmp()),
+		  m_pdrgpstrNamespaces(GPOS_NEW(memory_manager->Pmp())
+								   StringPtrArray(memory_manager->Pmp()))
+	{
+	}
+
+	// dtor
+	~CDXLBinaryXMLHandler() override
+	{
+		while (!m_strstackElems.IsEmpty())
+		{
+			GPOS_DELETE(m_strstackElems.Pop());
+		}
+
+		m_pdrgpstrNamespaces->Release();
+	}
+
+	void
+	startPrefixMapping(const XMLCh *const prefix,
+					   const XMLCh *const uri) override
+	{
+		// remember the declaration until its element is open
+		CWStringDynamic *pstrName = GPOS_NEW(m_memory_manager->Pmp())
+			CWStringDynamic(m_memory_manager->Pmp(), GPOS_WSZ_LIT("xmlns"));
+		if (0 < XMLString::stringLen(prefix))
+		{
+			CAutoP<CWStringDynamic> a_pstrPrefix(Pstr(prefix));
+			pstrName->AppendFormat(GPOS_WSZ_LIT(":%ls"),
+								   a_pstrPrefix->GetBuffer());
+		}
+
+		m_pdrgpstrNamespaces->Append(pstrName);
+		m_pdrgpstrNamespaces->Append(Pstr(uri));
+	}
+
+	void
+	startElement(const XMLCh *const,  // element_uri
+				 const XMLCh *const,  // element_local_name
+				 const XMLCh *const element_qname,
+				 const Attributes &attrs) override
+	{
+		CWStringDynamic *pstrQName = Pstr(element_qname);
+		m_strstackElems.Push(pstrQName);
+		m_xml_serializer->OpenElement(nullptr, pstrQName);
+
+		for (ULONG ul = 0; ul < m_pdrgpstrNamespaces->Size(); ul += 2)
+		{
+			m_xml_serializer->AddAttribute((*m_pdrgpstrNamespaces)[ul],
+										   (*m_pdrgpstrNamespaces)[ul + 1]);
+		}
+		m_pdrgpstrNamespaces->Clear();
+
+		for (XMLSize_t ul = 0; ul < attrs.getLength(); ul++)
+		{
+			CAutoP<CWStringDynamic> a_pstrName(Pstr(attrs.getQName(ul)));
+			CAutoP<CWStringDynamic> a_pstrValue(Pstr(attrs.getValue(ul)));
+			m_xml_serializer->AddAttribute(a_pstrName.Value(),
+										   a_pstrValue.Value());
+		}
+	}
+
+	void
+	endElement(const XMLCh *const,	// element_uri
+			   const XMLCh *const,	// element_local_name
+			   const XMLCh *const	// element_qname
+			   ) override
+	{
+		CWStringDynamic *pstrQName = m_strstackElems.Pop();
+		m_xml_serializer->CloseElement(nullptr, pstrQName);
+		GPOS_DELETE(pstrQName);
+	}
+};	// class CDXLBinaryXMLHandler
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CDXLBinaryReader
+//
+//	@doc:
+//		Ctor; validates the header and indexes the string table
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::CDXLBinaryReader(CMemoryPool *mp, const BYTE *pb,
+								   ULONG_PTR size)
+	: m_mp(mp),
+	  m_pb(pb),
+	  m_size(size),
+	  m_rgxmlstr(nullptr),
+	  m_ulStrings(0),
+	  m_rgulEvents(nullptr),
+	  m_ulEventWords(0)
+{
+	GPOS_ASSERT(nullptr != pb);
+
+	if (!CDXLBinaryFormat::FBinaryDXL(pb, size))
+	{
+		GPDXL_RAISE_BINARY("missing header");
+	}
+
+	CDXLBinaryFormat::SHeader header;
+	clib::Memcpy(&header, pb, GPOS_SIZEOF(header));
+
+	if (CDXLBinaryFormat::usByteOrder != header.m_usByteOrder)
+	{
+		GPDXL_RAISE_BINARY("unsupported byte order");
+	}
+
+	if (CDXLBinaryFormat::usVersion != header.m_usVersion)
+	{
+		GPDXL_RAISE_BINARY("unsupported version");
+	}
+
+	const ULONG_PTR ulpStringsStart = GPOS_SIZEOF(header);
+	const ULONG_PTR ulpEventsStart = ulpStringsStart + header.m_ulStringBytes;
+	if (ulpEventsStart > size ||
+		(size - ulpEventsStart) / GPOS_SIZEOF(ULONG) < header.m_ulEventWords)
+	{
+		GPDXL_RAISE_BINARY("truncated document");
+	}
+
+	// index the string table
+	CAutoRg<const XMLCh *> a_rgxmlstr(
+		GPOS_NEW_ARRAY(mp, const XMLCh *, header.m_ulStrings + 1));
+	ULONG_PTR ulpPos = ulpStringsStart;
+	for (ULONG ul = 0; ul < header.m_ulStrings; ul++)
+	{
+		if (ulpEventsStart - ulpPos < GPOS_SIZEOF(ULONG))
+		{
+			GPDXL_RAISE_BINARY("truncated string table");
+		}
+
+		ULONG ulLength;
+		clib::Memcpy(&ulLength, pb + ulpPos, GPOS_SIZEOF(ULONG));
+
+		const XMLCh *xmlstr =
+			reinterpret_cast<const XMLCh *>(pb + ulpPos + GPOS_SIZEOF(ULONG));
+		if ((ulpEventsStart - ulpPos - GPOS_SIZEOF(ULONG)) /
+					GPOS_SIZEOF(XMLCh) <=
+				ulLength ||
+			0 != xmlstr[ulLength])
+		{
+			GPDXL_RAISE_BINARY("malformed string table");
+		}
+
+		a_rgxmlstr[ul] = xmlstr;
+		ulpPos += CDXLBinaryFormat::UlStringEntryBytes(ulLength);
+	}
+
+	if (ulpPos != ulpEventsStart)
+	{
+		GPDXL_RAISE_BINARY("malformed string table");
+	}
+
+	m_rgxmlstr = a_rgxmlstr.RgtReset();
+	m_ulStrings = header.m_ulStrings;
+	m_rgulEvents = reinterpret_cast<const ULONG *>(pb + ulpEventsStart);
+	m_ulEventWords = header.m_ulEventWords;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::~CDXLBinaryReader
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::~CDXLBinaryReader()
+{
+	GPOS_DELETE_ARRAY(m_rgxmlstr);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Xmlstr
+//
+//	@doc:
+//		String at the given position of the string table
+//
+//---------------------------------------------------------------------------
+const XMLCh *
+CDXLBinaryReader::Xmlstr(ULONG ulPos) const
+{
+	if (ulPos >= m_ulStrings)
+	{
+		GPDXL_RAISE_BINARY("invalid string reference");
+	}
+
+	return m_rgxmlstr[ulPos];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Replay
+//
+//	@doc:
+//		Replay the events into the current handler of the given parse
+//		handler manager or, if that is nullptr, into the given handler
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Replay(CParseHandlerManager *parse_handler_mgr,
+						 DefaultHandler *handler)
+{
+	GPOS_ASSERT((nullptr == parse_handler_mgr) != (nullptr == handler));
+
+	// start events of open elements
+	CStack<const ULONG> stackStart(m_mp);
+
+	ULONG ulPos = 0;
+	while (ulPos < m_ulEventWords)
+	{
+		const ULONG *pulEvent = m_rgulEvents + ulPos;
+		const ULONG ulWords = m_ulEventWords - ulPos;
+
+		if (nullptr != parse_handler_mgr)
+		{
+			handler = parse_handler_mgr->GetContentHandler();
+			if (nullptr == handler)
+			{
+				GPDXL_RAISE_BINARY("events after the end of the document");
+			}
+		}
+
+		switch (pulEvent[0])
+		{
+			case CDXLBinaryFormat::EevStartElement:
+			{
+				if (5 > ulWords || (ulWords - 5) / 3 < pulEvent[4])
+				{
+					GPDXL_RAISE_BINARY("truncated element");
+				}
+
+				const ULONG ulAttrs = pulEvent[4];
+				for (ULONG ul = 0; ul < 3 * ulAttrs; ul++)
+				{
+					(void) Xmlstr(pulEvent[5 + ul]);
+				}
+
+				CDXLBinaryAttributes attrs(m_rgxmlstr, pulEvent + 5, ulAttrs);
+				handler->startElement(Xmlstr(pulEvent[1]), Xmlstr(pulEvent[2]),
+									  Xmlstr(pulEvent[3]), attrs);
+
+				stackStart.Push(pulEvent);
+				ulPos += 5 + 3 * ulAttrs;
+				break;
+			}
+
+			case CDXLBinaryFormat::EevEndElement:
+			{
+				if (stackStart.IsEmpty())
+				{
+					GPDXL_RAISE_BINARY("unbalanced element");
+				}
+
+				const ULONG *pulStart = stackStart.Pop();
+				handler->endElement(m_rgxmlstr[pulStart[1]],
+									m_rgxmlstr[pulStart[2]],
+									m_rgxmlstr[pulStart[3]]);
+				ulPos++;
+				break;
+			}
+
+			case CDXLBinaryFormat::EevPrefixMapping:
+			{
+				if (3 > ulWords)
+				{
+					GPDXL_RAISE_BINARY("truncated namespace declaration");
+				}
+
+				handler->startPrefixMapping(Xmlstr(pulEvent[1]),
+											Xmlstr(pulEvent[2]));
+				ulPos += 3;
+				break;
+			}
+
+			default:
+				GPDXL_RAISE_BINARY("unknown event");
+		}
+	}
+
+	if (!stackStart.IsEmpty())
+	{
+		GPDXL_RAISE_BINARY("unbalanced element");
+	}
+
+	if (nullptr != parse_handler_mgr)
+	{
+		handler = parse_handler_mgr->GetContentHandler();
+	}
+
+	if (nullptr != handler)
+	{
+		handler->endDocument();
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Parse
+//
+//	@doc:
+//		Replay the document into the parse handlers of the given manager
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Parse(CParseHandlerManager *parse_handler_mgr)
+{
+	GPOS_ASSERT(nullptr != parse_handler_mgr);
+
+	Replay(parse_handler_mgr, nullptr /*handler*/);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Serialize
+//
+//	@doc:
+//		Write the document as XML
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Serialize(CXMLSerializer *xml_serializer)
+{
+	GPOS_ASSERT(nullptr != xml_serializer);
+
+	CDXLMemoryManager memory_manager(m_mp);
+	CDXLBinaryXMLHandler handler(&memory_manager, xml_serializer);
+
+	xml_serializer->StartDocument();
+	Replay(nullptr /*parse_handler_mgr*/, &handler);
+}
+
+// EOF
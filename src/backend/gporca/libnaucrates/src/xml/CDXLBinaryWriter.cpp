@@ -0,0 +1,284 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryWriter.cpp
+//
+//	@doc:
+//		Implementation of the binary DXL writer
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+#include "gpos/common/COpenHashMapIter.h"
+
+using namespace gpdxl;
+
+// initial capacity of the event stream
+#define GPDXL_BINARY_EVENTS_INIT 1024
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::HashValue
+//
+//	@doc:
+//		Hash function for strings
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryWriter::HashValue(const XMLCh *xmlstr)
+{
+	return gpos::HashByteArray(
+		(const BYTE *) xmlstr,
+		(ULONG) XMLString::stringLen(xmlstr) * GPOS_SIZEOF(XMLCh));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::Equals
+//
+//	@doc:
+//		Equality function for strings
+//
+//---------------------------------------------------------------------------
+BOOL
+CDXLBinaryWriter::Equals(const XMLCh *xmlstrFst, const XMLCh *xmlstrSnd)
+{
+	return XMLString::equals(xmlstrFst, xmlstrSnd);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::CDXLBinaryWriter
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::CDXLBinaryWriter(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_phmstrpos(GPOS_NEW(mp) StringToPosMap(mp)),
+	  m_ulStringBytes(0),
+	  m_rgulEvents(GPOS_NEW_ARRAY(mp, ULONG, GPDXL_BINARY_EVENTS_INIT)),
+	  m_ulEventWords(0),
+	  m_ulEventCapacity(GPDXL_BINARY_EVENTS_INIT)
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::~CDXLBinaryWriter
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::~CDXLBinaryWriter()
+{
+	m_phmstrpos->Release();
+	GPOS_DELETE_ARRAY(m_rgulEvents);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::UlIntern
+//
+//	@doc:
+//		Position of the given string in the string table; adds the string
+//		to the table if it is not there yet
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryWriter::UlIntern(const XMLCh *xmlstr)
+{
+	GPOS_ASSERT(nullptr != xmlstr);
+
+	ULONG *pulPos = m_phmstrpos->Find(xmlstr);
+	if (nullptr != pulPos)
+	{
+		return *pulPos;
+	}
+
+	const ULONG ulLength = (ULONG) XMLString::stringLen(xmlstr);
+	XMLCh *xmlstrCopy = GPOS_NEW_ARRAY(m_mp, XMLCh, ulLength + 1);
+	clib::Memcpy(xmlstrCopy, xmlstr, (ulLength + 1) * GPOS_SIZEOF(XMLCh));
+
+	const ULONG ulPos = m_phmstrpos->Size();
+	BOOL fInserted GPOS_ASSERTS_ONLY =
+		m_phmstrpos->Insert(xmlstrCopy, GPOS_NEW(m_mp) ULONG(ulPos));
+	GPOS_ASSERT(fInserted);
+
+	m_ulStringBytes += CDXLBinaryFormat::UlStringEntryBytes(ulLength);
+
+	return ulPos;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::AppendEvent
+//
+//	@doc:
+//		Append a word to the event stream
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::AppendEvent(ULONG ul)
+{
+	if (m_ulEventWords == m_ulEventCapacity)
+	{
+		ULONG *rgulEvents = GPOS_NEW_ARRAY(m_mp, ULONG, 2 * m_ulEventCapacity);
+		clib::Memcpy(rgulEvents, m_rgulEvents,
+					 m_ulEventWords * GPOS_SIZEOF(ULONG));
+		GPOS_DELETE_ARRAY(m_rgulEvents);
+
+		m_rgulEvents = rgulEvents;
+		m_ulEventCapacity *= 2;
+	}
+
+	m_rgulEvents[m_ulEventWords++] = ul;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::startElement
+//
+//	@doc:
+//		Encode the start of an element
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::startElement(const XMLCh *const element_uri,
+							   const XMLCh *const element_local_name,
+							   const XMLCh *const element_qname,
+							   const Attributes &attrs)
+{
+	const ULONG ulAttrs = (ULONG) attrs.getLength();
+
+	AppendEvent(CDXLBinaryFormat::EevStartElement);
+	AppendEvent(UlIntern(element_uri));
+	AppendEvent(UlIntern(element_local_name));
+	AppendEvent(UlIntern(element_qname));
+	AppendEvent(ulAttrs);
+
+	for (ULONG ul = 0; ul < ulAttrs; ul++)
+	{
+		AppendEvent(UlIntern(attrs.getLocalName(ul)));
+		AppendEvent(UlIntern(attrs.getQName(ul)));
+		AppendEvent(UlIntern(attrs.getValue(ul)));
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::endElement
+//
+//	@doc:
+//		Encode the end of an element; the names of the element are implied
+//		by the matching start event
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::endElement(const XMLCh *const,  // element_uri
+							 const XMLCh *const,  // element_local_name
+							 const XMLCh *const	  // element_qname
+)
+{
+	AppendEvent(CDXLBinaryFormat::EevEndElement);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::startPrefixMapping
+//
+//	@doc:
+//		Encode a namespace declaration
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::startPrefixMapping(const XMLCh *const prefix,
+									 const XMLCh *const uri)
+{
+	AppendEvent(CDXLBinaryFormat::EevPrefixMapping);
+	AppendEvent(UlIntern(prefix));
+	AppendEvent(UlIntern(uri));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::Size
+//
+//	@doc:
+//		Size of the binary document in bytes
+//
+//---------------------------------------------------------------------------
+ULONG_PTR
+CDXLBinaryWriter::Size() const
+{
+	return GPOS_SIZEOF(CDXLBinaryFormat::SHeader) + m_ulStringBytes +
+		   (ULONG_PTR) m_ulEventWords * GPOS_SIZEOF(ULONG);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::Serialize
+//
+//	@doc:
+//		Write the binary document into the given buffer of Size() bytes
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::Serialize(BYTE *pb) const
+{
+	GPOS_ASSERT(nullptr != pb);
+
+	CDXLBinaryFormat::SHeader header;
+	clib::Memcpy(header.m_rgchMagic, CDXLBinaryFormat::szMagic,
+				 GPOS_SIZEOF(header.m_rgchMagic));
+	header.m_usVersion = CDXLBinaryFormat::usVersion;
+	header.m_usByteOrder = CDXLBinaryFormat::usByteOrder;
+	header.m_ulStrings = m_phmstrpos->Size();
+	header.m_ulStringBytes = m_ulStringBytes;
+	header.m_ulEventWords = m_ulEventWords;
+
+	clib::Memcpy(pb, &header, GPOS_SIZEOF(header));
+	pb += GPOS_SIZEOF(header);
+
+	// string table, in the order the strings were interned
+	COpenHashMapIter<XMLCh, ULONG, HashValue, Equals, CleanupDeleteArray<XMLCh>,
+					 CleanupDelete<ULONG>>
+		hmiter(m_phmstrpos);
+	while (hmiter.Advance())
+	{
+		const XMLCh *xmlstr = hmiter.Key();
+		const ULONG ulLength = (ULONG) XMLString::stringLen(xmlstr);
+		const ULONG ulEntryBytes =
+			CDXLBinaryFormat::UlStringEntryBytes(ulLength);
+
+		clib::Memset(pb, 0, ulEntryBytes);
+		clib::Memcpy(pb, &ulLength, GPOS_SIZEOF(ULONG));
+		clib::Memcpy(pb + GPOS_SIZEOF(ULONG), xmlstr,
+					 (ulLength + 1) * GPOS_SIZEOF(XMLCh));
+		pb += ulEntryBytes;
+	}
+
+	if (0 < m_ulEventWords)
+	{
+		clib::Memcpy(pb, m_rgulEvents, m_ulEventWords * GPOS_SIZEOF(ULONG));
+	}
+}
+
+// EOF
@@ -92,6 +92,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("PushGroupByBelowSetopThreshold")},
 		{EdxltokenXformBindThreshold, GPOS_WSZ_LIT("XformBindThreshold")},
 		{EdxltokenSkewFactor, GPOS_WSZ_LIT("SkewFactor")},
+		{EdxltokenPlanningDeadline, GPOS_WSZ_LIT("PlanningDeadline")},
 		{EdxltokenWindowOids, GPOS_WSZ_LIT("WindowOids")},
 		{EdxltokenOidRowNumber, GPOS_WSZ_LIT("RowNumber")},
 		{EdxltokenOidRank, GPOS_WSZ_LIT("Rank")},
@@ -300,6 +301,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 
 		{EdxltokenMergeJoinUniqueOuter, GPOS_WSZ_LIT("UniqueOuter")},
 
+		{EdxltokenHashJoinRuntimeFilter, GPOS_WSZ_LIT("RuntimeFilter")},
+
 		{EdxltokenWindowLeadingBoundary, GPOS_WSZ_LIT("LeadingBoundary")},
 		{EdxltokenWindowTrailingBoundary, GPOS_WSZ_LIT("TrailingBoundary")},
 		{EdxltokenWindowBoundaryUnboundedPreceding,
@@ -568,6 +571,9 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenRelDistrOpclass, GPOS_WSZ_LIT("DistrOpclass")},
 
 		{EdxltokenRelForeignServer, GPOS_WSZ_LIT("ForeignServer")},
+		{EdxltokenRelForeignPartitions, GPOS_WSZ_LIT("ForeignPartitions")},
+		{EdxltokenRelPartitionsMatchRootCols,
+		 GPOS_WSZ_LIT("PartitionsMatchRootColumns")},
 		{EdxltokenForeignServerOid, GPOS_WSZ_LIT("ForeignServerOid")},
 		{EdxltokenKeys, GPOS_WSZ_LIT("Keys")},
 		{EdxltokenDistrColumns, GPOS_WSZ_LIT("DistributionColumns")},
@@ -0,0 +1,499 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMinidumpBenchmark.cpp
+//
+//	@doc:
+//		Implementation of the minidump benchmark
+//---------------------------------------------------------------------------
+
+#include "CMinidumpBenchmark.h"
+
+#include <sys/stat.h>
+
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/io/CFileWriter.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/string/CWStringDynamic.h"
+#include "gpos/task/CAutoTraceFlag.h"
+
+#include "gpopt/engine/COptimizationProfile.h"
+#include "gpopt/minidump/CDXLMinidump.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/traceflags/traceflags.h"
+#include "unittest/base.h"
+
+using namespace gpopt;
+
+// names of the metrics, indexed by EMetric; also the keys in result files
+static const CHAR *rgszMetric[] = {
+	"load_us",
+	"optimize_us",
+	"peak_memory_bytes",
+	"memo_groups",
+	"memo_group_exprs",
+	"jobs",
+	"job_steps",
+};
+
+GPOS_CPL_ASSERT(CMinidumpBenchmark::EmSentinel ==
+					GPOS_ARRAY_SIZE(rgszMetric),
+				"metric name array does not match metrics");
+
+// key of the minidump file name in result files
+#define GPOPT_BENCH_MINIDUMP_KEY "minidump"
+
+// comparator for sorting time measurements
+static INT
+IULLongCmp(const void *pvFst, const void *pvSnd)
+{
+	const ULLONG ullFst = *(const ULLONG *) pvFst;
+	const ULLONG ullSnd = *(const ULLONG *) pvSnd;
+
+	return (ullFst > ullSnd) - (ullFst < ullSnd);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::CMinidumpBenchmark
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::CMinidumpBenchmark(CMemoryPool *mp, ULONG ulIterations)
+	: m_mp(mp),
+	  m_ulIterations(ulIterations),
+	  m_pdrgpres(GPOS_NEW(mp) SResultArray(mp))
+{
+	GPOS_ASSERT(0 < ulIterations);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::~CMinidumpBenchmark
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::~CMinidumpBenchmark()
+{
+	m_pdrgpres->Release();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::SzMetric
+//
+//	@doc:
+//		Name of the given metric
+//
+//---------------------------------------------------------------------------
+const CHAR *
+CMinidumpBenchmark::SzMetric(ULONG em)
+{
+	GPOS_ASSERT(em < EmSentinel);
+
+	return rgszMetric[em];
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::RunOnce
+//
+//	@doc:
+//		Optimize the given minidump once and record the measurements. The
+//		minidump is loaded into a separate memory pool, so that the peak
+//		memory only accounts for the optimization itself.
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::RunOnce(const CHAR *szMinidump, ULLONG *rgullMetric)
+{
+	CAutoMemoryPool ampLoad;
+	CMemoryPool *pmpLoad = ampLoad.Pmp();
+
+	CWallClock clock;
+	CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(pmpLoad, szMinidump);
+	rgullMetric[EmLoadTime] = clock.ElapsedUS();
+
+	COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+	if (nullptr == optimizer_config)
+	{
+		optimizer_config = COptimizerConfig::PoconfDefault(pmpLoad);
+	}
+	else
+	{
+		optimizer_config->AddRef();
+	}
+
+	// same number of segments as gporca_test uses for minidumps
+	ULONG ulSegments = GPOPT_TEST_SEGMENTS;
+	if (nullptr != optimizer_config->GetCostModel())
+	{
+		ulSegments =
+			std::max(ulSegments, optimizer_config->GetCostModel()->UlHosts());
+	}
+
+	{
+		CAutoMemoryPool ampOptimize;
+		CMemoryPool *mp = ampOptimize.Pmp();
+
+		// the profile provides the memo and job counters
+		CAutoTraceFlag atf(EopttraceProfileOptimization, true /*value*/);
+
+		clock.Restart();
+		CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+			mp, pdxlmd, szMinidump, ulSegments, 1 /*ulSessionId*/,
+			1 /*ulCmdId*/, optimizer_config, nullptr /*pceeval*/);
+		rgullMetric[EmOptimizeTime] = clock.ElapsedUS();
+		rgullMetric[EmPeakMemory] = mp->PeakAllocatedSize();
+
+		const COptimizationProfile *profile = optimizer_config->GetProfile();
+		if (nullptr != profile)
+		{
+			rgullMetric[EmMemoGroups] = profile->UlMemoGroups();
+			rgullMetric[EmMemoGroupExprs] = profile->UlMemoGroupExprs();
+			rgullMetric[EmJobs] = 0;
+			rgullMetric[EmJobSteps] = 0;
+			for (ULONG ul = 0; ul < CJob::EjtSentinel; ul++)
+			{
+				rgullMetric[EmJobs] += profile->Job(ul).m_ulCompleted;
+				rgullMetric[EmJobSteps] += profile->Job(ul).m_ulCalls;
+			}
+		}
+
+		// the profile was allocated from the optimizer memory pool
+		optimizer_config->SetProfile(nullptr);
+		pdxlnPlan->Release();
+	}
+
+	optimizer_config->Release();
+	GPOS_DELETE(pdxlmd);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::Run
+//
+//	@doc:
+//		Run the given minidump; time measurements are the median over all
+//		iterations, the peak memory is the maximum, and the search counters
+//		are deterministic
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::Run(const CHAR *szMinidump)
+{
+	GPOS_ASSERT(nullptr != szMinidump);
+
+	SResult *pres = GPOS_NEW(m_mp) SResult(szMinidump);
+	m_pdrgpres->Append(pres);
+
+	CAutoRg<ULLONG> a_rgullLoad(GPOS_NEW_ARRAY(m_mp, ULLONG, m_ulIterations));
+	CAutoRg<ULLONG> a_rgullOptimize(
+		GPOS_NEW_ARRAY(m_mp, ULLONG, m_ulIterations));
+
+	for (ULONG ul = 0; ul < m_ulIterations; ul++)
+	{
+		ULLONG rgullMetric[EmSentinel];
+		RunOnce(szMinidump, rgullMetric);
+
+		a_rgullLoad[ul] = rgullMetric[EmLoadTime];
+		a_rgullOptimize[ul] = rgullMetric[EmOptimizeTime];
+		for (ULONG em = EmPeakMemory; em < EmSentinel; em++)
+		{
+			pres->m_rgullMetric[em] =
+				std::max(pres->m_rgullMetric[em], rgullMetric[em]);
+		}
+	}
+
+	clib::Qsort(a_rgullLoad.Rgt(), m_ulIterations, GPOS_SIZEOF(ULLONG),
+				IULLongCmp);
+	clib::Qsort(a_rgullOptimize.Rgt(), m_ulIterations, GPOS_SIZEOF(ULLONG),
+				IULLongCmp);
+	pres->m_rgullMetric[EmLoadTime] = a_rgullLoad[m_ulIterations / 2];
+	pres->m_rgullMetric[EmOptimizeTime] = a_rgullOptimize[m_ulIterations / 2];
+
+	CAutoTrace at(m_mp);
+	at.Os() << "[BENCH]: " << szMinidump;
+	for (ULONG em = 0; em < EmSentinel; em++)
+	{
+		at.Os() << ", " << SzMetric(em) << " " << pres->m_rgullMetric[em];
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::OsPrint
+//
+//	@doc:
+//		Print the results as JSON, one minidump per line
+//
+//---------------------------------------------------------------------------
+IOstream &
+CMinidumpBenchmark::OsPrint(IOstream &os) const
+{
+	os << "{" << std::endl
+	   << "  \"iterations\": " << m_ulIterations << "," << std::endl
+	   << "  \"minidumps\": [" << std::endl;
+
+	const ULONG ulResults = m_pdrgpres->Size();
+	for (ULONG ul = 0; ul < ulResults; ul++)
+	{
+		const SResult *pres = (*m_pdrgpres)[ul];
+
+		// minidump file names are paths and need no escaping beyond these
+		os << "    {\"" GPOPT_BENCH_MINIDUMP_KEY "\": \"";
+		for (const CHAR *pch = pres->m_szMinidump; '\0' != *pch; pch++)
+		{
+			if ('"' == *pch || '\\' == *pch)
+			{
+				os << '\\';
+			}
+			os << *pch;
+		}
+		os << "\"";
+
+		for (ULONG em = 0; em < EmSentinel; em++)
+		{
+			os << ", \"" << SzMetric(em) << "\": " << pres->m_rgullMetric[em];
+		}
+		os << "}" << (ul + 1 < ulResults ? "," : "") << std::endl;
+	}
+
+	os << "  ]" << std::endl << "}" << std::endl;
+
+	return os;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::Write
+//
+//	@doc:
+//		Write the results as JSON into the given file
+//
+//---------------------------------------------------------------------------
+void
+CMinidumpBenchmark::Write(const CHAR *szFileName) const
+{
+	CWStringDynamic str(m_mp);
+	COstreamString oss(&str);
+	OsPrint(oss);
+
+	CAutoRg<CHAR> a_sz(CDXLUtils::CreateMultiByteCharStringFromWCString(
+		m_mp, str.GetBuffer()));
+
+	CFileWriter fw;
+	fw.Open(szFileName, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	fw.Write(reinterpret_cast<const BYTE *>(a_sz.Rgt()),
+			 clib::Strlen(a_sz.Rgt()));
+	fw.Close();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::FReadMetric
+//
+//	@doc:
+//		Value of the given key in the given line of a result file
+//
+//---------------------------------------------------------------------------
+BOOL
+CMinidumpBenchmark::FReadMetric(const CHAR *szLine, const CHAR *szKey,
+								ULLONG *pull)
+{
+	const ULONG ulKeyLength = clib::Strlen(szKey);
+
+	for (const CHAR *pch = clib::Strchr(szLine, '"'); nullptr != pch;
+		 pch = clib::Strchr(pch + 1, '"'))
+	{
+		if (0 == clib::Strncmp(pch + 1, szKey, ulKeyLength) &&
+			'"' == pch[ulKeyLength + 1] && ':' == pch[ulKeyLength + 2])
+		{
+			*pull = (ULLONG) clib::Strtoll(pch + ulKeyLength + 3,
+										   nullptr /*end*/, 10 /*base*/);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::PdrgpresParse
+//
+//	@doc:
+//		Parse the results held in the given result file contents, as
+//		written by Write(); minidump names are terminated in place
+//
+//---------------------------------------------------------------------------
+CMinidumpBenchmark::SResultArray *
+CMinidumpBenchmark::PdrgpresParse(CMemoryPool *mp, CHAR *szResults)
+{
+	GPOS_ASSERT(nullptr != szResults);
+
+	SResultArray *pdrgpres = GPOS_NEW(mp) SResultArray(mp);
+	const CHAR *szPrefix = "{\"" GPOPT_BENCH_MINIDUMP_KEY "\": \"";
+	const ULONG ulPrefixLength = clib::Strlen(szPrefix);
+
+	CHAR *szLine = szResults;
+	while (nullptr != szLine && '\0' != *szLine)
+	{
+		CHAR *szNext = clib::Strchr(szLine, '\n');
+		if (nullptr != szNext)
+		{
+			*szNext++ = '\0';
+		}
+
+		CHAR *pch = szLine;
+		while (' ' == *pch)
+		{
+			pch++;
+		}
+
+		if (0 == clib::Strncmp(pch, szPrefix, ulPrefixLength))
+		{
+			// unescape and terminate the minidump name in place
+			CHAR *szMinidump = pch + ulPrefixLength;
+			CHAR *pchRead = szMinidump;
+			CHAR *pchWrite = szMinidump;
+			while ('\0' != *pchRead && '"' != *pchRead)
+			{
+				if ('\\' == *pchRead && '\0' != pchRead[1])
+				{
+					pchRead++;
+				}
+				*pchWrite++ = *pchRead++;
+			}
+			const CHAR *szMetrics = pchRead;
+			*pchWrite = '\0';
+
+			SResult *pres = GPOS_NEW(mp) SResult(szMinidump);
+			for (ULONG em = 0; em < EmSentinel; em++)
+			{
+				(void) FReadMetric(szMetrics, SzMetric(em),
+								   &pres->m_rgullMetric[em]);
+			}
+			pdrgpres->Append(pres);
+		}
+
+		szLine = szNext;
+	}
+
+	return pdrgpres;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::PresFind
+//
+//	@doc:
+//		Result of the given minidump, nullptr if there is none
+//
+//---------------------------------------------------------------------------
+const CMinidumpBenchmark::SResult *
+CMinidumpBenchmark::PresFind(const SResultArray *pdrgpres,
+							 const CHAR *szMinidump)
+{
+	for (ULONG ul = 0; ul < pdrgpres->Size(); ul++)
+	{
+		const SResult *pres = (*pdrgpres)[ul];
+		if (0 == clib::Strcmp(pres->m_szMinidump, szMinidump))
+		{
+			return pres;
+		}
+	}
+
+	return nullptr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMinidumpBenchmark::UlCompare
+//
+//	@doc:
+//		Report the metrics of the current results that exceed the baseline
+//		by more than the given percentage and return their number.
+//		Minidumps missing from the baseline are reported but do not count
+//		as regressions.
+//
+//---------------------------------------------------------------------------
+ULONG
+CMinidumpBenchmark::UlCompare(const SResultArray *pdrgpresBaseline,
+							  const SResultArray *pdrgpresCurrent,
+							  DOUBLE dThresholdPct, ULLONG ullNoiseFloorUS)
+{
+	GPOS_ASSERT(0 <= dThresholdPct);
+
+	CAutoTrace at(ITask::Self()->Pmp());
+	IOstream &os = at.Os();
+
+	ULONG ulRegressions = 0;
+	for (ULONG ul = 0; ul < pdrgpresCurrent->Size(); ul++)
+	{
+		const SResult *pres = (*pdrgpresCurrent)[ul];
+		const SResult *presBaseline =
+			PresFind(pdrgpresBaseline, pres->m_szMinidump);
+		if (nullptr == presBaseline)
+		{
+			os << "[BENCH]: " << pres->m_szMinidump << ": no baseline"
+			   << std::endl;
+			continue;
+		}
+
+		for (ULONG em = 0; em < EmSentinel; em++)
+		{
+			const ULLONG ullBaseline = presBaseline->m_rgullMetric[em];
+			const ULLONG ullCurrent = pres->m_rgullMetric[em];
+			const BOOL fTime = (EmLoadTime == em || EmOptimizeTime == em);
+
+			if (ullCurrent <= ullBaseline ||
+				(DOUBLE) ullCurrent <=
+					(DOUBLE) ullBaseline * (1.0 + dThresholdPct / 100.0) ||
+				(fTime && ullCurrent - ullBaseline < ullNoiseFloorUS))
+			{
+				continue;
+			}
+
+			ulRegressions++;
+			os << "[BENCH]: REGRESSION " << pres->m_szMinidump << ": "
+			   << SzMetric(em) << " " << ullBaseline << " -> " << ullCurrent;
+			if (0 < ullBaseline)
+			{
+				os << " (+"
+				   << (ULLONG)((ullCurrent - ullBaseline) * 100 / ullBaseline)
+				   << "%)";
+			}
+			os << std::endl;
+		}
+	}
+
+	os << "[BENCH]: " << ulRegressions << " regression(s) above "
+	   << dThresholdPct << "% in " << pdrgpresCurrent->Size()
+	   << " minidump(s)";
+
+	return ulRegressions;
+}
+
+// EOF
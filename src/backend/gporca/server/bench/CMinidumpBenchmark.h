@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CMinidumpBenchmark.h
+//
+//	@doc:
+//		Benchmark replaying minidumps through the optimizer
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CMinidumpBenchmark_H
+#define GPOPT_CMinidumpBenchmark_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMinidumpBenchmark
+//
+//	@doc:
+//		Replays minidumps through CMinidumperUtils::PdxlnExecuteMinidump
+//		and records, per minidump, the load and optimization time, the peak
+//		size of the optimizer memory pool and the size of the search as
+//		reported by the optimization profile.
+//
+//		Results are written as JSON, one minidump per line, so that a
+//		result file can be read back and compared against a baseline
+//		without a JSON library.
+//
+//---------------------------------------------------------------------------
+class CMinidumpBenchmark
+{
+public:
+	// measurements taken per minidump
+	enum EMetric
+	{
+		EmLoadTime = 0,		  // time to load the minidump in microseconds
+		EmOptimizeTime,		  // time to optimize the query in microseconds
+		EmPeakMemory,		  // peak size of the optimizer memory pool
+		EmMemoGroups,		  // groups in the final memo
+		EmMemoGroupExprs,	  // group expressions in the final memo
+		EmJobs,				  // completed optimization jobs
+		EmJobSteps,			  // executed optimization job steps
+
+		EmSentinel
+	};
+
+	// result of one minidump
+	struct SResult
+	{
+		// file name of the minidump
+		const CHAR *m_szMinidump;
+
+		// measurements, indexed by EMetric
+		ULLONG m_rgullMetric[EmSentinel];
+
+		// ctor
+		explicit SResult(const CHAR *szMinidump) : m_szMinidump(szMinidump)
+		{
+			for (ULONG ul = 0; ul < EmSentinel; ul++)
+			{
+				m_rgullMetric[ul] = 0;
+			}
+		}
+	};
+
+	using SResultArray = CDynamicPtrArray<SResult, CleanupDelete>;
+
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of times each minidump is optimized
+	ULONG m_ulIterations;
+
+	// results in the order the minidumps were run
+	SResultArray *m_pdrgpres;
+
+	// optimize the given minidump once and record the measurements
+	static void RunOnce(const CHAR *szMinidump, ULLONG *rgullMetric);
+
+	// result of the given minidump, nullptr if there is none
+	static const SResult *PresFind(const SResultArray *pdrgpres,
+								   const CHAR *szMinidump);
+
+	// value of the given key in the given line of a result file
+	static BOOL FReadMetric(const CHAR *szLine, const CHAR *szKey,
+							ULLONG *pull);
+
+public:
+	CMinidumpBenchmark(const CMinidumpBenchmark &) = delete;
+
+	// ctor
+	CMinidumpBenchmark(CMemoryPool *mp, ULONG ulIterations);
+
+	// dtor
+	~CMinidumpBenchmark();
+
+	// results collected so far
+	const SResultArray *
+	Pdrgpres() const
+	{
+		return m_pdrgpres;
+	}
+
+	// run the given minidump; time measurements are the median over all
+	// iterations
+	void Run(const CHAR *szMinidump);
+
+	// print the results as JSON
+	IOstream &OsPrint(IOstream &os) const;
+
+	// write the results as JSON into the given file
+	void Write(const CHAR *szFileName) const;
+
+	// name of the given metric
+	static const CHAR *SzMetric(ULONG em);
+
+	// parse the results held in the given result file contents; the
+	// buffer is modified in place and has to outlive the results
+	static SResultArray *PdrgpresParse(CMemoryPool *mp, CHAR *szResults);
+
+	// report the metrics of the current results that exceed the baseline
+	// by more than the given percentage; time differences below the given
+	// noise floor are ignored; returns the number of regressions
+	static ULONG UlCompare(const SResultArray *pdrgpresBaseline,
+						   const SResultArray *pdrgpresCurrent,
+						   DOUBLE dThresholdPct, ULLONG ullNoiseFloorUS);
+
+};	// class CMinidumpBenchmark
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CMinidumpBenchmark_H
+
+// EOF
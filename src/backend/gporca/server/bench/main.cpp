@@ -0,0 +1,281 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		main.cpp
+//
+//	@doc:
+//		Driver of the gporca_bench minidump benchmark.
+//
+//		gporca_bench [-n iterations] [-o results.json]
+//					 (-d minidump | -f minidump-list)...
+//					 [-b baseline.json [-t percent] [-m microseconds]]
+//
+//		gporca_bench -r results.json -b baseline.json [-t percent]
+//					 [-m microseconds]
+//
+//		The first form optimizes the given minidumps and writes the results
+//		as JSON; a minidump list names one minidump per line, lines starting
+//		with '#' are ignored. The second form only compares a result file
+//		against a baseline. With a baseline, every metric that exceeds its
+//		baseline by more than the threshold percentage (default 10) counts
+//		as a regression, time differences below the noise floor (default
+//		1000us) excepted, and the exit status is non-zero if there is one.
+//---------------------------------------------------------------------------
+
+#include "gpos/_api.h"
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/common/CMainArgs.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+
+#include "CMinidumpBenchmark.h"
+#include "gpopt/init.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/init.h"
+
+using namespace gpos;
+using namespace gpopt;
+using namespace gpdxl;
+
+// file names given on the command line
+using ArgArray = CDynamicPtrArray<CHAR, CleanupNULL>;
+
+// buffers holding the files read
+using BufferArray = CDynamicPtrArray<CHAR, CleanupDeleteArray>;
+
+// default number of times each minidump is optimized
+#define GPOPT_BENCH_ITERATIONS 3
+
+// default regression threshold in percent
+#define GPOPT_BENCH_THRESHOLD_PCT 10.0
+
+// default noise floor of time measurements in microseconds
+#define GPOPT_BENCH_NOISE_FLOOR_US 1000
+
+// number of regressions found, or 1 if the arguments are invalid; PvExec
+// overwrites it
+static ULONG regressions = 0;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		RunList
+//
+//	@doc:
+//		Run the minidumps named in the given list file
+//
+//---------------------------------------------------------------------------
+static void
+RunList(CMinidumpBenchmark *pbench, CHAR *szList)
+{
+	CHAR *szLine = szList;
+	while (nullptr != szLine && '\0' != *szLine)
+	{
+		CHAR *szNext = clib::Strchr(szLine, '\n');
+		if (nullptr != szNext)
+		{
+			*szNext++ = '\0';
+		}
+
+		if ('#' != *szLine && '\0' != *szLine)
+		{
+			pbench->Run(szLine);
+		}
+
+		szLine = szNext;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PvExec
+//
+//	@doc:
+//		Function driving execution
+//
+//---------------------------------------------------------------------------
+static void *
+PvExec(void *pv)
+{
+	CMainArgs *pma = (CMainArgs *) pv;
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// arguments are collected first, so that -n applies to all minidumps
+	CAutoRef<ArgArray> a_pdrgpszMinidump(GPOS_NEW(mp) ArgArray(mp));
+	CAutoRef<ArgArray> a_pdrgpszList(GPOS_NEW(mp) ArgArray(mp));
+
+	ULONG ulIterations = GPOPT_BENCH_ITERATIONS;
+	DOUBLE dThresholdPct = GPOPT_BENCH_THRESHOLD_PCT;
+	ULLONG ullNoiseFloorUS = GPOPT_BENCH_NOISE_FLOOR_US;
+	const CHAR *szOutput = nullptr;
+	const CHAR *szBaseline = nullptr;
+	const CHAR *szResults = nullptr;
+
+	CHAR ch = '\0';
+	while (pma->Getopt(&ch))
+	{
+		switch (ch)
+		{
+			case 'd':
+				a_pdrgpszMinidump->Append(optarg);
+				break;
+
+			case 'f':
+				a_pdrgpszList->Append(optarg);
+				break;
+
+			case 'n':
+				ulIterations = (ULONG) clib::Strtol(optarg, nullptr, 10);
+				break;
+
+			case 'o':
+				szOutput = optarg;
+				break;
+
+			case 'b':
+				szBaseline = optarg;
+				break;
+
+			case 'r':
+				szResults = optarg;
+				break;
+
+			case 't':
+				dThresholdPct = clib::Strtod(optarg);
+				break;
+
+			case 'm':
+				ullNoiseFloorUS = (ULLONG) clib::Strtoll(optarg, nullptr, 10);
+				break;
+
+			default:
+				// ignore other parameters
+				break;
+		}
+	}
+
+	const ULONG ulMinidumps =
+		a_pdrgpszMinidump->Size() + a_pdrgpszList->Size();
+
+	regressions = 1;
+	if (0 == ulIterations || (0 == ulMinidumps && nullptr == szResults) ||
+		(0 < ulMinidumps && nullptr != szResults) ||
+		(nullptr != szResults && nullptr == szBaseline))
+	{
+		GPOS_TRACE(GPOS_WSZ_LIT(
+			"Usage: gporca_bench [-n iterations] [-o results.json] "
+			"(-d minidump | -f minidump-list)... [-b baseline.json "
+			"[-t percent] [-m microseconds]] | -r results.json "
+			"-b baseline.json [-t percent] [-m microseconds]"));
+		return nullptr;
+	}
+
+	// minidump names of the results point into these buffers
+	CAutoRef<BufferArray> a_pdrgpszBuffers(GPOS_NEW(mp) BufferArray(mp));
+
+	CMinidumpBenchmark bench(mp, ulIterations);
+	CMinidumpBenchmark::SResultArray *pdrgpresCurrent = nullptr;
+
+	if (nullptr != szResults)
+	{
+		CHAR *szBuffer = CDXLUtils::Read(mp, szResults);
+		a_pdrgpszBuffers->Append(szBuffer);
+		pdrgpresCurrent = CMinidumpBenchmark::PdrgpresParse(mp, szBuffer);
+	}
+	else
+	{
+		InitDXL();
+		CMDCache::Init();
+
+		for (ULONG ul = 0; ul < a_pdrgpszMinidump->Size(); ul++)
+		{
+			bench.Run((*a_pdrgpszMinidump)[ul]);
+		}
+
+		for (ULONG ul = 0; ul < a_pdrgpszList->Size(); ul++)
+		{
+			CHAR *szList = CDXLUtils::Read(mp, (*a_pdrgpszList)[ul]);
+			a_pdrgpszBuffers->Append(szList);
+			RunList(&bench, szList);
+		}
+
+		CMDCache::Shutdown();
+
+		if (nullptr != szOutput)
+		{
+			bench.Write(szOutput);
+		}
+		else
+		{
+			CAutoTrace at(mp);
+			bench.OsPrint(at.Os());
+		}
+
+		pdrgpresCurrent =
+			const_cast<CMinidumpBenchmark::SResultArray *>(bench.Pdrgpres());
+		pdrgpresCurrent->AddRef();
+	}
+
+	regressions = 0;
+	if (nullptr != szBaseline)
+	{
+		CHAR *szBuffer = CDXLUtils::Read(mp, szBaseline);
+		a_pdrgpszBuffers->Append(szBuffer);
+		CMinidumpBenchmark::SResultArray *pdrgpresBaseline =
+			CMinidumpBenchmark::PdrgpresParse(mp, szBuffer);
+
+		regressions = CMinidumpBenchmark::UlCompare(
+			pdrgpresBaseline, pdrgpresCurrent, dThresholdPct, ullNoiseFloorUS);
+
+		pdrgpresBaseline->Release();
+	}
+
+	pdrgpresCurrent->Release();
+
+	return nullptr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		main
+//
+//	@doc:
+//		Entry point of the minidump benchmark
+//
+//---------------------------------------------------------------------------
+INT
+main(INT iArgs, const CHAR **rgszArgs)
+{
+	struct gpos_init_params gpos_params = {nullptr};
+
+	gpos_init(&gpos_params);
+	gpdxl_init();
+	gpopt_init();
+
+	GPOS_ASSERT(iArgs >= 0);
+
+	CMainArgs ma(iArgs, rgszArgs, "d:f:n:o:b:r:t:m:");
+
+	gpos_exec_params params;
+	params.func = PvExec;
+	params.arg = &ma;
+	params.stack_start = &params;
+	params.error_buffer = nullptr;
+	params.error_buffer_size = -1;
+	params.abort_requested = nullptr;
+
+	if (gpos_exec(&params) || (regressions != 0))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+// EOF
@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryTest.h
+//
+//	@doc:
+//		Tests the binary DXL encoding
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CDXLBinaryTest_H
+#define GPOPT_CDXLBinaryTest_H
+
+#include "gpos/base.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryTest
+{
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Plan();
+	static GPOS_RESULT EresUnittest_XMLRoundTrip();
+	static GPOS_RESULT EresUnittest_Malformed();
+
+};	// class CDXLBinaryTest
+}  // namespace gpdxl
+
+#endif	// !GPOPT_CDXLBinaryTest_H
+
+// EOF
@@ -51,6 +51,9 @@ public:
 
 	// merge union test with double values differing by less than epsilon
 	static GPOS_RESULT EresUnittest_MergeUnionDoubleLessThanEpsilon();
+
+	// flat bounds compare the way buckets do
+	static GPOS_RESULT EresUnittest_DoubleHistogram();
 };	// class CHistogramTest
 }  // namespace gpnaucrates
 
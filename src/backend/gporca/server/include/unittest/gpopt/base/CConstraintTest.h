@@ -81,6 +81,12 @@ private:
 	static CConstraintInterval *PciSecondInterval(CMemoryPool *mp, IMDId *mdid,
 												  CColRef *colref);
 
+	// interval of the given number of multiples of the given step; with
+	// fPointSet, both ends of each range are the same datum
+	static CConstraintInterval *PciMultiples(CMemoryPool *mp, IMDId *mdid,
+											 CColRef *colref, ULONG ulStep,
+											 ULONG ulCount, BOOL fPointSet);
+
 	// interval from scalar comparison
 	static GPOS_RESULT EresUnittest_CIntervalFromScalarCmp(
 		CMemoryPool *mp, CMDAccessor *md_accessor, CColRef *colref);
@@ -110,6 +116,7 @@ public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_CInterval();
+	static GPOS_RESULT EresUnittest_CIntervalPointSet();
 	static GPOS_RESULT EresUnittest_CIntervalFromScalarExpr();
 	static GPOS_RESULT EresUnittest_CConjunction();
 	static GPOS_RESULT EresUnittest_CDisjunction();
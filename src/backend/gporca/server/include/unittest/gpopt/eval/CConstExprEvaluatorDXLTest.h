@@ -58,6 +58,9 @@ private:
 		// dummy value to return
 		INT m_val;
 
+		// number of expressions evaluated so far
+		ULONG m_ulEvaluated;
+
 	public:
 		CDummyConstDXLNodeEvaluator(const CDummyConstDXLNodeEvaluator &) =
 			delete;
@@ -65,7 +68,7 @@ private:
 		// ctor
 		CDummyConstDXLNodeEvaluator(CMemoryPool *mp, CMDAccessor *md_accessor,
 									INT val)
-			: m_mp(mp), m_pmda(md_accessor), m_val(val)
+			: m_mp(mp), m_pmda(md_accessor), m_val(val), m_ulEvaluated(0)
 		{
 		}
 
@@ -76,6 +79,17 @@ private:
 		gpdxl::CDXLNode *EvaluateExpr(
 			const gpdxl::CDXLNode *pdxlnExpr) override;
 
+		// evaluate the given DXL nodes and return a dummy value as DXL for each
+		gpdxl::CDXLNodeArray *EvaluateExprs(
+			const gpdxl::CDXLNodeArray *pdrgpdxlnExpr) override;
+
+		// number of expressions evaluated so far
+		ULONG
+		UlEvaluated() const
+		{
+			return m_ulEvaluated;
+		}
+
 		// can evaluate expressions
 		BOOL
 		FCanEvalExpressions() override
@@ -99,6 +113,9 @@ public:
 
 	// test that evaluation fails for a scalar with variables
 	static GPOS_RESULT EresUnittest_ScalarContainingVariables();
+
+	// test that batches are evaluated and results are memoized
+	static GPOS_RESULT EresUnittest_BatchMemoized();
 };
 }  // namespace gpopt
 
@@ -65,6 +65,9 @@ public:
 	// test search strategy that times out
 	static GPOS_RESULT EresUnittest_Timeout();
 
+	// test optimization under a planning deadline
+	static GPOS_RESULT EresUnittest_Deadline();
+
 	// test exception handling when parsing search strategy
 	static GPOS_RESULT EresUnittest_ParsingWithException();
 
@@ -10,6 +10,7 @@
 //---------------------------------------------------------------------------
 
 #include "gpos/_api.h"
+#include "gpos/common/CAutoTimer.h"
 #include "gpos/common/CMainArgs.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/test/CUnittest.h"
@@ -27,6 +28,7 @@
 // test headers
 
 #include "unittest/base.h"
+#include "unittest/dxl/CDXLBinaryTest.h"
 #include "unittest/dxl/CDXLMemoryManagerTest.h"
 #include "unittest/dxl/CDXLUtilsTest.h"
 #include "unittest/dxl/CParseHandlerCostModelTest.h"
@@ -124,6 +126,7 @@ static gpos::CUnittest rgut[] = {
 	// naucrates
 	GPOS_UNITTEST_STD(CCostTest), GPOS_UNITTEST_STD(CDatumTest),
 	GPOS_UNITTEST_STD(CDXLMemoryManagerTest), GPOS_UNITTEST_STD(CDXLUtilsTest),
+	GPOS_UNITTEST_STD(CDXLBinaryTest),
 	GPOS_UNITTEST_STD(CMDAccessorTest), GPOS_UNITTEST_STD(CMDProviderTest),
 	GPOS_UNITTEST_STD(CMiniDumperDXLTest),
 	GPOS_UNITTEST_STD(CExpressionPreprocessorTest),
@@ -256,6 +259,7 @@ PvExec(void *pv)
 	CHAR ch = '\0';
 
 	CHAR *file_name = nullptr;
+	CHAR *szConvertedFileName = nullptr;
 	BOOL fMinidump = false;
 	BOOL fUnittest = false;
 	BOOL fPrintDXLPlan = false;
@@ -299,6 +303,11 @@ PvExec(void *pv)
 				fPrintDXLPlan = true;
 				break;
 
+			case 'c':
+				// convert the minidump given by -d between XML and binary DXL
+				szConvertedFileName = optarg;
+				break;
+
 			default:
 				// ignore other parameters
 				break;
@@ -312,7 +321,21 @@ PvExec(void *pv)
 		return nullptr;
 	}
 
-	if (fMinidump)
+	if (nullptr != szConvertedFileName && !fMinidump)
+	{
+		GPOS_TRACE(GPOS_WSZ_LIT("Option -c requires option -d"));
+		return nullptr;
+	}
+
+	if (fMinidump && nullptr != szConvertedFileName)
+	{
+		InitDXL();
+
+		CAutoMemoryPool amp;
+		CMinidumperUtils::ConvertMinidump(amp.Pmp(), file_name,
+										  szConvertedFileName);
+	}
+	else if (fMinidump)
 	{
 		// initialize DXL support
 		InitDXL();
@@ -344,10 +367,15 @@ PvExec(void *pv)
 
 		ULONG ulSegments = CTestUtils::UlSegments(optimizer_config);
 
-		CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
-			mp, file_name, ulSegments, 1 /*ulSessionId*/, 1 /*ulCmdId*/,
-			optimizer_config, nullptr /*pceeval*/
-		);
+		CDXLNode *pdxlnPlan = nullptr;
+		{
+			// execute the loaded minidump instead of loading the file again
+			CAutoTimer at("Minidump", true /*fPrint*/);
+			pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+				mp, pdxlmd, file_name, ulSegments, 1 /*ulSessionId*/,
+				1 /*ulCmdId*/, optimizer_config, nullptr /*pceeval*/
+			);
+		}
 
 		if (fPrintDXLPlan)
 		{
@@ -404,7 +432,7 @@ main(INT iArgs, const CHAR **rgszArgs)
 	GPOS_ASSERT(iArgs >= 0);
 
 	// setup args for unittest params
-	CMainArgs ma(iArgs, rgszArgs, "uU:d:xT:i:p");
+	CMainArgs ma(iArgs, rgszArgs, "uU:d:xT:i:pc:");
 
 	// initialize unittest framework
 	CUnittest::Init(rgut, GPOS_ARRAY_SIZE(rgut), ConfigureTests, Cleanup);
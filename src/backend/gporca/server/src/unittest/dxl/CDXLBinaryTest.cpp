@@ -0,0 +1,207 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (c) 2024 VMware, Inc. or its affiliates. All Rights Reserved.
+//
+//	@filename:
+//		CDXLBinaryTest.cpp
+//
+//	@doc:
+//		Tests the binary DXL encoding
+//---------------------------------------------------------------------------
+
+#include "unittest/dxl/CDXLBinaryTest.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/string/CWStringDynamic.h"
+#include "gpos/test/CUnittest.h"
+
+#include "naucrates/base/CQueryToDXLResult.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerDXL.h"
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+#include "naucrates/exception.h"
+
+using namespace gpos;
+using namespace gpdxl;
+
+static const char *szQueryFile =
+	"../data/dxl/expressiontests/TableScanQuery.xml";
+static const char *szPlanFile = "../data/dxl/expressiontests/TableScanPlan.xml";
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest
+//
+//	@doc:
+//		Unittest for binary DXL
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_Plan),
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_XMLRoundTrip),
+		GPOS_UNITTEST_FUNC_THROW(CDXLBinaryTest::EresUnittest_Malformed,
+								 gpdxl::ExmaDXL,
+								 gpdxl::ExmiDXLBinaryParseError),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Plan
+//
+//	@doc:
+//		A plan parsed from binary DXL serializes like the plan parsed from
+//		the XML document it was encoded from
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Plan()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// parse the XML document
+	CAutoRg<CHAR> a_szDXL(CDXLUtils::Read(mp, szPlanFile));
+	ULLONG plan_id = 0;
+	ULLONG plan_space_size = 0;
+	CDXLNode *pdxlnXML =
+		CDXLUtils::GetPlanDXLNode(mp, a_szDXL.Rgt(), nullptr /*xsd_file_path*/,
+								  &plan_id, &plan_space_size);
+
+	// parse the binary encoding of the same document
+	ULONG_PTR size = 0;
+	CAutoRg<BYTE> a_pb(CDXLUtils::EncodeBinaryDXL(mp, szPlanFile, &size));
+	GPOS_RTL_ASSERT(CDXLBinaryFormat::FBinaryDXL(a_pb.Rgt(), size));
+
+	CAutoP<CParseHandlerDXL> a_phdxl(
+		CDXLUtils::GetParseHandlerForBinaryDXL(mp, a_pb.Rgt(), size));
+	CDXLNode *pdxlnBinary = a_phdxl->PdxlnPlan();
+	GPOS_RTL_ASSERT(nullptr != pdxlnBinary);
+	GPOS_RTL_ASSERT(plan_id == a_phdxl->GetPlanId());
+	GPOS_RTL_ASSERT(plan_space_size == a_phdxl->GetPlanSpaceSize());
+
+	CWStringDynamic strXML(mp);
+	COstreamString ossXML(&strXML);
+	CDXLUtils::SerializePlan(mp, ossXML, pdxlnXML, plan_id, plan_space_size,
+							 true /*serialize_header_footer*/,
+							 true /*indentation*/);
+
+	CWStringDynamic strBinary(mp);
+	COstreamString ossBinary(&strBinary);
+	CDXLUtils::SerializePlan(mp, ossBinary, pdxlnBinary, plan_id,
+							 plan_space_size, true /*serialize_header_footer*/,
+							 true /*indentation*/);
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (!strXML.Equals(&strBinary))
+	{
+		GPOS_TRACE(strXML.GetBuffer());
+		GPOS_TRACE(strBinary.GetBuffer());
+		eres = GPOS_FAILED;
+	}
+
+	pdxlnXML->Release();
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_XMLRoundTrip
+//
+//	@doc:
+//		A binary DXL document serialized back to XML parses to the query of
+//		the original XML document
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_XMLRoundTrip()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// encode the XML document and serialize the encoding as XML again
+	ULONG_PTR size = 0;
+	CAutoRg<BYTE> a_pb(CDXLUtils::EncodeBinaryDXL(mp, szQueryFile, &size));
+
+	CWStringDynamic strRoundTrip(mp);
+	COstreamString ossRoundTrip(&strRoundTrip);
+	CDXLUtils::SerializeBinaryDXL(mp, a_pb.Rgt(), size, ossRoundTrip,
+								  true /*indentation*/);
+	CAutoRg<CHAR> a_szRoundTrip(
+		CDXLUtils::CreateMultiByteCharStringFromWCString(
+			mp, strRoundTrip.GetBuffer()));
+
+	CAutoRg<CHAR> a_szDXL(CDXLUtils::Read(mp, szQueryFile));
+
+	const CHAR *rgszDXL[] = {a_szDXL.Rgt(), a_szRoundTrip.Rgt()};
+	CWStringDynamic *rgstr[] = {GPOS_NEW(mp) CWStringDynamic(mp),
+								GPOS_NEW(mp) CWStringDynamic(mp)};
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgszDXL); ul++)
+	{
+		CQueryToDXLResult *presult = CDXLUtils::ParseQueryToQueryDXLTree(
+			mp, rgszDXL[ul], nullptr /*xsd_file_path*/);
+
+		COstreamString oss(rgstr[ul]);
+		CDXLUtils::SerializeQuery(mp, oss, presult->CreateDXLNode(),
+								  presult->GetOutputColumnsDXLArray(),
+								  presult->GetCTEProducerDXLArray(),
+								  true /*serialize_header_footer*/,
+								  true /*indentation*/);
+		GPOS_DELETE(presult);
+	}
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (!rgstr[0]->Equals(rgstr[1]))
+	{
+		GPOS_TRACE(rgstr[0]->GetBuffer());
+		GPOS_TRACE(rgstr[1]->GetBuffer());
+		eres = GPOS_FAILED;
+	}
+
+	GPOS_DELETE(rgstr[0]);
+	GPOS_DELETE(rgstr[1]);
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Malformed
+//
+//	@doc:
+//		Loading a binary DXL document of an unknown version raises an
+//		exception
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Malformed()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG_PTR size = 0;
+	CAutoRg<BYTE> a_pb(CDXLUtils::EncodeBinaryDXL(mp, szQueryFile, &size));
+
+	CDXLBinaryFormat::SHeader *pheader =
+		reinterpret_cast<CDXLBinaryFormat::SHeader *>(a_pb.Rgt());
+	pheader->m_usVersion = CDXLBinaryFormat::usVersion + 1;
+
+	// must throw
+	CAutoP<CParseHandlerDXL> a_phdxl(
+		CDXLUtils::GetParseHandlerForBinaryDXL(mp, a_pb.Rgt(), size));
+
+	return GPOS_FAILED;
+}
+
+// EOF
@@ -21,6 +21,7 @@
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
+#include "naucrates/statistics/CDoubleHistogram.h"
 #include "naucrates/statistics/CHistogram.h"
 #include "naucrates/statistics/CPoint.h"
 
@@ -42,7 +43,8 @@ CHistogramTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramValid),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_MergeUnion),
 		GPOS_UNITTEST_FUNC(
-			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon)};
+			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon),
+		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_DoubleHistogram)};
 
 
 	CAutoMemoryPool amp;
@@ -431,4 +433,94 @@ CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon()
 
 	return GPOS_OK;
 }
+
+// check that the flat bounds of a histogram compare the way its buckets do
+GPOS_RESULT
+CHistogramTest::EresUnittest_DoubleHistogram()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// buckets with open and closed bounds, singletons and adjacent bounds
+	const INT rgiBounds[][4] = {
+		// lower, upper, is lower closed, is upper closed
+		{0, 2, 1, 0},	{2, 2, 1, 1},	{2, 5, 0, 1},	{5, 9, 0, 0},
+		{9, 9, 1, 1},	{10, 14, 1, 1}, {14, 20, 0, 0}, {20, 21, 1, 0},
+		{22, 22, 1, 1}, {25, 30, 0, 1}, {30, 40, 0, 0}, {40, 41, 1, 1},
+	};
+	const ULONG ulBuckets = GPOS_ARRAY_SIZE(rgiBounds);
+
+	// the second histogram holds the same buckets shifted by one
+	CBucketArray *pdrgpbucket1 = GPOS_NEW(mp) CBucketArray(mp);
+	CBucketArray *pdrgpbucket2 = GPOS_NEW(mp) CBucketArray(mp);
+	for (ULONG ul = 0; ul < ulBuckets; ul++)
+	{
+		const INT *pi = rgiBounds[ul];
+		pdrgpbucket1->Append(CCardinalityTestUtils::PbucketInteger(
+			mp, pi[0], pi[1], 0 != pi[2], 0 != pi[3], CDouble(0.05),
+			CDouble(2.0)));
+		pdrgpbucket2->Append(CCardinalityTestUtils::PbucketInteger(
+			mp, pi[0] + 1, pi[1] + 1, 0 != pi[2], 0 != pi[3], CDouble(0.05),
+			CDouble(2.0)));
+	}
+
+	CDoubleHistogram *pdhist1 = CDoubleHistogram::Create(mp, pdrgpbucket1);
+	CDoubleHistogram *pdhist2 = CDoubleHistogram::Create(mp, pdrgpbucket2);
+	GPOS_UNITTEST_ASSERT(nullptr != pdhist1);
+	GPOS_UNITTEST_ASSERT(nullptr != pdhist2);
+
+	for (ULONG ul1 = 0; ul1 < ulBuckets; ul1++)
+	{
+		CBucket *bucket1 = (*pdrgpbucket1)[ul1];
+		CDoubleHistogram::SBucket flat1 = pdhist1->GetBucket(ul1);
+
+		for (ULONG ul2 = 0; ul2 < ulBuckets; ul2++)
+		{
+			CBucket *bucket2 = (*pdrgpbucket2)[ul2];
+			CDoubleHistogram::SBucket flat2 = pdhist2->GetBucket(ul2);
+
+			GPOS_UNITTEST_ASSERT(bucket1->Intersects(bucket2) ==
+								 CDoubleHistogram::Intersects(flat1, flat2));
+			GPOS_UNITTEST_ASSERT(bucket1->IsBefore(bucket2) ==
+								 CDoubleHistogram::IsBefore(flat1, flat2));
+			GPOS_UNITTEST_ASSERT(
+				CBucket::CompareLowerBounds(bucket1, bucket2) ==
+				CDoubleHistogram::CompareLowerBounds(flat1, flat2));
+			GPOS_UNITTEST_ASSERT(
+				CBucket::CompareUpperBounds(bucket1, bucket2) ==
+				CDoubleHistogram::CompareUpperBounds(flat1, flat2));
+
+			// every bucket counted lies before the other bucket
+			ULONG ulBefore = pdhist1->CountBucketsBefore(ul1, flat2.m_lower);
+			for (ULONG ul = ul1; ul < ul1 + ulBefore; ul++)
+			{
+				GPOS_UNITTEST_ASSERT((*pdrgpbucket1)[ul]->IsBefore(bucket2));
+			}
+		}
+
+		// only candidate buckets contain a point
+		for (INT i = -1; i < 43; i++)
+		{
+			CPoint *point = CTestUtils::PpointInt4(mp, i);
+			DOUBLE dValue = 0.0;
+			GPOS_UNITTEST_ASSERT(CDoubleHistogram::FMapPoint(point, &dValue));
+			GPOS_UNITTEST_ASSERT(bucket1->Contains(point) ==
+								 CDoubleHistogram::Contains(flat1, dValue));
+
+			BOOL fCandidate = pdhist1->FindFirstUpperNotLess(dValue) <= ul1 &&
+							  ul1 < pdhist1->FindFirstLowerGreater(dValue);
+			GPOS_UNITTEST_ASSERT_IMP(bucket1->Contains(point), fCandidate);
+			point->Release();
+		}
+	}
+
+	pdhist1->Release();
+	pdhist2->Release();
+	pdrgpbucket1->Release();
+	pdrgpbucket2->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
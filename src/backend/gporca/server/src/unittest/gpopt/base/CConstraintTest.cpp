@@ -84,6 +84,7 @@ CConstraintTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(
 			EresUnittest_CConstraintIntervalFromArrayExprIncludesNull),
 		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_CInterval),
+		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_CIntervalPointSet),
 		GPOS_UNITTEST_FUNC(
 			CConstraintTest::EresUnittest_CIntervalFromScalarExpr),
 		GPOS_UNITTEST_FUNC(CConstraintTest::EresUnittest_CConjunction),
@@ -201,6 +202,115 @@ CConstraintTest::EresUnittest_CInterval()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintTest::EresUnittest_CIntervalPointSet
+//
+//	@doc:
+//		Operations on point sets must give the same intervals as the ones
+//		on intervals with the same ranges
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstraintTest::EresUnittest_CIntervalPointSet()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, nullptr, /* pceeval */
+					 CTestUtils::GetCostModel(mp));
+
+	IMDTypeInt8 *pmdtypeint8 =
+		(IMDTypeInt8 *) mda.PtMDType<IMDTypeInt8>(CTestUtils::m_sysidDefault);
+	IMDId *mdid = pmdtypeint8->MDId();
+
+	CExpression *pexprGet = CTestUtils::PexprLogicalGet(mp);
+	CColRefSet *pcrs = pexprGet->DeriveOutputColumns();
+	CColRef *colref = pcrs->PcrAny();
+
+	// multiples of 2 and of 3, as point sets and as plain intervals
+	CConstraintInterval *pciPoints2 =
+		PciMultiples(mp, mdid, colref, 2, 100, true /*fPointSet*/);
+	CConstraintInterval *pciPoints3 =
+		PciMultiples(mp, mdid, colref, 3, 100, true /*fPointSet*/);
+	CConstraintInterval *pciRanges2 =
+		PciMultiples(mp, mdid, colref, 2, 100, false /*fPointSet*/);
+	CConstraintInterval *pciRanges3 =
+		PciMultiples(mp, mdid, colref, 3, 100, false /*fPointSet*/);
+	CConstraintInterval *pciFirst = PciFirstInterval(mp, mdid, colref);
+
+	GPOS_UNITTEST_ASSERT(pciPoints2->FPointSet());
+	GPOS_UNITTEST_ASSERT(!pciRanges2->FPointSet());
+	GPOS_UNITTEST_ASSERT(!pciFirst->FPointSet());
+
+	// intersection of two point sets, and of a point set with ranges
+	CConstraintInterval *pciIntersectPoints =
+		pciPoints2->PciIntersect(mp, pciPoints3);
+	CConstraintInterval *pciIntersectRanges =
+		pciRanges2->PciIntersect(mp, pciRanges3);
+	GPOS_UNITTEST_ASSERT(pciIntersectPoints->FPointSet());
+	GPOS_UNITTEST_ASSERT(34 == pciIntersectPoints->Pdrgprng()->Size());
+	GPOS_UNITTEST_ASSERT(pciIntersectPoints->Equals(pciIntersectRanges));
+
+	CConstraintInterval *pciFirstPoints = pciFirst->PciIntersect(mp, pciPoints3);
+	CConstraintInterval *pciFirstRanges = pciFirst->PciIntersect(mp, pciRanges3);
+	GPOS_UNITTEST_ASSERT(pciFirstPoints->FPointSet());
+	GPOS_UNITTEST_ASSERT(pciFirstPoints->Equals(pciFirstRanges));
+	GPOS_UNITTEST_ASSERT(pciFirst->Contains(pciFirstPoints));
+	GPOS_UNITTEST_ASSERT(!pciFirst->Contains(pciPoints3));
+	GPOS_UNITTEST_ASSERT(pciPoints3->Contains(pciIntersectPoints));
+	GPOS_UNITTEST_ASSERT(!pciPoints2->Contains(pciPoints3));
+
+	// union of two point sets
+	CConstraintInterval *pciUnionPoints = pciPoints2->PciUnion(mp, pciPoints3);
+	CConstraintInterval *pciUnionRanges = pciRanges2->PciUnion(mp, pciRanges3);
+	GPOS_UNITTEST_ASSERT(pciUnionPoints->FPointSet());
+	GPOS_UNITTEST_ASSERT(166 == pciUnionPoints->Pdrgprng()->Size());
+	GPOS_UNITTEST_ASSERT(pciUnionPoints->Equals(pciUnionRanges));
+
+	// intervals are combined directly in conjunctions and disjunctions
+	CConstraintArray *pdrgpcnstr = GPOS_NEW(mp) CConstraintArray(mp);
+	pciFirst->AddRef();
+	pdrgpcnstr->Append(pciFirst);
+	pciPoints3->AddRef();
+	pdrgpcnstr->Append(pciPoints3);
+	CConstraintInterval *pciConj =
+		CConstraintInterval::PciIntervalFromIntervals(mp, pdrgpcnstr, true);
+	GPOS_UNITTEST_ASSERT(pciConj->Equals(pciFirstRanges));
+	CConstraintInterval *pciDisj =
+		CConstraintInterval::PciIntervalFromIntervals(mp, pdrgpcnstr, false);
+	CConstraintInterval *pciDisjExpected = pciFirst->PciUnion(mp, pciRanges3);
+	GPOS_UNITTEST_ASSERT(pciDisj->Equals(pciDisjExpected));
+	PrintConstraint(mp, pciDisj);
+
+	pdrgpcnstr->Release();
+	pciConj->Release();
+	pciDisj->Release();
+	pciDisjExpected->Release();
+	pciUnionPoints->Release();
+	pciUnionRanges->Release();
+	pciFirstPoints->Release();
+	pciFirstRanges->Release();
+	pciIntersectPoints->Release();
+	pciIntersectRanges->Release();
+	pciFirst->Release();
+	pciRanges3->Release();
+	pciRanges2->Release();
+	pciPoints3->Release();
+	pciPoints2->Release();
+
+	pexprGet->Release();
+
+	return GPOS_OK;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintTest::EresUnittest_CConjunction
@@ -1172,6 +1282,44 @@ CConstraintTest::PciSecondInterval(CMemoryPool *mp, IMDId *mdid,
 		CConstraintInterval(mp, colref, pdrgprng, false /*is_null*/);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintTest::PciMultiples
+//
+//	@doc:
+//		Create an interval of points 0, step, 2 * step, ...
+//
+//---------------------------------------------------------------------------
+CConstraintInterval *
+CConstraintTest::PciMultiples(CMemoryPool *mp, IMDId *mdid, CColRef *colref,
+							  ULONG ulStep, ULONG ulCount, BOOL fPointSet)
+{
+	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
+	CRangeArray *pdrgprng = GPOS_NEW(mp) CRangeArray(mp);
+
+	for (ULONG ul = 0; ul < ulCount; ul++)
+	{
+		LINT lValue = (LINT)(ul * ulStep);
+		IDatum *datum = GPOS_NEW(mp)
+			CDatumInt8GPDB(CTestUtils::m_sysidDefault, lValue);
+		if (fPointSet)
+		{
+			pdrgprng->Append(
+				GPOS_NEW(mp) CRange(pcomp, IMDType::EcmptEq, datum));
+			continue;
+		}
+
+		mdid->AddRef();
+		pdrgprng->Append(GPOS_NEW(mp) CRange(
+			mdid, pcomp, datum, CRange::EriIncluded,
+			GPOS_NEW(mp) CDatumInt8GPDB(CTestUtils::m_sysidDefault, lValue),
+			CRange::EriIncluded));
+	}
+
+	return GPOS_NEW(mp)
+		CConstraintInterval(mp, colref, pdrgprng, false /*is_null*/);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintTest::Pdrgprng
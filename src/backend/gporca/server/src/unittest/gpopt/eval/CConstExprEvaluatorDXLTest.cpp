@@ -51,6 +51,8 @@ CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExpr(
 	const gpdxl::CDXLNode * /*pdxlnExpr*/
 )
 {
+	m_ulEvaluated++;
+
 	const IMDTypeInt4 *pmdtypeint4 = m_pmda->PtMDType<IMDTypeInt4>();
 	pmdtypeint4->MDId()->AddRef();
 
@@ -62,6 +64,28 @@ CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExpr(
 	return GPOS_NEW(m_mp) CDXLNode(m_mp, pdxlnConst);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExprs
+//
+//	@doc:
+//		Evaluate the given DXL nodes representing expressions and returns a
+//		dummy value as DXL for each. Caller must release the array.
+//
+//---------------------------------------------------------------------------
+gpdxl::CDXLNodeArray *
+CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExprs(
+	const gpdxl::CDXLNodeArray *pdrgpdxlnExpr)
+{
+	CDXLNodeArray *pdrgpdxlnResult = GPOS_NEW(m_mp) CDXLNodeArray(m_mp);
+	for (ULONG ul = 0; ul < pdrgpdxlnExpr->Size(); ul++)
+	{
+		pdrgpdxlnResult->Append(EvaluateExpr((*pdrgpdxlnExpr)[ul]));
+	}
+
+	return pdrgpdxlnResult;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstExprEvaluatorDXLTest::EresUnittest
@@ -85,6 +109,8 @@ CConstExprEvaluatorDXLTest::EresUnittest()
 										 EresUnittest_ScalarContainingVariables,
 									 gpdxl::ExmaGPOPT,
 									 gpdxl::ExmiEvalUnsupportedScalarExpr),
+			GPOS_UNITTEST_FUNC(
+				CConstExprEvaluatorDXLTest::EresUnittest_BatchMemoized),
 		};
 
 		return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -191,4 +217,59 @@ CConstExprEvaluatorDXLTest::EresUnittest_ScalarContainingVariables()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXLTest::EresUnittest_BatchMemoized
+//
+//	@doc:
+//		Test that a batch of expressions is evaluated in order and that
+//		expressions evaluated before are not sent to the DXL evaluator again.
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstExprEvaluatorDXLTest::EresUnittest_BatchMemoized()
+{
+	CTestUtils::CTestSetup testsetup;
+	CMemoryPool *mp = testsetup.Pmp();
+	CDummyConstDXLNodeEvaluator consteval(mp, testsetup.Pmda(),
+										  m_iDefaultEvalValue);
+	CConstExprEvaluatorDXL *pceeval =
+		GPOS_NEW(mp) CConstExprEvaluatorDXL(mp, testsetup.Pmda(), &consteval);
+
+	// 1 = 2 is evaluated on its own first
+	CExpression *pexprFirst =
+		CUtils::PexprScalarEqCmp(mp, CUtils::PexprScalarConstInt4(mp, 1),
+								 CUtils::PexprScalarConstInt4(mp, 2));
+	CExpression *pexprResult = pceeval->PexprEval(pexprFirst);
+	pexprResult->Release();
+	GPOS_UNITTEST_ASSERT(1 == consteval.UlEvaluated());
+
+	// a batch of 1 = 2 and 3 = 4 only evaluates the latter
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	pdrgpexpr->Append(pexprFirst);
+	pdrgpexpr->Append(
+		CUtils::PexprScalarEqCmp(mp, CUtils::PexprScalarConstInt4(mp, 3),
+								 CUtils::PexprScalarConstInt4(mp, 4)));
+
+	CExpressionArray *pdrgpexprResult = pceeval->PdrgpexprEval(mp, pdrgpexpr);
+	GPOS_UNITTEST_ASSERT(2 == consteval.UlEvaluated());
+	GPOS_UNITTEST_ASSERT(pdrgpexpr->Size() == pdrgpexprResult->Size());
+	for (ULONG ul = 0; ul < pdrgpexprResult->Size(); ul++)
+	{
+		GPOS_UNITTEST_ASSERT(COperator::EopScalarConst ==
+							 (*pdrgpexprResult)[ul]->Pop()->Eopid());
+	}
+
+	// both are memoized now
+	pdrgpexprResult->Release();
+	pdrgpexprResult = pceeval->PdrgpexprEval(mp, pdrgpexpr);
+	GPOS_UNITTEST_ASSERT(2 == consteval.UlEvaluated());
+
+	pdrgpexprResult->Release();
+	pdrgpexpr->Release();
+	pceeval->Release();
+
+	return GPOS_OK;
+}
+
 // EOF
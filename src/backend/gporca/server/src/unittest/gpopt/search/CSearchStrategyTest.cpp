@@ -14,8 +14,10 @@
 #include "gpos/task/CAutoTraceFlag.h"
 
 #include "gpopt/engine/CEngine.h"
+#include "gpopt/engine/CHint.h"
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/exception.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/search/CSearchStage.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "naucrates/dxl/CDXLUtils.h"
@@ -45,6 +47,7 @@ CSearchStrategyTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CSearchStrategyTest::EresUnittest_Parsing),
 		GPOS_UNITTEST_FUNC_THROW(CSearchStrategyTest::EresUnittest_Timeout,
 								 gpopt::ExmaGPOPT, gpopt::ExmiNoPlanFound),
+		GPOS_UNITTEST_FUNC(CSearchStrategyTest::EresUnittest_Deadline),
 		GPOS_UNITTEST_FUNC_THROW(
 			CSearchStrategyTest::EresUnittest_ParsingWithException,
 			gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError),
@@ -186,6 +189,56 @@ CSearchStrategyTest::EresUnittest_Timeout()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchStrategyTest::EresUnittest_Deadline
+//
+//	@doc:
+//		Test optimization under a planning deadline; the deadline is too
+//		short for the exhaustive stage, so the plan found by the greedy
+//		stage has to be returned
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CSearchStrategyTest::EresUnittest_Deadline()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+	CAutoTraceFlag atf(EopttracePrintOptimizationStatistics, true);
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	CHint *phint = GPOS_NEW(mp) CHint(
+		gpos::int_max, /* join_arity_for_associativity_commutativity */
+		gpos::int_max, /* array_expansion_threshold */
+		JOIN_ORDER_DP_THRESHOLD, BROADCAST_THRESHOLD,
+		true, /* enforce_constraint_on_dml */
+		PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD, XFORM_BIND_THRESHOLD,
+		SKEW_FACTOR, 1 /* planning_deadline */);
+	COptimizerConfig *optimizer_config = GPOS_NEW(mp) COptimizerConfig(
+		GPOS_NEW(mp) CEnumeratorConfig(mp, 0 /*plan_id*/, 0 /*ullSamples*/),
+		CStatisticsConfig::PstatsconfDefault(mp),
+		CCTEConfig::PcteconfDefault(mp), CTestUtils::GetCostModel(mp), phint,
+		nullptr /* pplanhint */, CWindowOids::GetWindowOids(mp));
+
+	// install opt context in TLS
+	{
+		CAutoOptCtxt aoc(mp, &mda, nullptr /* pceeval */, optimizer_config);
+		CExpression *pexpr = CTestUtils::PexprLogicalNAryJoin(mp);
+
+		// without a search strategy the engine orders joins greedily first
+		BuildMemo(mp, pexpr, nullptr /* search_stage_array */);
+		pexpr->Release();
+	}
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CSearchStrategyTest::EresUnittest_ParsingWithException
@@ -151,6 +151,7 @@ _copyPlannedStmt(const PlannedStmt *from)
 	COPY_NODE_FIELD(copyIntoClause);
 	COPY_NODE_FIELD(refreshClause);
 	COPY_SCALAR_FIELD(metricsQueryType);
+	COPY_NODE_FIELD(optimizerProfile);
 
 	return newnode;
 }
@@ -1202,6 +1203,7 @@ _copyHashJoin(const HashJoin *from)
 	COPY_NODE_FIELD(hashoperators);
 	COPY_NODE_FIELD(hashcollations);
 	COPY_NODE_FIELD(hashkeys);
+	COPY_SCALAR_FIELD(use_runtime_filter);
 
 	return newnode;
 }
@@ -1405,6 +1407,8 @@ _copyHash(const Hash *from)
 	COPY_SCALAR_FIELD(skewTable);
 	COPY_SCALAR_FIELD(skewColumn);
 	COPY_SCALAR_FIELD(skewInherit);
+	COPY_NODE_FIELD(skewValues);
+	COPY_NODE_FIELD(skewFreqs);
 	COPY_SCALAR_FIELD(rows_total);
 
 	return newnode;
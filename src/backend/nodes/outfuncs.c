@@ -393,6 +393,7 @@ _outPlannedStmt(StringInfo str, const PlannedStmt *node)
 	WRITE_NODE_FIELD(copyIntoClause);
 	WRITE_NODE_FIELD(refreshClause);
 	WRITE_INT_FIELD(metricsQueryType);
+	WRITE_NODE_FIELD(optimizerProfile);
 }
 
 
@@ -1058,6 +1059,7 @@ _outHashJoin(StringInfo str, const HashJoin *node)
 	WRITE_NODE_FIELD(hashoperators);
 	WRITE_NODE_FIELD(hashcollations);
 	WRITE_NODE_FIELD(hashkeys);
+	WRITE_BOOL_FIELD(use_runtime_filter);
 }
 
 static void
@@ -1208,6 +1210,8 @@ _outHash(StringInfo str, const Hash *node)
 	WRITE_OID_FIELD(skewTable);
 	WRITE_INT_FIELD(skewColumn);
 	WRITE_BOOL_FIELD(skewInherit);
+	WRITE_NODE_FIELD(skewValues);
+	WRITE_NODE_FIELD(skewFreqs);
 
 	WRITE_FLOAT_FIELD(rows_total, "%.0f");
 }
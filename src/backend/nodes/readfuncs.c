@@ -2461,6 +2461,7 @@ _readPlannedStmt(void)
 	READ_NODE_FIELD(copyIntoClause);
 	READ_NODE_FIELD(refreshClause);
 	READ_INT_FIELD(metricsQueryType);
+	READ_NODE_FIELD(optimizerProfile);
 
 	READ_DONE();
 }
@@ -3194,6 +3195,7 @@ _readHashJoin(void)
 	READ_NODE_FIELD(hashoperators);
 	READ_NODE_FIELD(hashcollations);
 	READ_NODE_FIELD(hashkeys);
+	READ_BOOL_FIELD(use_runtime_filter);
 
 	READ_DONE();
 }
@@ -3395,6 +3397,8 @@ _readHash(void)
 	READ_OID_FIELD(skewTable);
 	READ_INT_FIELD(skewColumn);
 	READ_BOOL_FIELD(skewInherit);
+	READ_NODE_FIELD(skewValues);
+	READ_NODE_FIELD(skewFreqs);
 	READ_FLOAT_FIELD(rows_total);
 
 	READ_DONE();
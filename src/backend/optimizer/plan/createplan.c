@@ -25,6 +25,7 @@
 #include "access/sysattr.h"
 #include "catalog/pg_class.h"
 #include "catalog/pg_proc.h"
+#include "catalog/pg_statistic.h"
 #include "foreign/fdwapi.h"
 #include "miscadmin.h"
 #include "nodes/extensible.h"
@@ -45,7 +46,9 @@
 #include "parser/parse_clause.h"
 #include "parser/parsetree.h"
 #include "partitioning/partprune.h"
+#include "utils/datum.h"
 #include "utils/lsyscache.h"
+#include "utils/syscache.h"
 #include "utils/uri.h"
 
 #include "cdb/cdbhash.h"
@@ -6687,11 +6690,77 @@ make_hash(Plan *lefttree,
 	node->skewColumn = skewColumn;
 	node->skewInherit = skewInherit;
 
+	/*
+	 * GPDB: heavy hitters are handled by the skew hash table on the segments
+	 * only along with the swapping of hash join sides, see
+	 * set_hash_skew_values.
+	 */
+	if (gp_enable_hashjoin_role_reversal)
+		set_hash_skew_values(node);
+
 	node->rescannable = false;	/* CDB (unused for now) */
 
 	return node;
 }
 
+/*
+ * set_hash_skew_values
+ *	  GPDB: copy the MCVs of the outer relation's join key, and their
+ *	  frequencies, into the Hash node.  Only the coordinator has statistics,
+ *	  so without them ExecHashBuildSkewHash could never set up the skew hash
+ *	  table on the segments.  Called once skewTable and skewColumn are set.
+ */
+void
+set_hash_skew_values(Hash *node)
+{
+	HeapTupleData *statsTuple;
+	AttStatsSlot sslot;
+
+	node->skewValues = NIL;
+	node->skewFreqs = NIL;
+
+	if (!OidIsValid(node->skewTable))
+		return;
+
+	statsTuple = SearchSysCache3(STATRELATTINH,
+								 ObjectIdGetDatum(node->skewTable),
+								 Int16GetDatum(node->skewColumn),
+								 BoolGetDatum(node->skewInherit));
+	if (!HeapTupleIsValid(statsTuple))
+		return;
+
+	if (get_attstatsslot(&sslot, statsTuple,
+						 STATISTIC_KIND_MCV, InvalidOid,
+						 ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS))
+	{
+		int16		typlen;
+		bool		typbyval;
+		int			i;
+
+		get_typlenbyval(sslot.valuetype, &typlen, &typbyval);
+
+		for (i = 0; i < sslot.nvalues && i < sslot.nnumbers; i++)
+		{
+			Const	   *value;
+			Const	   *freq;
+
+			value = makeConst(sslot.valuetype, -1, InvalidOid, typlen,
+							  datumCopy(sslot.values[i], typbyval, typlen),
+							  false, typbyval);
+			freq = makeConst(FLOAT4OID, -1, InvalidOid, sizeof(float4),
+							 Float4GetDatum(sslot.numbers[i]),
+							 false, FLOAT4PASSBYVAL);
+
+			node->skewValues = lappend(node->skewValues, value);
+			node->skewFreqs = lappend(node->skewFreqs, freq);
+		}
+
+		free_attstatsslot(&sslot);
+	}
+
+	ReleaseSysCache(statsTuple);
+}
+
 MergeJoin *
 make_mergejoin(List *tlist,
 			   List *joinclauses,
@@ -158,6 +158,9 @@ static Expr *inline_function(Oid funcid, Oid result_type, Oid result_collid,
 							 bool funcvariadic,
 							 HeapTuple func_tuple,
 							 eval_const_expressions_context *context);
+static Expr *evaluate_expr_in_estate(EState *estate, Expr *expr,
+									 Oid result_type, int32 result_typmod,
+									 Oid result_collation);
 static Node *substitute_actual_parameters(Node *expr, int nargs, List *args,
 										  int *usecounts);
 static Node *substitute_actual_parameters_mutator(Node *node,
@@ -5154,6 +5157,68 @@ evaluate_expr(Expr *expr, Oid result_type, int32 result_typmod,
 			  Oid result_collation)
 {
 	EState	   *estate;
+	Expr	   *result;
+
+	/*
+	 * To use the executor, we need an EState.
+	 */
+	estate = CreateExecutorState();
+
+	result = evaluate_expr_in_estate(estate, expr, result_type, result_typmod,
+									 result_collation);
+
+	/* Release all the junk we just created */
+	FreeExecutorState(estate);
+
+	return result;
+}
+
+/*
+ * evaluate_expr_list: pre-evaluate a list of constant expressions
+ *
+ * Returns a list of Consts holding the results, in the same order.  This is
+ * the same as calling evaluate_expr() on each expression, except that a
+ * single EState is set up and torn down for the whole list, which matters
+ * to callers (such as ORCA) that evaluate many small expressions at once.
+ */
+List *
+evaluate_expr_list(List *exprs)
+{
+	EState	   *estate;
+	List	   *result = NIL;
+	ListCell   *lc;
+
+	estate = CreateExecutorState();
+
+	foreach(lc, exprs)
+	{
+		Expr	   *expr = (Expr *) lfirst(lc);
+
+		result = lappend(result,
+						 evaluate_expr_in_estate(estate, expr,
+												 exprType((Node *) expr),
+												 exprTypmod((Node *) expr),
+												 exprCollation((Node *) expr)));
+
+		/* Results are copied out, so the per-tuple memory can be reused */
+		ResetPerTupleExprContext(estate);
+	}
+
+	FreeExecutorState(estate);
+
+	return result;
+}
+
+/*
+ * evaluate_expr_in_estate: guts of evaluate_expr()
+ *
+ * Evaluates the expression using the given EState.  The result is allocated
+ * in the caller's memory context, everything else in the EState.
+ */
+static Expr *
+evaluate_expr_in_estate(EState *estate, Expr *expr, Oid result_type,
+						int32 result_typmod, Oid result_collation)
+{
 	ExprState  *exprstate;
 	MemoryContext oldcontext;
 	Datum		const_val;
@@ -5161,11 +5226,6 @@ evaluate_expr(Expr *expr, Oid result_type, int32 result_typmod,
 	int16		resultTypLen;
 	bool		resultTypByVal;
 
-	/*
-	 * To use the executor, we need an EState.
-	 */
-	estate = CreateExecutorState();
-
 	/* We can use the estate's working context to avoid memory leaks. */
 	oldcontext = MemoryContextSwitchTo(estate->es_query_cxt);
 
@@ -5212,9 +5272,6 @@ evaluate_expr(Expr *expr, Oid result_type, int32 result_typmod,
 			const_val = datumCopy(const_val, resultTypByVal, resultTypLen);
 	}
 
-	/* Release all the junk we just created */
-	FreeExecutorState(estate);
-
 	/*
 	 * Make the constant result node.
 	 */
@@ -8,6 +8,8 @@
  *
  * gp_opt_version: This function wraps LibraryVersion. 
  *
+ * gp_opt_mdcache_stats: This function wraps MDCacheStats.
+ *
  * Copyright(c) 2012 - present, EMC/Greenplum
  */
 
@@ -60,3 +62,18 @@ gp_opt_version(PG_FUNCTION_ARGS pg_attribute_unused())
 	return CStringGetTextDatum("Server has been compiled without ORCA");
 #endif
 }
+
+extern Datum MDCacheStats();
+
+/*
+* Returns the metadata cache counters of the optimizer in this session.
+*/
+Datum
+gp_opt_mdcache_stats(PG_FUNCTION_ARGS pg_attribute_unused())
+{
+#ifdef USE_ORCA
+	return MDCacheStats();
+#else
+	return CStringGetTextDatum("Server has been compiled without ORCA");
+#endif
+}
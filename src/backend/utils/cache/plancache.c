@@ -1160,8 +1160,20 @@ cached_plan_cost(CachedPlan *plan, bool include_planner)
 			 * probably live in src/backend/optimizer/ not here.
 			 */
 			int			nrelations = list_length(plannedstmt->rtable);
+			double		planning_cost = 1000.0 * cpu_operator_cost * (nrelations + 1);
 
-			result += 1000.0 * cpu_operator_cost * (nrelations + 1);
+			/*
+			 * GPDB: ORCA explores a much larger search space than the Postgres
+			 * planner, so re-optimizing a query with it costs correspondingly
+			 * more. Without accounting for that, custom plans look almost
+			 * free to produce, and a prepared point query that benefits from
+			 * direct dispatch (see below) would be re-optimized by ORCA on
+			 * every execution.
+			 */
+			if (plannedstmt->planGen == PLANGEN_OPTIMIZER)
+				planning_cost *= optimizer_replan_cost_factor;
+
+			result += planning_cost;
 		}
 
 		/*
@@ -295,6 +295,7 @@ bool		optimizer_print_expression_properties;
 bool		optimizer_print_group_properties;
 bool		optimizer_print_optimization_context;
 bool		optimizer_print_optimization_stats;
+bool		optimizer_explain_profile;
 bool		optimizer_print_xform_results;
 
 /* array of xforms disable flags */
@@ -341,11 +342,13 @@ bool		optimizer_enable_hashagg;
 bool		optimizer_enable_groupagg;
 bool		optimizer_expand_fulljoin;
 bool		optimizer_enable_mergejoin;
+bool		optimizer_enable_inner_left_mergejoin;
 bool		optimizer_enable_redistribute_nestloop_loj_inner_child;
 bool		optimizer_force_comprehensive_join_implementation;
 bool		optimizer_enable_replicated_table;
 bool		optimizer_enable_foreign_table;
 bool		optimizer_enable_right_outer_join;
+bool		optimizer_enable_runtime_join_filter;
 bool		optimizer_enable_query_parameter;
 
 /* Optimizer plan enumeration related GUCs */
@@ -370,6 +373,7 @@ int			optimizer_penalize_broadcast_threshold;
 double		optimizer_cost_threshold;
 double		optimizer_nestloop_factor;
 double		optimizer_sort_factor;
+double		optimizer_replan_cost_factor;
 
 /* Optimizer hints */
 int			optimizer_join_arity_for_associativity_commutativity;
@@ -380,6 +384,7 @@ int			optimizer_cte_inlining_bound;
 int			optimizer_push_group_by_below_setop_threshold;
 int			optimizer_xform_bind_threshold;
 int			optimizer_skew_factor;
+int			optimizer_planning_deadline;
 bool		optimizer_force_multistage_agg;
 bool		optimizer_force_three_stage_scalar_dqa;
 bool		optimizer_force_expanded_distinct_aggs;
@@ -454,6 +459,15 @@ double		optimizer_jit_optimize_above_cost;
 /* Switch to toggle block-directory based sampling for AO/CO tables */
 bool		gp_enable_blkdir_sampling;
 
+/* Switch to let hash joins swap their sides at runtime */
+bool		gp_enable_hashjoin_role_reversal;
+
+/* Switch to evaluate scan quals on batches of rows */
+bool		gp_enable_vectorized_scan;
+
+/* Switch to aggregate batches of rows from such scans */
+bool		gp_enable_vectorized_agg;
+
 static const struct config_enum_entry gp_log_format_options[] = {
 	{"text", 0},
 	{"csv", 1},
@@ -690,6 +704,46 @@ struct config_bool ConfigureNamesBool_gp[] =
 		false,
 		NULL, NULL, NULL
 	},
+	{
+		{"gp_enable_hashjoin_role_reversal", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Allows hash joins to swap their sides at runtime."),
+			gettext_noop("If the inner side of an inner hash join turns out "
+						 "much larger than estimated and no longer fits in "
+						 "memory, while the outer side is small, the hash "
+						 "table is built on the outer side instead."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&gp_enable_hashjoin_role_reversal,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"gp_enable_vectorized_scan", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Allows sequential scans to read and filter batches of rows."),
+			gettext_noop("Applies to tables whose access method can return "
+						 "batches of rows, such as append-optimized column "
+						 "oriented tables.  Comparisons and arithmetic on "
+						 "int4, int8, float8 and date columns are then "
+						 "evaluated on a whole batch at a time."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&gp_enable_vectorized_scan,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"gp_enable_vectorized_agg", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Allows hashed aggregation to consume batches of rows."),
+			gettext_noop("Applies when the input of the aggregation is a "
+						 "sequential scan reading batches of rows, see "
+						 "gp_enable_vectorized_scan.  The transition states "
+						 "are then advanced over a whole batch at a time."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&gp_enable_vectorized_agg,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"gp_enable_direct_dispatch", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable dispatch for single-row-insert targeted mirror-pairs."),
@@ -2062,6 +2116,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_explain_profile", PGC_USERSET, LOGGING_WHAT,
+			gettext_noop("Collect a profile of GPORCA optimization and show it in EXPLAIN."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_explain_profile,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_extract_dxl_stats", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Extract plan stats in dxl."),
@@ -2392,7 +2457,7 @@ struct config_bool ConfigureNamesBool_gp[] =
 			GUC_NOT_IN_SAMPLE
 		},
 		&optimizer_multilevel_partitioning,
-		true,
+		false,
 		NULL, NULL, NULL
 	},
 
@@ -2512,6 +2577,16 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_inner_left_mergejoin", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the optimizer's support of merge joins for inner and left outer joins."),
+			gettext_noop("Has no effect if optimizer_enable_mergejoin is off."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_inner_left_mergejoin,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_enable_streaming_material", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable plans with a streaming material node in the optimizer."),
@@ -3054,6 +3129,19 @@ struct config_bool ConfigureNamesBool_gp[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"optimizer_enable_runtime_join_filter", PGC_USERSET, QUERY_TUNING_METHOD,
+		 gettext_noop("Enable Orca to push Bloom filters built by hash joins into the scans of their outer side."),
+		 gettext_noop("The filter holds the hash values of the inner side of "
+					  "an inner hash join, and is applied by a table scan that "
+					  "feeds the outer side of the join in the same slice, so "
+					  "that rows without a match are dropped as they are read."),
+		 GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_enable_runtime_join_filter,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"optimizer_enable_query_parameter", PGC_USERSET, DEVELOPER_OPTIONS,
 		 gettext_noop("Enable query parameters in Orca."),
@@ -4189,6 +4277,17 @@ struct config_int ConfigureNamesInt_gp[] =
             NULL, NULL, NULL
     },
 
+	{
+		{"optimizer_planning_deadline", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Time after which GPORCA stops searching and returns the best plan found so far."),
+			gettext_noop("A quick greedy search always completes first. A value of 0 disables the deadline."),
+			GUC_UNIT_MS
+		},
+		&optimizer_planning_deadline,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_join_order_threshold", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Maximum number of join children to use dynamic programming based join ordering algorithm."),
@@ -4511,6 +4610,17 @@ struct config_real ConfigureNamesReal_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_replan_cost_factor", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the cost of re-optimizing a query with the optimizer, relative to the Postgres planner."),
+			gettext_noop("Used when choosing between a generic and a custom plan for a prepared statement."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_replan_cost_factor,
+		10.0, 0.0, DBL_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_nestloop_factor", PGC_USERSET, QUERY_TUNING_OTHER,
 			gettext_noop("Set the nestloop join cost factor in the optimizer"),
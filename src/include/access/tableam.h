@@ -33,6 +33,7 @@ extern bool synchronize_seqscans;
 
 
 struct BulkInsertStateData;
+struct ColumnBatch;
 struct IndexInfo;
 struct SampleScanState;
 struct TBMIterateResult;
@@ -277,6 +278,15 @@ typedef struct TableAmRoutine
 									 ScanDirection direction,
 									 TupleTableSlot *slot);
 
+	/*
+	 * GPDB: Return the next batch of tuples from `scan`, stored column by
+	 * column in `batch` (see executor/execBatch.h).  Optional, AMs that
+	 * cannot do better than scan_getnextslot leave it NULL.
+	 */
+	bool		(*scan_getnextbatch) (TableScanDesc scan,
+									  ScanDirection direction,
+									  struct ColumnBatch *batch);
+
 
 	/* ------------------------------------------------------------------------
 	 * Parallel table scan related functions.
@@ -1053,6 +1063,18 @@ table_scan_getnextslot(TableScanDesc sscan, ScanDirection direction, TupleTableS
 	return sscan->rs_rd->rd_tableam->scan_getnextslot(sscan, direction, slot);
 }
 
+/*
+ * GPDB: Return the next batch of tuples from `scan`, see scan_getnextbatch.
+ */
+static inline bool
+table_scan_getnextbatch(TableScanDesc sscan, ScanDirection direction,
+						struct ColumnBatch *batch)
+{
+	Assert(sscan->rs_rd->rd_tableam->scan_getnextbatch != NULL);
+
+	return sscan->rs_rd->rd_tableam->scan_getnextbatch(sscan, direction, batch);
+}
+
 
 /* ----------------------------------------------------------------------------
  * Parallel table scan related functions.
@@ -42,6 +42,7 @@
  */
 struct DatumStream;
 struct AOCSFileSegInfo;
+struct ColumnBatch;
 
 typedef struct AOCSInsertDescData
 {
@@ -427,6 +428,8 @@ extern void aocs_rescan(AOCSScanDesc scan);
 extern void aocs_endscan(AOCSScanDesc scan);
 
 extern bool aocs_getnext(AOCSScanDesc scan, ScanDirection direction, TupleTableSlot *slot);
+extern bool aocs_getnextbatch(AOCSScanDesc scan, ScanDirection direction,
+							  struct ColumnBatch *batch);
 extern AOCSInsertDesc aocs_insert_init(Relation rel, int segno, int64 num_rows);
 extern void aocs_insert_values(AOCSInsertDesc idesc, Datum *d, bool *null, AOTupleId *aoTupleId);
 static inline void aocs_insert(AOCSInsertDesc idesc, TupleTableSlot *slot)
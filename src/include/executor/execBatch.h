@@ -0,0 +1,62 @@
+/*--------------------------------------------------------------------
+ * execBatch.h
+ *	  Batch-at-a-time evaluation of scan quals.
+ *
+ * Portions Copyright (c) 2024-Present VMware, Inc. or its affiliates.
+ * Portions Copyright (c) 1996-2019, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *		src/include/executor/execBatch.h
+ *--------------------------------------------------------------------
+ */
+#ifndef EXECBATCH_H
+#define EXECBATCH_H
+
+#include "nodes/execnodes.h"
+
+/* maximum number of rows in a batch */
+#define COLUMN_BATCH_SIZE 1024
+
+/*
+ * ColumnBatch
+ *
+ * A batch of rows returned by a table AM's scan_getnextbatch, stored column
+ * by column.  Only the columns the scan reads are filled, their 0-based
+ * attribute numbers are listed in cols; values and isnull of the others are
+ * NULL.  Pass-by-reference values point into the AM's buffers, and are only
+ * valid until the next batch is fetched.
+ *
+ * The selection vector lists the rows still qualifying, in ascending order.
+ * The AM leaves out the rows that are not visible, and ExecBatchQual the
+ * ones that fail the quals.
+ */
+typedef struct ColumnBatch
+{
+	TupleDesc	tupdesc;
+	MemoryContext mcxt;
+
+	int			ncols;			/* number of columns filled */
+	AttrNumber *cols;			/* their attribute numbers */
+	Datum	  **values;			/* values[attno][row] */
+	bool	  **isnull;			/* isnull[attno][row] */
+	ItemPointerData *tids;		/* identifiers of the rows */
+
+	int			nrows;			/* number of rows in the batch */
+	int			nsel;			/* number of selected rows */
+	uint16	   *sel;			/* selected rows */
+} ColumnBatch;
+
+/* compiled batch quals, see execBatch.c */
+typedef struct ExprBatchState ExprBatchState;
+
+extern ColumnBatch *MakeColumnBatch(TupleDesc tupdesc);
+extern void ColumnBatchAddColumn(ColumnBatch *batch, AttrNumber attno);
+extern void ExecStoreBatchRow(ColumnBatch *batch, int row,
+							  TupleTableSlot *slot);
+
+extern ExprBatchState *ExecInitBatchQual(List *qual, TupleDesc tupdesc,
+										 List **residual);
+extern void ExecBatchQual(ExprBatchState *state, ColumnBatch *batch);
+
+#endif							/* EXECBATCH_H */
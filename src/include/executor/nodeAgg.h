@@ -164,6 +164,14 @@ typedef struct AggStatePerTransData
 	FunctionCallInfo serialfn_fcinfo;
 
 	FunctionCallInfo deserialfn_fcinfo;
+
+	/*
+	 * GPDB: in batch mode, the batch column holding the input value (-1 if
+	 * the aggregate takes none), and the transfn applied to whole batches
+	 * by agg_advance_batch(), or InvalidOid to call transfn row by row.
+	 */
+	int			batchInputCol;
+	Oid			batchTransfn;
 }			AggStatePerTransData;
 
 /*
@@ -48,6 +48,10 @@ extern void ExecParallelHashTableInsert(HashJoinTable hashtable,
 extern void ExecParallelHashTableInsertCurrentBatch(HashJoinTable hashtable,
 													TupleTableSlot *slot,
 													uint32 hashvalue);
+extern void ExecHashRuntimeFilterReset(HashJoinRuntimeFilter *filter,
+									   double ntuples);
+extern bool ExecHashRuntimeFilterPasses(HashJoinRuntimeFilter *filter,
+										TupleTableSlot *slot);
 extern bool ExecHashGetHashValue(HashState *hashState, HashJoinTable hashtable,
 								 ExprContext *econtext,
 								 List *hashkeys,
@@ -67,6 +71,7 @@ extern void ExecPrepHashTableForUnmatched(HashJoinState *hjstate);
 extern bool ExecScanHashTableForUnmatched(HashJoinState *hjstate,
 										  ExprContext *econtext);
 extern void ExecHashTableReset(HashState *hashState, HashJoinTable hashtable);
+extern void ExecHashTableReleaseTuples(HashJoinTable hashtable);
 extern void ExecHashTableResetMatchFlags(HashJoinTable hashtable);
 extern void ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
                                     uint64 operatorMemKB,
@@ -56,6 +56,7 @@ struct DefElem;
 struct GpPolicy;
 struct PartitionSelector;
 struct Motion;
+struct Hash;
 struct Var;
 struct Const;
 struct ArrayExpr;
@@ -597,6 +598,14 @@ Oid GetBaseType(Oid typid);
 // and takes ownership of the result
 Expr *EvaluateExpr(Expr *expr, Oid result_type, int32 typmod);
 
+// returns the results of evaluating the constant expressions in 'exprs' as a
+// list of Consts, using a single executor state. Caller keeps ownership of
+// 'exprs' and takes ownership of the result
+List *EvaluateExprs(List *exprs);
+
+// copy the MCVs of the outer join key into the hash node
+void SetHashSkewValues(Hash *hash);
+
 // extract string value from defelem's value
 char *DefGetString(DefElem *defelem);
 
@@ -611,9 +620,23 @@ Node *EvalConstExpressions(Node *node);
 FaultInjectorType_e InjectFaultInOptTasks(const char *fault_name);
 #endif
 
-// Does the metadata cache need to be reset (because of a catalog
-// table has been changed?)
-bool MDCacheNeedsReset(void);
+// Collect the catalog changes since last call. Returns true if the whole
+// metadata cache needs to be reset; otherwise has_invalidations tells if
+// the MDCache*Invalidated() functions below may report changed entries
+bool MDCacheNeedsReset(bool *has_invalidations);
+
+// Was the given relation changed, according to the last MDCacheNeedsReset()?
+bool MDCacheRelationInvalidated(Oid relid);
+
+// Was the given type changed, according to the last MDCacheNeedsReset()?
+bool MDCacheTypeInvalidated(Oid type_oid);
+
+// Was the given constraint changed, according to the last MDCacheNeedsReset()?
+bool MDCacheConstraintInvalidated(Oid constraint_oid);
+
+// Were the column statistics of the given relation changed, according to the
+// last MDCacheNeedsReset()?
+bool MDCacheColStatsInvalidated(Oid relid);
 
 // returns true if a query cancel is requested in GPDB
 bool IsAbortRequested(void);
@@ -636,12 +659,11 @@ uint32 UUIDHash(Datum d);
 
 void *GPDBMemoryContextAlloc(MemoryContext context, Size size);
 
-MemoryContext GPDBAllocSetContextCreate();
+MemoryContext GPDBAllocSetContextCreate(Size init_block_size,
+										 Size max_block_size);
 
 void GPDBMemoryContextDelete(MemoryContext context);
 
-List *GetRelChildIndexes(Oid reloid);
-
 Oid GetForeignServerId(Oid reloid);
 
 void GPDBLockRelationOid(Oid reloid, int lockmode);
@@ -674,6 +696,10 @@ PartitionDesc GPDBRelationRetrievePartitionDesc(Relation rel);
 
 PartitionKey GPDBRelationRetrievePartitionKey(Relation rel);
 
+// attno in the root partitioned table of an attribute of a partition
+AttrNumber GetPartitionRootAttno(Relation root_rel, Relation part_rel,
+								 AttrNumber attno);
+
 bool TestexprIsHashable(Node *testexpr, List *param_ids);
 
 gpos::BOOL WalkQueryTree(Query *query, bool (*walker)(), void *context,
@@ -132,6 +132,9 @@ private:
 
 	UlongToUlongMap *m_part_selector_to_param_map;
 
+	// table attnos of the user columns of the scanned tables, by colid
+	UlongToUlongMap *m_colid_to_attno_map;
+
 	// hash map of the queryid (of DML query) and the target relation index
 	HMUlIndex *m_used_rte_indexes;
 
@@ -238,6 +241,13 @@ public:
 
 	ULONG GetParamIdForSelector(OID oid_type, const ULONG selectorId);
 
+	// record the table attno of a column of a scanned table
+	void AddColIdAttno(ULONG colid, INT attno);
+
+	// table attno of a column of a scanned table, InvalidAttrNumber if the
+	// column is not a user column of any table scanned so far
+	AttrNumber GetAttnoForColId(ULONG colid) const;
+
 	Index FindRTE(Oid reloid);
 
 	// used by internal GPDB functions to build the RelOptInfo when creating foreign scans
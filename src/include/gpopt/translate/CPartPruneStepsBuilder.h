@@ -15,6 +15,7 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/translate/CContextDXLToPlStmt.h"
 #include "gpopt/translate/CMappingColIdVarPlStmt.h"
 #include "gpopt/translate/CTranslatorDXLToScalar.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
@@ -26,13 +27,8 @@ namespace gpdxl
 class CPartPruneStepsBuilder
 {
 private:
-	// root partitioned tabled
-	Relation m_relation;
-
-	// index in the rtable
-	Index m_rtindex;
-
-	// list of pruned scan nodes denoted as an index of the relation's partition_mdids
+	// list of pruned scan nodes denoted as an index of the relation's
+	// partition_mdids, i.e. of the leaf partitions of all levels
 	ULongPtrArray *m_part_indexes;
 
 	// colid -> var mapping from the subtree
@@ -41,14 +37,36 @@ private:
 	// dxl -> scalar translator
 	CTranslatorDXLToScalar *m_translator_dxl_to_scalar;
 
+	// plstmt context holding the range table
+	CContextDXLToPlStmt *m_dxl_to_plstmt_context;
+
+	// root partitioned table
+	Relation m_root_relation;
+
+	// lock mode of the root partitioned table
+	INT m_lockmode;
+
+	// does the root partitioned table have sub-partitioned partitions
+	BOOL m_is_multi_level;
+
+	// index of the next leaf partition in partition_mdids
+	ULONG m_leaf_index;
+
+	// index of the next surviving leaf partition in m_part_indexes
+	ULONG m_part_ptr;
+
 	// ctor
-	CPartPruneStepsBuilder(Relation relation, Index rtindex,
-						   ULongPtrArray *part_indexes,
+	CPartPruneStepsBuilder(ULongPtrArray *part_indexes,
 						   CMappingColIdVarPlStmt *colid_var_mapping,
-						   CTranslatorDXLToScalar *translator_dxl_to_scalar);
+						   CTranslatorDXLToScalar *translator_dxl_to_scalar,
+						   CContextDXLToPlStmt *dxl_to_plstmt_context,
+						   Relation root_relation, INT lockmode);
 
 	CPartPruneStepsBuilder(const CPartPruneStepsBuilder &) = default;
 
+	// range table index of a sub-partitioned partition
+	Index GetPartitionRTIndex(Relation relation);
+
 public:
 	// dtor
 	~CPartPruneStepsBuilder() = default;
@@ -56,19 +74,23 @@ public:
 	static List *CreatePartPruneInfos(
 		CDXLNode *filterNode, Relation relation, Index rtindex,
 		ULongPtrArray *part_indexes, CMappingColIdVarPlStmt *colid_var_mapping,
-		CTranslatorDXLToScalar *translator_dxl_to_scalar);
+		CTranslatorDXLToScalar *translator_dxl_to_scalar,
+		CContextDXLToPlStmt *dxl_to_plstmt_context);
+
+	List *CreatePartPruneInfoForOneLevel(CDXLNode *filterNode,
+										 Relation relation, Index rtindex,
+										 INT prune_info_index);
 
-	PartitionedRelPruneInfo *CreatePartPruneInfoForOneLevel(
-		CDXLNode *filterNode);
+	List *PartPruneStepsForLevel(CDXLNode *filterNode, Relation relation);
 
-	List *PartPruneStepsFromFilter(CDXLNode *filterNode, INT *step_id,
-								   List *steps_list);
+	List *PartPruneStepsFromFilter(CDXLNode *filterNode, Relation relation,
+								   INT *step_id, List *steps_list);
 
-	List *PartPruneStepFromScalarCmp(CDXLNode *node, INT *step_id,
-									 List *steps_list);
+	List *PartPruneStepFromScalarCmp(CDXLNode *node, Relation relation,
+									 INT *step_id, List *steps_list);
 
-	List *PartPruneStepFromScalarBoolExpr(CDXLNode *node, INT *step_id,
-										  List *steps_list);
+	List *PartPruneStepFromScalarBoolExpr(CDXLNode *node, Relation relation,
+										  INT *step_id, List *steps_list);
 };
 }  // namespace gpdxl
 
@@ -165,6 +165,15 @@ private:
 
 	static BOOL SetSecurityQualsVarnoWalker(Node *node, Index *index);
 
+	// does the subtree contain a motion, a partition selector or a shared
+	// scan, which require a join to read its inner side first
+	static BOOL HasMotionHazard(const CDXLNode *dxlnode);
+
+	// the base table column that the given key over the outputs of the plan
+	// reads, through motions and projections that pass the column on
+	BOOL GetBaseTableColumn(Plan *plan, Expr *key, Oid *rel_oid,
+							AttrNumber *attno, bool *inh);
+
 public:
 	// ctor
 	CTranslatorDXLToPlStmt(CMemoryPool *mp, CMDAccessor *md_accessor,
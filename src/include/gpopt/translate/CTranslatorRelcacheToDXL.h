@@ -140,6 +140,36 @@ private:
 	// array of function properties map
 	static const SFuncProps m_func_props[];
 
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		SLeafPartitions
+	//
+	//	@doc:
+	//		Leaf partitions of a partitioned table and the properties of the
+	//		table that depend on them, collected in a single pass over its
+	//		partition hierarchy
+	//
+	//---------------------------------------------------------------------------
+	struct SLeafPartitions
+	{
+		// leaf partition oids, depth first in partition bound order
+		IMdIdArray *m_partition_oids;
+
+		// storage type of the leaves that are not foreign, Sentinel if
+		// there are none
+		IMDRelation::Erelstoragetype m_storage_type;
+
+		// lowest AO version of the leaves
+		IMDRelation::Erelaoversion m_ao_version;
+
+		// is any leaf foreign
+		BOOL m_has_foreign;
+
+		// do all leaves have the columns of the root
+		BOOL m_match_root_cols;
+
+	};	// struct SLeafPartitions
+
 	// lookup function properties
 	static void LookupFuncProps(
 		OID func_oid,
@@ -207,6 +237,21 @@ private:
 										 ULongPtrArray **part_keys,
 										 CharPtrArray **part_types);
 
+	// get partition key attno and strategy of a partitioned table
+	static AttrNumber RetrievePartKey(Relation rel, CHAR *part_type);
+
+	// get leaf partitions below a partitioned table, and the partition keys
+	// and types of the levels below the root
+	static void RetrieveLeafPartitions(CMemoryPool *mp, Relation root_rel,
+									   Relation rel, ULONG level,
+									   ULongPtrArray *part_keys,
+									   CharPtrArray *part_types,
+									   SLeafPartitions *leaves);
+
+	// fold the properties of a leaf partition into those of its root
+	static void AddLeafPartition(Relation root_rel, Relation rel,
+								 SLeafPartitions *leaves);
+
 	// get keysets for relation
 	static ULongPtr2dArray *RetrieveRelKeysets(
 		CMemoryPool *mp, OID oid, BOOL should_add_default_keys,
@@ -278,10 +323,6 @@ private:
 		AttrNumber attrnum, CDXLBucketArray *dxl_stats_bucket_array,
 		CDouble rows);
 
-	static IMdIdArray *RetrieveIndexPartitions(CMemoryPool *mp, OID rel_oid);
-
-	static IMDRelation::Erelstoragetype RetrieveStorageTypeForPartitionedTable(
-		Relation rel);
 
 public:
 	// retrieve a metadata object from the relcache
@@ -75,6 +75,10 @@ private:
 	// translator for the DXL input -> GPDB Expr
 	CTranslatorDXLToScalar m_dxl2scalar_translator;
 
+	// translate the result of an evaluation to DXL; an error is thrown if
+	// the result is not a constant
+	CDXLNode *TranslateResultToDXL(Expr *result);
+
 public:
 	// ctor
 	CConstExprEvaluatorProxy(CMemoryPool *mp, CMDAccessor *md_accessor)
@@ -93,6 +97,12 @@ public:
 	// caller keeps ownership of 'expr_dxlnode' and takes ownership of the returned pointer
 	CDXLNode *EvaluateExpr(const CDXLNode *expr) override;
 
+	// evaluate given constant expressions using a single executor state and
+	// return the DXL representation of the results in the same order.
+	// caller keeps ownership of 'dxl_exprs' and takes ownership of the
+	// returned array
+	CDXLNodeArray *EvaluateExprs(const CDXLNodeArray *dxl_exprs) override;
+
 	// returns true iff the evaluator can evaluate constant expressions without subqueries
 	BOOL
 	FCanEvalExpressions() override
@@ -36,7 +36,7 @@ private:
 
 public:
 	// ctor
-	CMemoryPoolPalloc();
+	explicit CMemoryPoolPalloc(EAllocStrategy strategy = EasGeneral);
 
 	// allocate memory
 	void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
@@ -31,7 +31,7 @@ public:
 							 EMemoryPoolType memory_pool_type);
 
 	// allocate new memorypool
-	CMemoryPool *NewMemoryPool() override;
+	CMemoryPool *NewMemoryPool(CMemoryPool::EAllocStrategy strategy) override;
 
 	// free allocation
 	void DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat) override;
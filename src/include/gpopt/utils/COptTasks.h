@@ -35,12 +35,19 @@ namespace gpdxl
 class CDXLNode;
 }
 
+namespace gpmd
+{
+class IMDCacheObject;
+}
+
 namespace gpopt
 {
 class CExpression;
 class CMDAccessor;
+class CMDKey;
 class CQueryContext;
 class COptimizerConfig;
+class COptimizationProfile;
 class ICostModel;
 class CPlanHint;
 }  // namespace gpopt
@@ -124,6 +131,14 @@ private:
 												   ICostModel *cost_model,
 												   CPlanHint *plan_hints);
 
+	// does the given metadata cache entry depend on a changed catalog object
+	static BOOL IsInvalidatedMDCacheEntry(CMDKey *const &mdkey,
+										  gpmd::IMDCacheObject *const &md_obj,
+										  void *context);
+
+	// initialize the metadata cache or bring it up to date with the catalog
+	static void RefreshMDCache();
+
 	// optimize a query to a physical DXL
 	static void *OptimizeTask(void *ptr);
 
@@ -133,6 +148,9 @@ private:
 		const CDXLNode *dxlnode, bool can_set_tag,
 		DistributionHashOpsKind distribution_hashops);
 
+	// translate an optimization profile into the list shown by EXPLAIN
+	static List *ConvertToProfileList(const COptimizationProfile *profile);
+
 	// load search strategy from given path
 	static CSearchStageArray *LoadSearchStrategy(CMemoryPool *mp, char *path);
 
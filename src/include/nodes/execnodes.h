@@ -1482,6 +1482,9 @@ typedef struct ScanState
 	Relation	ss_currentRelation;
 	struct TableScanDescData *ss_currentScanDesc;
 	TupleTableSlot *ss_ScanTupleSlot;
+
+	/* GPDB: filter of the hash join we feed, see HashJoinRuntimeFilter */
+	struct HashJoinRuntimeFilter *ss_runtime_filter;
 } ScanState;
 
 /* ----------------
@@ -1492,6 +1495,12 @@ typedef struct SeqScanState
 {
 	ScanState	ss;				/* its first field is NodeTag */
 	Size		pscan_len;		/* size of parallel heap scan descriptor */
+
+	/* GPDB: batch mode, see SeqNextBatch */
+	struct ColumnBatch *batch;	/* rows read ahead, or NULL */
+	struct ExprBatchState *batch_qual;	/* quals evaluated on whole batches,
+										 * or NULL */
+	int			batch_pos;		/* next selected row of the batch */
 } SeqScanState;
 
 /* ----------------
@@ -2364,8 +2373,33 @@ typedef struct HashJoinState
 	/* set if the operator created workfiles */
 	bool workfiles_created;
 	bool reuse_hashtable; /* Do we need to preserve hash table to support rescan */
+
+	/* GPDB: outer tuples read ahead to swap the sides, or NULL */
+	struct HashJoinReversal *hj_Reversal;
 } HashJoinState;
 
+/* ----------------
+ *	 HashJoinRuntimeFilter information
+ *
+ *		GPDB: Bloom filter over the hash values of the inner side of a hash
+ *		join.  The Hash node fills it while it builds the hash table, and
+ *		the scan that feeds the outer side of the join in the same slice
+ *		drops the rows whose hash value is not among the inner ones, as the
+ *		join would not find a match for them.
+ * ----------------
+ */
+typedef struct HashJoinRuntimeFilter
+{
+	struct HashJoinState *hjstate;	/* join the filter belongs to */
+	ExprContext *econtext;		/* to compute outer hash values */
+	MemoryContext mcxt;			/* holds the filter */
+	struct bloom_filter *bloom; /* inner hash values added so far */
+	bool		built;			/* all inner hash values are in bloom */
+	bool		disabled;		/* not selective, passes every row */
+	uint64		nprobed;		/* outer rows probed */
+	uint64		nrejected;		/* outer rows dropped */
+} HashJoinRuntimeFilter;
+
 
 /* ----------------------------------------------------------------
  *				 Materialization State Information
@@ -2559,6 +2593,15 @@ typedef struct AggState
 
 	/* stream entries when out of memory instead of spilling to disk */
 	bool		streaming;
+
+	/* GPDB: batch mode, see agg_fill_hash_table_batch() */
+	struct SeqScanState *batch_input;	/* child returning batches, or NULL */
+	AttrNumber *batch_inputcols;	/* batch column of each input column */
+	struct ColumnBatch *batch;	/* current batch, or NULL */
+	int			batch_pos;		/* next selected row of the batch */
+	AggStatePerGroup *batch_pergroups;	/* groups of the rows being
+										 * aggregated */
+	TupleTableSlot *batch_slot;	/* input row to spill */
 } AggState;
 
 typedef struct TupleSplitState
@@ -2811,6 +2854,19 @@ typedef struct HashState
 
 	/* Parallel hash state. */
 	struct ParallelHashJoinState *parallel_state;
+
+	/* GPDB: runtime filter to fill while hashing, or NULL */
+	HashJoinRuntimeFilter *hs_runtime_filter;
+
+	/*
+	 * GPDB: stop the build rather than start spilling, once the hash table
+	 * holds this many tuples (0 = never), so that the join can swap its
+	 * sides.  The tuple the build stopped at is kept in hs_paused_slot, and
+	 * the next MultiExecHash call resumes with it.
+	 */
+	double		hs_pause_tuples;
+	bool		hs_paused;
+	TupleTableSlot *hs_paused_slot;
 } HashState;
 
 /* ----------------
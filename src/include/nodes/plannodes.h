@@ -156,6 +156,15 @@ typedef struct PlannedStmt
  	 * GPDB: whether a query is a SPI inner query for extension usage 
  	 */
 	int8		metricsQueryType;
+
+	/*
+	 * GPDB: profile of GPORCA optimization, shown by EXPLAIN when
+	 * optimizer_explain_profile is on. A list of entries, each a list of
+	 * a String kind ("Stage", "Job" or "Xform"), a String name, and Integer
+	 * calls, time (us), memory (bytes), groups, group expressions, bindings
+	 * and results.
+	 */
+	List	   *optimizerProfile;
 } PlannedStmt;
 
 /*
@@ -1159,6 +1168,12 @@ typedef struct HashJoin
 	 * perform lookups in the hashtable over the inner plan.
 	 */
 	List	   *hashkeys;
+
+	/*
+	 * GPDB: build a runtime filter over the hash values of the inner plan,
+	 * for the scan on the outer side to drop rows that cannot match.
+	 */
+	bool		use_runtime_filter;
 } HashJoin;
 
 #define SHARE_ID_NOT_SHARED (-1)
@@ -1405,6 +1420,10 @@ typedef struct GatherMerge
  * If the executor is supposed to try to apply skew join optimization, then
  * skewTable/skewColumn/skewInherit identify the outer relation's join key
  * column, from which the relevant MCV statistics can be fetched.
+ *
+ * GPDB: statistics only exist on the coordinator, so the MCVs and their
+ * frequencies are also copied into skewValues/skewFreqs at plan time, for
+ * the segments to use.
  * ----------------
  */
 typedef struct Hash
@@ -1420,6 +1439,8 @@ typedef struct Hash
 	Oid			skewTable;		/* outer join key's table OID, or InvalidOid */
 	AttrNumber	skewColumn;		/* outer join key's column #, or zero */
 	bool		skewInherit;	/* is outer join rel an inheritance tree? */
+	List	   *skewValues;		/* MCVs of the outer join key, as Consts */
+	List	   *skewFreqs;		/* their frequencies, as float4 Consts */
 	/* all other info is in the parent HashJoin node */
 	double		rows_total;		/* estimate total rows if parallel_aware */
 } Hash;
@@ -146,6 +146,7 @@ extern Node *estimate_expression_value(PlannerInfo *root, Node *node);
 
 extern Expr *evaluate_expr(Expr *expr, Oid result_type, int32 result_typmod,
 						   Oid result_collation);
+extern List *evaluate_expr_list(List *exprs);
 
 extern List *expand_function_arguments(List *args, Oid result_type,
 									   struct HeapTupleData *func_tuple);
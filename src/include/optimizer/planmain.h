@@ -74,6 +74,7 @@ extern Material *make_material(Plan *lefttree);
 extern Result *make_result(List *tlist, Node *resconstantqual, Plan *subplan);
 extern Plan *add_sort_cost(PlannerInfo *root, Plan *input, 
 						   double limit_tuples);
+extern void set_hash_skew_values(Hash *node);
 
 /* External use of these functions is deprecated: */
 extern Sort *make_sort_from_pathkeys(Plan *lefttree, List *pathkeys, Relids relids);
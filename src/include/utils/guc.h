@@ -463,6 +463,7 @@ extern bool	optimizer_print_expression_properties;
 extern bool	optimizer_print_group_properties;
 extern bool	optimizer_print_optimization_context;
 extern bool optimizer_print_optimization_stats;
+extern bool optimizer_explain_profile;
 extern bool optimizer_print_xform_results;
 
 /* array of xforms disable flags */
@@ -511,11 +512,13 @@ extern bool optimizer_expand_fulljoin;
 extern bool optimizer_enable_hashagg;
 extern bool optimizer_enable_groupagg;
 extern bool optimizer_enable_mergejoin;
+extern bool optimizer_enable_inner_left_mergejoin;
 extern bool optimizer_enable_redistribute_nestloop_loj_inner_child;
 extern bool optimizer_force_comprehensive_join_implementation;
 extern bool optimizer_enable_replicated_table;
 extern bool optimizer_enable_foreign_table;
 extern bool optimizer_enable_right_outer_join;
+extern bool optimizer_enable_runtime_join_filter;
 extern bool optimizer_enable_query_parameter;
 
 /* Optimizer plan enumeration related GUCs */
@@ -545,6 +548,7 @@ extern int optimizer_penalize_broadcast_threshold;
 extern double optimizer_cost_threshold;
 extern double optimizer_nestloop_factor;
 extern double optimizer_sort_factor;
+extern double optimizer_replan_cost_factor;
 
 /* Optimizer hints */
 extern int optimizer_array_expansion_threshold;
@@ -555,6 +559,7 @@ extern int optimizer_cte_inlining_bound;
 extern int optimizer_push_group_by_below_setop_threshold;
 extern int optimizer_xform_bind_threshold;
 extern int optimizer_skew_factor;
+extern int optimizer_planning_deadline;
 extern bool optimizer_force_multistage_agg;
 extern bool optimizer_force_three_stage_scalar_dqa;
 extern bool optimizer_force_expanded_distinct_aggs;
@@ -623,6 +628,11 @@ extern bool gp_allow_date_field_width_5digits;
 
 extern bool gp_enable_blkdir_sampling;
 
+extern bool gp_enable_hashjoin_role_reversal;
+
+extern bool gp_enable_vectorized_scan;
+extern bool gp_enable_vectorized_agg;
+
 typedef enum
 {
 	INDEX_CHECK_NONE,
@@ -47,8 +47,11 @@
 		"gp_detect_data_correctness",
 		"gp_disable_tuple_hints",
 		"gp_enable_blkdir_sampling",
+		"gp_enable_hashjoin_role_reversal",
 		"gp_enable_interconnect_aggressive_retry",
 		"gp_enable_segment_copy_checking",
+		"gp_enable_vectorized_agg",
+		"gp_enable_vectorized_scan",
 		"gp_external_enable_filter_pushdown",
 		"gp_hashjoin_tuples_per_bucket",
 		"gp_ignore_error_table",
@@ -371,6 +371,7 @@
 		"optimizer_enable_indexjoin",
 		"optimizer_enable_indexonlyscan",
 		"optimizer_enable_indexscan",
+		"optimizer_enable_inner_left_mergejoin",
 		"optimizer_enable_master_only_queries",
 		"optimizer_enable_materialize",
 		"optimizer_enable_mergejoin",
@@ -396,10 +397,12 @@
 		"optimizer_enable_tablescan",
 		"optimizer_enable_foreign_table",
 		"optimizer_enable_right_outer_join",
+		"optimizer_enable_runtime_join_filter",
 		"optimizer_enable_query_parameter",
 		"optimizer_enforce_subplans",
 		"optimizer_enumerate_plans",
 		"optimizer_expand_fulljoin",
+		"optimizer_explain_profile",
 		"optimizer_extract_dxl_stats",
 		"optimizer_extract_dxl_stats_all_nodes",
 		"optimizer_force_agg_skew_avoidance",
@@ -422,6 +425,7 @@
 		"optimizer_penalize_broadcast_threshold",
 		"optimizer_penalize_skew",
 		"optimizer_plan_id",
+		"optimizer_planning_deadline",
 		"optimizer_print_expression_properties",
 		"optimizer_print_group_properties",
 		"optimizer_print_job_scheduler",
@@ -439,6 +443,7 @@
 		"optimizer_push_group_by_below_setop_threshold",
 		"optimizer_push_requirements_from_consumer_to_producer",
 		"optimizer_remove_order_below_dml",
+		"optimizer_replan_cost_factor",
 		"optimizer_replicated_table_insert",
 		"optimizer_sample_plans",
 		"optimizer_samples_number",
@@ -655,3 +655,58 @@ set enable_seqscan=off;
 -- force_explain
 explain (analyze, timing off, summary off)
 select * from pt, t where t.dist = pt.dist and t.tid = pt.ptid order by t.tid, t.sk;
+
+reset enable_mergejoin;
+reset enable_seqscan;
+
+--
+-- Multi-level partitions with a sub-partitioned table whose columns are laid
+-- out differently from the root. Each level prunes on its own key, and the
+-- sub-level key must be matched by attribute number mapped to the root.
+--
+create schema dpe_multilevel;
+set search_path='dpe_multilevel';
+set optimizer_multilevel_partitioning = on;
+
+create table ml_fact (dist int, pid int, code text, u int)
+distributed by (dist) partition by range (pid);
+create table ml_fact_1 partition of ml_fact for values from (0) to (2)
+partition by list (code);
+create table ml_fact_1_ca partition of ml_fact_1 for values in ('CA');
+create table ml_fact_1_oh partition of ml_fact_1 for values in ('OH');
+create table ml_fact_2 (junk int, code text, u int, pid int, dist int)
+distributed by (dist) partition by list (code);
+alter table ml_fact_2 drop column junk;
+create table ml_fact_2_ca partition of ml_fact_2 for values in ('CA');
+create table ml_fact_2_oh partition of ml_fact_2 for values in ('OH');
+alter table ml_fact attach partition ml_fact_2 for values from (2) to (4);
+
+insert into ml_fact select i % 3, i % 4, case when i % 2 = 0 then 'CA' else 'OH' end, i
+from generate_series(1, 100) i;
+
+create table ml_dim (dist int, pid int, code text) distributed by (dist);
+insert into ml_dim values (1, 1, 'OH'), (2, 2, 'OH'), (3, 2, 'CA');
+
+analyze ml_fact;
+analyze ml_dim;
+
+set optimizer_trace_fallback = on;
+
+-- Static pruning on the first level, the second level and both
+select count(*), sum(u) from ml_fact where pid = 2;
+select count(*), sum(u) from ml_fact where code = 'OH';
+select count(*), sum(u) from ml_fact where pid = 2 and code = 'CA';
+select count(*), sum(u) from ml_fact where pid < 2 and code = 'CA';
+
+-- Join pruning on both levels
+select count(*), sum(ml_fact.u) from ml_fact join ml_dim
+  on ml_fact.pid = ml_dim.pid and ml_fact.code = ml_dim.code;
+
+-- Join pruning on the first level only and on the second level only
+select count(*), sum(ml_fact.u) from ml_fact join ml_dim
+  on ml_fact.pid = ml_dim.pid;
+select count(*), sum(ml_fact.u) from ml_fact join ml_dim
+  on ml_fact.code = ml_dim.code;
+
+reset optimizer_trace_fallback;
+reset optimizer_multilevel_partitioning;
@@ -0,0 +1,89 @@
+--
+-- Hash joins that swap their sides at runtime, when the inner side turns out
+-- much larger than estimated (gp_enable_hashjoin_role_reversal)
+--
+create extension if not exists gp_inject_fault;
+
+create schema gp_hashjoin_reversal;
+set search_path = gp_hashjoin_reversal;
+set gp_autostats_mode = none;
+
+-- the statistics of hj_inner are taken with 30 rows, and are stale by the
+-- time it holds 600000; both tables are distributed by the join key, so
+-- there is no motion below the join
+create table hj_inner (a int, b int) distributed by (a);
+create table hj_outer (a int, b int) distributed by (a);
+create table hj_outer_big (a int, b int) distributed by (a);
+create table hj_outer_huge (a int, b int) distributed by (a);
+insert into hj_inner select i, i % 7 from generate_series(1, 30) i;
+insert into hj_outer select i * 10, i from generate_series(1, 300) i;
+insert into hj_outer_big select i, 1 from generate_series(1, 60000) i;
+insert into hj_outer_huge select i, i % 11 from generate_series(1, 600000) i;
+analyze hj_inner;
+analyze hj_outer;
+analyze hj_outer_big;
+analyze hj_outer_huge;
+insert into hj_inner select i, i % 7 from generate_series(31, 600000) i;
+
+set enable_nestloop = off;
+set enable_mergejoin = off;
+set optimizer_enable_nljoin = off;
+set statement_mem = '2MB';
+
+-- the results without swapping
+set gp_enable_hashjoin_role_reversal = off;
+select count(*), sum(i.b), sum(o.b)
+from hj_outer o join hj_inner i on o.a = i.a;
+select count(*), sum(i.b), sum(o.b)
+from hj_outer_big o join hj_inner i on o.a = i.a;
+create table hj_rows_off as
+select o.a, o.b, i.b as ib
+from hj_outer_huge o join hj_inner i on o.a = i.a
+distributed by (a);
+
+set gp_enable_hashjoin_role_reversal = on;
+select gp_inject_fault('hashjoin_reverse_roles', 'skip', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+-- hj_outer fits in memory, so the sides are swapped
+select count(*), sum(i.b), sum(o.b)
+from hj_outer o join hj_inner i on o.a = i.a;
+select gp_inject_fault('hashjoin_reverse_roles', 'status', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+-- hj_outer_big does not, so the build of the hash table is finished, and
+-- the tuples read ahead are replayed
+select count(*), sum(i.b), sum(o.b)
+from hj_outer_big o join hj_inner i on o.a = i.a;
+select gp_inject_fault('hashjoin_reverse_roles', 'status', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+-- hj_outer_huge is read ahead until the memory that the inner hash table
+-- leaves is used up; the build is then finished with that much less memory,
+-- and spills, and the tuples read ahead are replayed before the rest of
+-- hj_outer_huge
+create table hj_rows_on as
+select o.a, o.b, i.b as ib
+from hj_outer_huge o join hj_inner i on o.a = i.a
+distributed by (a);
+select gp_inject_fault('hashjoin_reverse_roles', 'status', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+select count(*), sum(ib), sum(b) from hj_rows_on;
+
+-- the rows that differ from the ones without swapping
+(select 'off' as src, * from hj_rows_off except all
+ select 'off', * from hj_rows_on)
+union all
+(select 'on', * from hj_rows_on except all
+ select 'on', * from hj_rows_off);
+
+select gp_inject_fault('hashjoin_reverse_roles', 'reset', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+reset statement_mem;
+reset optimizer_enable_nljoin;
+reset enable_mergejoin;
+reset enable_nestloop;
+reset gp_enable_hashjoin_role_reversal;
+reset gp_autostats_mode;
+drop schema gp_hashjoin_reversal cascade;
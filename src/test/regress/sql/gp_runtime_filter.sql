@@ -0,0 +1,108 @@
+--
+-- Bloom filters built by hash joins and probed by the scans on their outer
+-- side (optimizer_enable_runtime_join_filter)
+--
+-- start_matchsubs
+-- m/Memory Usage: \d+\w?B/
+-- s/Memory Usage: \d+\w?B/Memory Usage: ###B/
+-- m/Buckets: \d+/
+-- s/Buckets: \d+/Buckets: ###/
+-- m/Batches: \d+/
+-- s/Batches: \d+/Batches: ###/
+-- m/Extra Text: \(seg\d+\).*/
+-- s/Extra Text: \(seg\d+\).*/Extra Text: ###/
+-- end_matchsubs
+
+create schema gp_runtime_filter;
+set search_path = gp_runtime_filter;
+
+-- all rows of both tables are on the same segment, so that the row counts
+-- of EXPLAIN ANALYZE are stable
+create table rf_fact (a int, b int) distributed by (a);
+create table rf_dim (a int, b int) distributed by (a);
+insert into rf_fact select 1, i % 1000 from generate_series(1, 30000) i;
+insert into rf_dim select 1, i from generate_series(1, 10) i;
+analyze rf_fact;
+analyze rf_dim;
+
+set optimizer_enable_runtime_join_filter = on;
+
+-- only the 300 rows of rf_fact with a match reach the join
+explain (analyze, costs off, timing off, summary off)
+select count(*) from rf_fact join rf_dim on rf_fact.b = rf_dim.b;
+select count(*) from rf_fact join rf_dim on rf_fact.b = rf_dim.b;
+select rf_dim.b, count(*), sum(rf_fact.b)
+from rf_fact join rf_dim on rf_fact.b = rf_dim.b
+group by rf_dim.b order by rf_dim.b;
+
+-- a filter that rejects nothing is dropped after the first rows
+insert into rf_dim select 1, i from generate_series(0, 999) i;
+analyze rf_dim;
+select count(*) from rf_fact join rf_dim on rf_fact.b = rf_dim.b;
+
+-- so is one that rejects fewer than 10% of the first 10000 rows: of the
+-- 1500 rows of rf_fact without a match, only the 500 among them are removed
+create table rf_dim2 (a int, b int) distributed by (a);
+insert into rf_dim2 select 1, i from generate_series(0, 949) i;
+analyze rf_dim2;
+explain (analyze, costs off, timing off, summary off)
+select count(*) from rf_fact join rf_dim2 on rf_fact.b = rf_dim2.b;
+select count(*) from rf_fact join rf_dim2 on rf_fact.b = rf_dim2.b;
+
+-- the build of a hash table whose inner side is much larger than estimated
+-- pauses, so that the join can swap its sides
+-- (gp_enable_hashjoin_role_reversal); the filter is only probed once the
+-- build is finished, and never if the sides are swapped
+create extension if not exists gp_inject_fault;
+set gp_autostats_mode = none;
+create table rf_inner (a int, b int) distributed by (a);
+create table rf_outer (a int, b int) distributed by (a);
+create table rf_outer_big (a int, b int) distributed by (a);
+insert into rf_inner select i, i % 7 from generate_series(1, 30) i;
+insert into rf_outer select i * 10, i from generate_series(1, 300) i;
+insert into rf_outer_big select i * 20, i % 5 from generate_series(1, 60000) i;
+analyze rf_inner;
+analyze rf_outer;
+analyze rf_outer_big;
+insert into rf_inner select i, i % 7 from generate_series(31, 600000) i;
+
+set enable_nestloop = off;
+set enable_mergejoin = off;
+set optimizer_enable_nljoin = off;
+set statement_mem = '2MB';
+set gp_enable_hashjoin_role_reversal = on;
+select gp_inject_fault('hashjoin_reverse_roles', 'skip', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+-- rf_outer fits in memory, so the sides are swapped
+select count(*), sum(i.b), sum(o.b)
+from rf_outer o join rf_inner i on o.a = i.a;
+select gp_inject_fault('hashjoin_reverse_roles', 'status', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+-- rf_outer_big does not, so the build is finished, and the half of its rows
+-- without a match is removed once it is
+select count(*), sum(i.b), sum(o.b)
+from rf_outer_big o join rf_inner i on o.a = i.a;
+select gp_inject_fault('hashjoin_reverse_roles', 'status', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+select gp_inject_fault('hashjoin_reverse_roles', 'reset', dbid)
+from gp_segment_configuration where content = 0 and role = 'p';
+
+reset optimizer_enable_runtime_join_filter;
+select count(*) from rf_fact join rf_dim on rf_fact.b = rf_dim.b;
+select count(*) from rf_fact join rf_dim2 on rf_fact.b = rf_dim2.b;
+select count(*), sum(i.b), sum(o.b)
+from rf_outer o join rf_inner i on o.a = i.a;
+select count(*), sum(i.b), sum(o.b)
+from rf_outer_big o join rf_inner i on o.a = i.a;
+
+reset gp_enable_hashjoin_role_reversal;
+reset statement_mem;
+reset optimizer_enable_nljoin;
+reset enable_mergejoin;
+reset enable_nestloop;
+reset gp_autostats_mode;
+
+drop schema gp_runtime_filter cascade;
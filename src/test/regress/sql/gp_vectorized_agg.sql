@@ -0,0 +1,134 @@
+--
+-- Hashed aggregation of batches of rows from sequential scans
+-- (gp_enable_vectorized_agg).  The results are compared with the ones of
+-- the same aggregations a row at a time.
+--
+create extension if not exists gp_inject_fault;
+
+create schema gp_vectorized_agg;
+set search_path = gp_vectorized_agg;
+
+-- group 0 has only NULL i4 values, group 1 NaNs, group 2 Infinity, group 3
+-- both Infinity and -Infinity, and group 4 only NULL f8 values; the sums
+-- of i4 do not fit in int4, and the ones of i8 not in int8
+create table va_t (id int, g int, i4 int, i8 int8, f8 float8, d date)
+using ao_column distributed by (id);
+insert into va_t
+select i,
+       case when i % 1000 = 999 then null else i % 100 end,
+       case when i % 100 = 0 or i % 13 = 0 then null else 2147483647 - i end,
+       9223372036854775807 - i,
+       case when i % 100 = 1 and i % 7 = 0 then 'NaN'::float8
+            when i % 100 = 2 and i % 7 = 0 then 'Infinity'::float8
+            when i % 100 = 3 and i % 7 = 0 then
+                 case when (i / 100) % 2 = 0 then 'Infinity'::float8
+                      else '-Infinity'::float8 end
+            when i % 100 = 4 then null
+            else i / 4.0::float8 end,
+       date '2024-01-01' + i % 1000
+from generate_series(1, 60000) i;
+create table va_outer (id int) distributed replicated;
+insert into va_outer values (1), (2), (3);
+analyze va_t;
+analyze va_outer;
+
+set gp_enable_vectorized_scan = on;
+
+-- two-stage aggregation, with a streaming first stage
+set gp_enable_vectorized_agg = off;
+create table va_row as
+select g, count(*) as n, count(i4) as n_i4, sum(i4) as sum_i4,
+       min(i4) as min_i4, max(i4) as max_i4, sum(i8) as sum_i8,
+       sum(f8) as sum_f8, min(f8) as min_f8, max(f8) as max_f8,
+       min(d) as min_d, max(d) as max_d
+from va_t group by g distributed by (g);
+set gp_enable_vectorized_agg = on;
+create table va_batch as
+select g, count(*) as n, count(i4) as n_i4, sum(i4) as sum_i4,
+       min(i4) as min_i4, max(i4) as max_i4, sum(i8) as sum_i8,
+       sum(f8) as sum_f8, min(f8) as min_f8, max(f8) as max_f8,
+       min(d) as min_d, max(d) as max_d
+from va_t group by g distributed by (g);
+select count(*) from va_batch;
+-- the groups whose results differ, if any
+(select 'row' as src, * from va_row except all
+ select 'row', * from va_batch)
+union all
+(select 'batch', * from va_batch except all
+ select 'batch', * from va_row);
+select * from va_batch where g < 5 or g is null order by g;
+
+-- the first stage streams its hash table out after 100 rows on each segment
+select gp_inject_fault('force_hashagg_stream_hashtable', 'skip', '', '', '',
+                       100, 100, 0, dbid)
+from gp_segment_configuration where role = 'p' and content >= 0;
+create table va_stream as
+select g, count(*) as n, count(i4) as n_i4, sum(i4) as sum_i4,
+       min(i4) as min_i4, max(i4) as max_i4, sum(i8) as sum_i8,
+       sum(f8) as sum_f8, min(f8) as min_f8, max(f8) as max_f8,
+       min(d) as min_d, max(d) as max_d
+from va_t group by g distributed by (g);
+select gp_inject_fault('force_hashagg_stream_hashtable', 'reset', dbid)
+from gp_segment_configuration where role = 'p' and content >= 0;
+(select 'row' as src, * from va_row except all
+ select 'row', * from va_stream)
+union all
+(select 'stream', * from va_stream except all
+ select 'stream', * from va_row);
+
+-- a hash table that spills to disk, which the fault confirms
+set statement_mem = '1MB';
+set gp_enable_vectorized_agg = off;
+create table va_spill_row as
+select id, count(*) as n, sum(i4) as sum_i4, max(f8) as max_f8,
+       min(d) as min_d
+from va_t group by id distributed by (id);
+set gp_enable_vectorized_agg = on;
+select gp_inject_fault('hashagg_spill_temp_files', 'skip', dbid)
+from gp_segment_configuration where role = 'p' and content >= 0;
+set client_min_messages = warning;
+create table va_spill_batch as
+select id, count(*) as n, sum(i4) as sum_i4, max(f8) as max_f8,
+       min(d) as min_d
+from va_t group by id distributed by (id);
+reset client_min_messages;
+select gp_wait_until_triggered_fault('hashagg_spill_temp_files', 1, dbid)
+from gp_segment_configuration where role = 'p' and content >= 0;
+select gp_inject_fault('hashagg_spill_temp_files', 'reset', dbid)
+from gp_segment_configuration where role = 'p' and content >= 0;
+select count(*) from va_spill_batch;
+(select 'row' as src, * from va_spill_row except all
+ select 'row', * from va_spill_batch)
+union all
+(select 'batch', * from va_spill_batch except all
+ select 'batch', * from va_spill_row);
+
+-- rescans, for each row of va_outer, which have to aggregate again since
+-- the hash table spilled
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+set enable_material = off;
+set optimizer_enable_hashjoin = off;
+set optimizer_enable_materialize = off;
+set gp_enable_vectorized_agg = off;
+select o.id, s.n, s.sum_i4
+from va_outer o
+join (select id, count(*) as n, sum(i4) as sum_i4 from va_t group by id) s
+  on s.id = o.id
+order by o.id;
+set gp_enable_vectorized_agg = on;
+select o.id, s.n, s.sum_i4
+from va_outer o
+join (select id, count(*) as n, sum(i4) as sum_i4 from va_t group by id) s
+  on s.id = o.id
+order by o.id;
+
+reset optimizer_enable_materialize;
+reset optimizer_enable_hashjoin;
+reset enable_material;
+reset enable_mergejoin;
+reset enable_hashjoin;
+reset statement_mem;
+reset gp_enable_vectorized_agg;
+reset gp_enable_vectorized_scan;
+drop schema gp_vectorized_agg cascade;
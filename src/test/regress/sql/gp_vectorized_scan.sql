@@ -0,0 +1,171 @@
+--
+-- Sequential scans that read and filter batches of rows
+-- (gp_enable_vectorized_scan).  Every query is run a row at a time first,
+-- and then a batch at a time, with the same results.
+--
+create schema gp_vectorized_scan;
+set search_path = gp_vectorized_scan;
+
+create table vs_t (id int, i4 int, i8 int8, f8 float8, d date, t text)
+using ao_column distributed by (id);
+insert into vs_t
+select i,
+       case when i % 10 = 0 then null else i % 100 end,
+       i * 1000000000::int8,
+       case when i % 97 = 0 then 'NaN'::float8
+            when i % 89 = 0 then null
+            else i / 4.0::float8 end,
+       date '2024-01-01' + i % 366,
+       'row ' || i
+from generate_series(1, 5000) i;
+create table vs_outer (id int) distributed replicated;
+insert into vs_outer values (51), (52), (56), (60);
+analyze vs_t;
+analyze vs_outer;
+
+set gp_enable_vectorized_scan = off;
+-- NULLs fail the quals
+select count(*), sum(id) from vs_t where i4 > 50;
+select count(*), sum(id) from vs_t where i4 >= 5 and i4 < 10;
+select count(*), sum(id) from vs_t where i4 + 1 = 2;
+-- NaN is larger than any other float8, and equal to itself
+select count(*), sum(id) from vs_t where f8 > 1000::float8;
+select count(*), sum(id) from vs_t where f8 = 'NaN'::float8;
+select count(*), sum(id) from vs_t where f8 < 'NaN'::float8;
+select count(*), sum(id) from vs_t where f8 * 2::float8 <= 10::float8;
+-- dates
+select count(*), sum(id) from vs_t where d >= date '2024-03-01' and d < date '2024-04-01';
+-- quals the batches can't evaluate are evaluated on the rows selected,
+-- or on all rows if the first qual is one of them
+select count(*), sum(id) from vs_t where i4 > 50 and t like 'row 1%';
+select count(*), sum(id) from vs_t where t like '%5' and i4 > 50;
+-- overflows raise errors, but only on rows that the quals before them
+-- select
+select count(*), sum(id) from vs_t where i4 * 100000000 > 0;
+select count(*), sum(id) from vs_t where i4 < 20 and i4 * 100000000 > 0;
+select count(*), sum(id) from vs_t where i8 * 10000000000 > 0::int8;
+select count(*), sum(id) from vs_t where id <= 900 and i8 * 10000000::int8 > 0::int8;
+select count(*), sum(id) from vs_t where f8 * 1e308::float8 > 0::float8;
+
+set gp_enable_vectorized_scan = on;
+-- NULLs fail the quals
+select count(*), sum(id) from vs_t where i4 > 50;
+select count(*), sum(id) from vs_t where i4 >= 5 and i4 < 10;
+select count(*), sum(id) from vs_t where i4 + 1 = 2;
+-- NaN is larger than any other float8, and equal to itself
+select count(*), sum(id) from vs_t where f8 > 1000::float8;
+select count(*), sum(id) from vs_t where f8 = 'NaN'::float8;
+select count(*), sum(id) from vs_t where f8 < 'NaN'::float8;
+select count(*), sum(id) from vs_t where f8 * 2::float8 <= 10::float8;
+-- dates
+select count(*), sum(id) from vs_t where d >= date '2024-03-01' and d < date '2024-04-01';
+-- quals the batches can't evaluate are evaluated on the rows selected,
+-- or on all rows if the first qual is one of them
+select count(*), sum(id) from vs_t where i4 > 50 and t like 'row 1%';
+select count(*), sum(id) from vs_t where t like '%5' and i4 > 50;
+-- overflows raise errors, but only on rows that the quals before them
+-- select
+select count(*), sum(id) from vs_t where i4 * 100000000 > 0;
+select count(*), sum(id) from vs_t where i4 < 20 and i4 * 100000000 > 0;
+select count(*), sum(id) from vs_t where i8 * 10000000000 > 0::int8;
+select count(*), sum(id) from vs_t where id <= 900 and i8 * 10000000::int8 > 0::int8;
+select count(*), sum(id) from vs_t where f8 * 1e308::float8 > 0::float8;
+
+-- rescans, for each row of vs_outer
+set enable_hashjoin = off;
+set enable_mergejoin = off;
+set enable_material = off;
+set optimizer_enable_hashjoin = off;
+set optimizer_enable_materialize = off;
+set gp_enable_vectorized_scan = off;
+select count(*), sum(t.id) from vs_outer o join vs_t t on t.id = o.id
+where t.i4 > 50;
+set gp_enable_vectorized_scan = on;
+select count(*), sum(t.id) from vs_outer o join vs_t t on t.id = o.id
+where t.i4 > 50;
+reset optimizer_enable_materialize;
+reset optimizer_enable_hashjoin;
+reset enable_material;
+reset enable_mergejoin;
+reset enable_hashjoin;
+
+-- rows deleted in the visibility map are skipped, the overflows they would
+-- cause too
+delete from vs_t where i4 >= 20;
+
+set gp_enable_vectorized_scan = off;
+select count(*), sum(id) from vs_t where i4 > 15;
+select count(*), sum(id) from vs_t where i4 >= 5 and i4 < 10;
+select count(*), sum(id) from vs_t where i4 * 100000000 > 0;
+select count(*), sum(id) from vs_t where f8 < 'NaN'::float8;
+
+set gp_enable_vectorized_scan = on;
+select count(*), sum(id) from vs_t where i4 > 15;
+select count(*), sum(id) from vs_t where i4 >= 5 and i4 < 10;
+select count(*), sum(id) from vs_t where i4 * 100000000 > 0;
+select count(*), sum(id) from vs_t where f8 < 'NaN'::float8;
+
+-- a column added with a default has no values stored for the rows before
+alter table vs_t add column n int default 7;
+insert into vs_t (id, i4, i8, f8, d, t, n)
+select i, i % 100, i * 1000000000::int8, i / 4.0::float8,
+       date '2024-01-01' + i % 366, 'row ' || i, i % 3
+from generate_series(5001, 6000) i;
+
+set gp_enable_vectorized_scan = off;
+select count(*), sum(id) from vs_t where n = 7;
+select count(*), sum(id) from vs_t where n < 2 and i4 > 50;
+select count(*), sum(id) from vs_t where i4 > 15;
+
+set gp_enable_vectorized_scan = on;
+select count(*), sum(id) from vs_t where n = 7;
+select count(*), sum(id) from vs_t where n < 2 and i4 > 50;
+select count(*), sum(id) from vs_t where i4 > 15;
+
+-- the batch path selects the same rows as the row path, also where the
+-- quals see NULLs, or the missing values of the columns added after the
+-- rows were stored
+alter table vs_t add column m int8;
+alter table vs_t add column k int8 default 5000000000;
+insert into vs_t (id, i4, i8, f8, d, t, n, m, k)
+select i, case when i % 7 = 0 then null else i % 100 end,
+       i * 1000000000::int8, i / 4.0::float8, date '2024-01-01' + i % 366,
+       'row ' || i, null, i, case when i % 2 = 0 then null else i end
+from generate_series(6001, 6500) i;
+create table vs_sel (batch bool, q int, id int) distributed by (id);
+
+set gp_enable_vectorized_scan = off;
+insert into vs_sel select false, 1, id from vs_t where i4 <> 5;
+insert into vs_sel select false, 2, id from vs_t where n > 0;
+insert into vs_sel select false, 3, id from vs_t where m > 6100::int8;
+insert into vs_sel select false, 4, id from vs_t where k = 5000000000::int8;
+insert into vs_sel select false, 5, id from vs_t where k - m <= 0::int8;
+-- no overflow is raised for rows with a NULL argument, or that an earlier
+-- qual leaves out; the other rows raise the same error in both paths
+select count(*), sum(id) from vs_t where id <= 6000 and m + 9223372036854775807 > 0::int8;
+select count(*), sum(id) from vs_t where i4 < 1 and i4 + 2147483647 > 0;
+select count(*), sum(id) from vs_t where k + 9223372036854775000 > 0::int8;
+select count(*), sum(id) from vs_t where i4 + 2147483647 > 0;
+
+set gp_enable_vectorized_scan = on;
+insert into vs_sel select true, 1, id from vs_t where i4 <> 5;
+insert into vs_sel select true, 2, id from vs_t where n > 0;
+insert into vs_sel select true, 3, id from vs_t where m > 6100::int8;
+insert into vs_sel select true, 4, id from vs_t where k = 5000000000::int8;
+insert into vs_sel select true, 5, id from vs_t where k - m <= 0::int8;
+-- no overflow is raised for rows with a NULL argument, or that an earlier
+-- qual leaves out; the other rows raise the same error in both paths
+select count(*), sum(id) from vs_t where id <= 6000 and m + 9223372036854775807 > 0::int8;
+select count(*), sum(id) from vs_t where i4 < 1 and i4 + 2147483647 > 0;
+select count(*), sum(id) from vs_t where k + 9223372036854775000 > 0::int8;
+select count(*), sum(id) from vs_t where i4 + 2147483647 > 0;
+
+select q, count(*) filter (where not batch) as by_row,
+       count(*) filter (where batch) as by_batch
+from vs_sel group by q order by q;
+-- no row is selected by one path only
+select q, id from vs_sel group by q, id
+having count(*) filter (where batch) <> count(*) filter (where not batch);
+
+reset gp_enable_vectorized_scan;
+drop schema gp_vectorized_scan cascade;